@@ -0,0 +1,125 @@
+/*
+ *  Copyright 2021 Cisco Systems, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "bench.h"
+
+// Resolved by the linker through --wrap
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t nmemb, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+void __real_free(void *ptr);
+
+static __thread bench_heap_t m_heap;
+static uint64_t m_target_ns = BENCH_TARGET_MS * 1000000ULL;
+
+void *__wrap_malloc(size_t size) {
+  m_heap.allocs++;
+  m_heap.bytes += size;
+  return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t nmemb, size_t size) {
+  m_heap.allocs++;
+  m_heap.bytes += nmemb * size;
+  return __real_calloc(nmemb, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+  m_heap.allocs++;
+  m_heap.bytes += size;
+  return __real_realloc(ptr, size);
+}
+
+void __wrap_free(void *ptr) {
+  if (ptr)
+    m_heap.frees++;
+  __real_free(ptr);
+}
+
+uint64_t bench_now() {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+void bench_heap(bench_heap_t *heap) {
+  *heap = m_heap;
+}
+
+void bench_heap_since(bench_heap_t *heap) {
+  heap->allocs = m_heap.allocs - heap->allocs;
+  heap->bytes = m_heap.bytes - heap->bytes;
+  heap->frees = m_heap.frees - heap->frees;
+}
+
+void bench_target(uint32_t ms) {
+  if (ms)
+    m_target_ns = ms * 1000000ULL;
+}
+
+static uint64_t run_calls(bench_fn_t fn, void *arg, uint64_t calls, uint64_t *bytes) {
+  uint64_t start = bench_now(), sum = 0, i;
+
+  for (i = 0; i < calls; i++)
+    sum += fn(arg);
+  if (bytes)
+    *bytes = sum;
+  return bench_now() - start;
+}
+
+void bench_run(const char *bench, const char *name, bench_fn_t fn, void *arg,
+               uint32_t ops_per_call) {
+  bench_result_t res = {0};
+  uint64_t calls = 1, ns;
+
+  // Grow the run until it is long enough to extrapolate from
+  fn(arg);
+  while ((ns = run_calls(fn, arg, calls, NULL)) < m_target_ns / 20)
+    calls *= 2;
+  calls = calls * m_target_ns / (ns ? ns : 1);
+  if (calls == 0)
+    calls = 1;
+
+  res.bench = bench;
+  res.name = name;
+  bench_heap(&res.heap);
+  res.ns = run_calls(fn, arg, calls, &res.bytes);
+  bench_heap_since(&res.heap);
+  res.ops = calls * ops_per_call;
+  bench_report(&res);
+}
+
+void bench_report(const bench_result_t *res) {
+  double ops = res->ops ? (double)res->ops : 1.0;
+
+  printf("{\"bench\":\"%s\",\"name\":\"%s\",\"ops\":%llu,\"ns_per_op\":%.1f,"
+         "\"ops_per_sec\":%.0f,\"bytes_per_op\":%.1f,\"allocs_per_op\":%.2f,"
+         "\"alloc_bytes_per_op\":%.1f,\"frees_per_op\":%.2f}\n",
+         res->bench, res->name, (unsigned long long)res->ops,
+         res->ns / ops,
+         res->ns ? res->ops * 1e9 / res->ns : 0.0,
+         res->bytes / ops,
+         res->heap.allocs / ops,
+         res->heap.bytes / ops,
+         res->heap.frees / ops);
+  fflush(stdout);
+}
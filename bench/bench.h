@@ -0,0 +1,132 @@
+/*
+ *  Copyright 2021 Cisco Systems, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef _BENCH_H
+#define _BENCH_H
+
+/*! \file
+ *
+ * Benchmark support
+ *
+ * Timing, heap allocation counting and result reporting shared by the
+ * benchmark programs. Heap calls are counted per thread by wrapping
+ * malloc, calloc, realloc and free at link time, so only the work of
+ * the measuring thread is attributed to a benchmark. Results are
+ * printed as one JSON object per line.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "csmpservice.h"
+
+/** \brief heap calls made by the calling thread */
+typedef struct {
+  uint64_t allocs;  /**< malloc, calloc and realloc calls */
+  uint64_t bytes;   /**< bytes requested by those calls */
+  uint64_t frees;   /**< free calls with a non-NULL pointer */
+} bench_heap_t;
+
+/** \brief one benchmark result */
+typedef struct {
+  const char *bench;  /**< benchmark name */
+  const char *name;   /**< case within the benchmark */
+  uint64_t ops;       /**< operations measured */
+  uint64_t ns;        /**< wall time spent on them */
+  uint64_t bytes;     /**< bytes produced or consumed, 0 if not meaningful */
+  bench_heap_t heap;  /**< heap calls made during the measurement */
+} bench_result_t;
+
+/**
+ * @brief monotonic time
+ *
+ * @return uint64_t nanoseconds
+ */
+uint64_t bench_now();
+
+/**
+ * @brief heap calls made by the calling thread so far
+ *
+ * @param heap filled with the running counters
+ */
+void bench_heap(bench_heap_t *heap);
+
+/**
+ * @brief heap calls made since a previous bench_heap()
+ *
+ * @param heap the earlier counters, replaced by the difference
+ */
+void bench_heap_since(bench_heap_t *heap);
+
+/**
+ * @brief operation under measurement
+ *
+ * @param arg the argument given to bench_run()
+ * @return size_t bytes produced or consumed by the call
+ */
+typedef size_t (*bench_fn_t)(void *arg);
+
+/**
+ * @brief set the time budget of each bench_run()
+ *
+ * @param ms milliseconds, 0 keeps BENCH_TARGET_MS
+ */
+void bench_target(uint32_t ms);
+
+/**
+ * @brief measure and report an operation
+ *
+ * fn is called until the time budget is spent, the iteration count
+ * being calibrated with a few short runs first.
+ *
+ * @param bench benchmark name
+ * @param name case within the benchmark
+ * @param fn the operation
+ * @param arg passed to fn
+ * @param ops_per_call operations fn performs per call
+ */
+void bench_run(const char *bench, const char *name, bench_fn_t fn, void *arg,
+               uint32_t ops_per_call);
+
+/**
+ * @brief print a result as a JSON line on stdout
+ *
+ * @param res the result
+ */
+void bench_report(const bench_result_t *res);
+
+/**
+ * @brief application callbacks answering from benchmark tables
+ *
+ * The callbacks serve the TLVs of the sample agent. Table TLVs
+ * (interfaces, addresses, routes, metrics) hold rows entries each.
+ * The handle includes batched and table GET callbacks, clear them to
+ * have the library read whole TLVs one by one.
+ *
+ * @param rows entries per table, 1 to BENCH_ROWS_MAX
+ * @return csmp_handle_t* the handle to pass to csmp_service_start()
+ */
+csmp_handle_t *bench_provider(uint32_t rows);
+
+/** \brief largest table size served by bench_provider() */
+#define BENCH_ROWS_MAX 256
+
+/** \brief default time budget of bench_run() in milliseconds */
+#ifndef BENCH_TARGET_MS
+#define BENCH_TARGET_MS 200
+#endif
+
+#endif
@@ -0,0 +1,373 @@
+/*
+ *  Copyright 2021 Cisco Systems, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "csmpinfo.h"
+#include "bench.h"
+
+/*
+ * The tables are filled once, so a GET costs the library's encoding
+ * work and not the application's. Values follow the sample agent.
+ */
+
+static uint32_t m_rows = 1;
+static uint32_t m_generation = 0;
+static Hardware_Desc m_hardwareDesc = HARDWARE_DESC_INIT;
+static Interface_Desc m_interfaceDesc[BENCH_ROWS_MAX];
+static IP_Address m_ipAddress[BENCH_ROWS_MAX];
+static IP_Route m_ipRoute[BENCH_ROWS_MAX];
+static Current_Time m_currentTime = CURRENT_TIME_INIT;
+static Up_Time m_upTime = UPTIME_INIT;
+static Interface_Metrics m_interfaceMetrics[BENCH_ROWS_MAX];
+static IPRoute_RPLMetrics m_iprouteRplmetrics[BENCH_ROWS_MAX];
+static WPAN_Status m_wpanStatus = WPANSTATUS_INIT;
+static Neighbor_802154G m_neighbor802154G[BENCH_ROWS_MAX];
+static RPL_Instance m_rplInstance = RPLINSTANCE_INIT;
+static Firmware_Image_Info m_firmwareImageInfo = FIRMWARE_IMAGE_INFO_INIT;
+
+static const uint8_t m_eui64[8] = {0x0a, 0x00, 0x27, 0xff, 0xfe, 0x3b, 0x2a, 0xb2};
+
+static void fill_addr(uint8_t *data, uint32_t row) {
+  static const uint8_t prefix[8] = {0x20, 0x01, 0x0d, 0xb8, 0x00, 0x0a, 0x00, 0x0b};
+
+  memcpy(data, prefix, sizeof(prefix));
+  memset(data + 8, 0, 8);
+  data[14] = (row >> 8) & 0xff;
+  data[15] = row & 0xff;
+}
+
+static void fill_singles() {
+  m_hardwareDesc.has_entphysicalindex = true;
+  m_hardwareDesc.entphysicalindex = 1;
+  m_hardwareDesc.has_entphysicaldescr = true;
+  sprintf(m_hardwareDesc.entphysicaldescr, "CSMP Agent Lib test node");
+  m_hardwareDesc.has_entphysicalclass = true;
+  m_hardwareDesc.entphysicalclass = MODULE;
+  m_hardwareDesc.has_entphysicalname = true;
+  sprintf(m_hardwareDesc.entphysicalname, "lowpan");
+  m_hardwareDesc.has_entphysicalhardwarerev = true;
+  sprintf(m_hardwareDesc.entphysicalhardwarerev, "1.0");
+  m_hardwareDesc.has_entphysicalfirmwarerev = true;
+  sprintf(m_hardwareDesc.entphysicalfirmwarerev, "1.0.0");
+  m_hardwareDesc.has_entphysicalserialnum = true;
+  sprintf(m_hardwareDesc.entphysicalserialnum, "0A0027FFFE3B2AB2");
+  m_hardwareDesc.has_entphysicalmfgname = true;
+  sprintf(m_hardwareDesc.entphysicalmfgname, "IOTG CRDC");
+  m_hardwareDesc.has_entphysicalmodelname = true;
+  sprintf(m_hardwareDesc.entphysicalmodelname, "CSMP AGENT LIB");
+  m_hardwareDesc.has_entphysicalfunction = true;
+  m_hardwareDesc.entphysicalfunction = 1;
+
+  m_currentTime.has_posix = true;
+  m_currentTime.posix = 1633046400;
+  m_upTime.has_sysuptime = true;
+  m_upTime.sysuptime = 86400;
+
+  m_wpanStatus.has_ifindex = true;
+  m_wpanStatus.ifindex = 2;
+  m_wpanStatus.has_ssid = true;
+  m_wpanStatus.ssid.len = 4;
+  memcpy(m_wpanStatus.ssid.data, "CRDC", 4);
+  m_wpanStatus.has_panid = true;
+  m_wpanStatus.panid = 1234;
+  m_wpanStatus.has_securitylevel = true;
+  m_wpanStatus.securitylevel = IEEE154_SEC_MIC_32;
+  m_wpanStatus.has_rank = true;
+  m_wpanStatus.rank = 256;
+  m_wpanStatus.has_beaconvalid = true;
+  m_wpanStatus.beaconvalid = true;
+  m_wpanStatus.has_beaconversion = true;
+  m_wpanStatus.beaconversion = 32695;
+  m_wpanStatus.has_txpower = true;
+  m_wpanStatus.txpower = 28;
+  m_wpanStatus.has_dagsize = true;
+  m_wpanStatus.dagsize = 4;
+  m_wpanStatus.has_lastchangedreason = true;
+  m_wpanStatus.lastchangedreason = IEEE154_PAN_LEAVE_INIT;
+
+  m_rplInstance.has_instanceindex = true;
+  m_rplInstance.instanceindex = 1;
+  m_rplInstance.has_instanceid = true;
+  m_rplInstance.instanceid = 170;
+  m_rplInstance.has_dodagid = true;
+  m_rplInstance.dodagid.len = 16;
+  fill_addr(m_rplInstance.dodagid.data, 0);
+  m_rplInstance.has_dodagversionnumber = true;
+  m_rplInstance.dodagversionnumber = 206;
+  m_rplInstance.has_rank = true;
+  m_rplInstance.rank = 256;
+  m_rplInstance.has_parentcount = true;
+  m_rplInstance.parentcount = 1;
+  m_rplInstance.has_dagsize = true;
+  m_rplInstance.dagsize = 4;
+
+  m_firmwareImageInfo.has_index = true;
+  m_firmwareImageInfo.index = 1;
+  m_firmwareImageInfo.has_filehash = true;
+  m_firmwareImageInfo.filehash.len = 32;
+  memset(m_firmwareImageInfo.filehash.data, 0x5a, 32);
+  m_firmwareImageInfo.has_filename = true;
+  sprintf(m_firmwareImageInfo.filename, "vendor firmware");
+  m_firmwareImageInfo.has_version = true;
+  sprintf(m_firmwareImageInfo.version, "1.0.0");
+  m_firmwareImageInfo.has_filesize = true;
+  m_firmwareImageInfo.filesize = 246272;
+  m_firmwareImageInfo.has_isdefault = true;
+  m_firmwareImageInfo.isdefault = true;
+  m_firmwareImageInfo.has_isrunning = true;
+  m_firmwareImageInfo.isrunning = true;
+  m_firmwareImageInfo.has_hwinfo = true;
+  m_firmwareImageInfo.hwinfo.has_vendorhwid = true;
+  sprintf(m_firmwareImageInfo.hwinfo.vendorhwid, "vendor hardware ID");
+}
+
+static void fill_row(uint32_t i) {
+  Interface_Desc *desc = &m_interfaceDesc[i];
+  IP_Address *addr = &m_ipAddress[i];
+  IP_Route *route = &m_ipRoute[i];
+  Interface_Metrics *metrics = &m_interfaceMetrics[i];
+  IPRoute_RPLMetrics *rpl = &m_iprouteRplmetrics[i];
+  Neighbor_802154G *nbr = &m_neighbor802154G[i];
+
+  desc->has_ifindex = true;
+  desc->ifindex = i + 1;
+  desc->has_ifname = true;
+  sprintf(desc->ifname, "lowpan%u", i);
+  desc->has_ifdescr = true;
+  sprintf(desc->ifdescr, "Ieee154");
+  desc->has_iftype = true;
+  desc->iftype = 259;
+  desc->has_ifphysaddress = true;
+  desc->ifphysaddress.len = 8;
+  memcpy(desc->ifphysaddress.data, m_eui64, 7);
+  desc->ifphysaddress.data[7] = i & 0xff;
+
+  addr->has_ipaddressindex = true;
+  addr->ipaddressindex = i + 1;
+  addr->has_ipaddressaddrtype = true;
+  addr->ipaddressaddrtype = IPV6;
+  addr->has_ipaddressaddr = true;
+  addr->ipaddressaddr.len = 16;
+  fill_addr(addr->ipaddressaddr.data, i + 1);
+  addr->has_ipaddressifindex = true;
+  addr->ipaddressifindex = 2;
+  addr->has_ipaddresstype = true;
+  addr->ipaddresstype = UNICAST;
+  addr->has_ipaddressorigin = true;
+  addr->ipaddressorigin = DHCP;
+  addr->has_ipaddressstatus = true;
+  addr->ipaddressstatus = true;
+  addr->has_ipaddresspfxlen = true;
+  addr->ipaddresspfxlen = 64;
+
+  route->has_inetcidrrouteindex = true;
+  route->inetcidrrouteindex = i + 1;
+  route->has_inetcidrroutedesttype = true;
+  route->inetcidrroutedesttype = IPV6;
+  route->has_inetcidrroutedest = true;
+  route->inetcidrroutedest.len = 16;
+  fill_addr(route->inetcidrroutedest.data, i + 1);
+  route->has_inetcidrroutepfxlen = true;
+  route->inetcidrroutepfxlen = 128;
+  route->has_inetcidrroutenexthoptype = true;
+  route->inetcidrroutenexthoptype = IPV6Z;
+  route->has_inetcidrroutenexthop = true;
+  route->inetcidrroutenexthop.len = 16;
+  fill_addr(route->inetcidrroutenexthop.data, 0);
+  route->has_inetcidrrouteifindex = true;
+  route->inetcidrrouteifindex = 2;
+
+  metrics->has_ifindex = true;
+  metrics->ifindex = i + 1;
+  metrics->has_ifadminstatus = true;
+  metrics->ifadminstatus = IF_ADMIN_STATUS_UP;
+  metrics->has_ifoperstatus = true;
+  metrics->ifoperstatus = IF_OPER_STATUS_UP;
+  metrics->has_ifinoctets = true;
+  metrics->ifinoctets = 610 * (i + 1);
+  metrics->has_ifoutoctets = true;
+  metrics->ifoutoctets = 1320 * (i + 1);
+  metrics->has_ifindiscards = true;
+  metrics->ifindiscards = 23;
+
+  rpl->has_inetcidrrouteindex = true;
+  rpl->inetcidrrouteindex = i + 1;
+  rpl->has_instanceindex = true;
+  rpl->instanceindex = 1;
+  rpl->has_rank = true;
+  rpl->rank = 256 + i;
+  rpl->has_hops = true;
+  rpl->hops = 1 + i % 8;
+  rpl->has_pathetx = true;
+  rpl->pathetx = 2;
+  rpl->has_linketx = true;
+  rpl->linketx = 2;
+  rpl->has_rssiforward = true;
+  rpl->rssiforward = -69;
+  rpl->has_rssireverse = true;
+  rpl->rssireverse = -59;
+  rpl->has_dagsize = true;
+  rpl->dagsize = 4;
+
+  nbr->has_nbrindex = true;
+  nbr->nbrindex = i + 1;
+  nbr->has_physaddress = true;
+  nbr->physaddress.len = 8;
+  memcpy(nbr->physaddress.data, m_eui64, 6);
+  nbr->physaddress.data[6] = (i >> 8) & 0xff;
+  nbr->physaddress.data[7] = i & 0xff;
+  nbr->has_lastchanged = true;
+  nbr->lastchanged = 3600 + i;
+  nbr->has_rssiforward = true;
+  nbr->rssiforward = -69 - (int32_t)(i % 32);
+  nbr->has_rssireverse = true;
+  nbr->rssireverse = -59 - (int32_t)(i % 32);
+  nbr->has_lqiforward = true;
+  nbr->lqiforward = 60;
+  nbr->has_lqireverse = true;
+  nbr->lqireverse = 8;
+}
+
+static void *bench_tlvs_get(tlvid_t tlvid, uint32_t *num) {
+  *num = 1;
+  switch (tlvid.type) {
+    case HARDWARE_DESC_TLVID:
+      return &m_hardwareDesc;
+    case INTERFACE_DESC_TLVID:
+      *num = m_rows;
+      return m_interfaceDesc;
+    case IPADDRESS_TLVID:
+      *num = m_rows;
+      return m_ipAddress;
+    case IPROUTE_TLVID:
+      *num = m_rows;
+      return m_ipRoute;
+    case CURRENT_TIME_TLVID:
+      return &m_currentTime;
+    case UPTIME_TLVID:
+      return &m_upTime;
+    case INTERFACE_METRICS_TLVID:
+      *num = m_rows;
+      return m_interfaceMetrics;
+    case IPROUTE_RPLMETRICS_TLVID:
+      *num = m_rows;
+      return m_iprouteRplmetrics;
+    case WPANSTATUS_TLVID:
+      return &m_wpanStatus;
+    case NEIGHBOR802154_G_TLVID:
+      *num = m_rows;
+      return m_neighbor802154G;
+    case RPLINSTANCE_TLVID:
+      return &m_rplInstance;
+    case FIRMWARE_IMAGE_INFO_TLVID:
+      return &m_firmwareImageInfo;
+    default:
+      break;
+  }
+  *num = 0;
+  return NULL;
+}
+
+static size_t bench_tlv_size(uint32_t type) {
+  switch (type) {
+    case HARDWARE_DESC_TLVID:
+      return sizeof(Hardware_Desc);
+    case INTERFACE_DESC_TLVID:
+      return sizeof(Interface_Desc);
+    case IPADDRESS_TLVID:
+      return sizeof(IP_Address);
+    case IPROUTE_TLVID:
+      return sizeof(IP_Route);
+    case CURRENT_TIME_TLVID:
+      return sizeof(Current_Time);
+    case UPTIME_TLVID:
+      return sizeof(Up_Time);
+    case INTERFACE_METRICS_TLVID:
+      return sizeof(Interface_Metrics);
+    case IPROUTE_RPLMETRICS_TLVID:
+      return sizeof(IPRoute_RPLMetrics);
+    case WPANSTATUS_TLVID:
+      return sizeof(WPAN_Status);
+    case NEIGHBOR802154_G_TLVID:
+      return sizeof(Neighbor_802154G);
+    case RPLINSTANCE_TLVID:
+      return sizeof(RPL_Instance);
+    case FIRMWARE_IMAGE_INFO_TLVID:
+      return sizeof(Firmware_Image_Info);
+    default:
+      return 0;
+  }
+}
+
+static void *bench_tlvs_get_rows(tlvid_t tlvid, uint32_t first, uint32_t max, uint32_t *num) {
+  uint8_t *tlv = bench_tlvs_get(tlvid, num);
+
+  if ((tlv == NULL) || (first >= *num)) {
+    *num = 0;
+    return NULL;
+  }
+  *num -= first;
+  if (*num > max)
+    *num = max;
+  return tlv + first * bench_tlv_size(tlvid.type);
+}
+
+static uint32_t bench_tlvs_get_batch(csmp_tlv_slot_t *slots, uint32_t cnt) {
+  uint32_t i, num;
+  void *tlv;
+
+  for (i = 0; i < cnt; i++) {
+    tlv = bench_tlvs_get(slots[i].tlvid, &num);
+    if (tlv && (num <= slots[i].max))
+      memcpy(slots[i].data, tlv, num * bench_tlv_size(slots[i].tlvid.type));
+    slots[i].num = num;
+  }
+  return m_generation;
+}
+
+static void bench_tlvs_post(tlvid_t tlvid, void *tlv) {
+  (void)tlvid; // Suppress unused param compiler warning.
+  (void)tlv; // Suppress unused param compiler warning.
+}
+
+static bool bench_signature_verify(const void *data, size_t datalen,
+                                   const void *sig, size_t siglen) {
+  (void)data; // Suppress unused param compiler warning.
+  (void)datalen; // Suppress unused param compiler warning.
+  (void)sig; // Suppress unused param compiler warning.
+  (void)siglen; // Suppress unused param compiler warning.
+  return true;
+}
+
+csmp_handle_t *bench_provider(uint32_t rows) {
+  static csmp_handle_t handle = {bench_tlvs_get, bench_tlvs_post, bench_signature_verify,
+                                 bench_tlvs_get_batch, bench_tlvs_get_rows};
+  uint32_t i;
+
+  if (rows < 1)
+    rows = 1;
+  if (rows > BENCH_ROWS_MAX)
+    rows = BENCH_ROWS_MAX;
+
+  fill_singles();
+  for (i = 0; i < rows; i++)
+    fill_row(i);
+  m_rows = rows;
+  m_generation++;
+  return &handle;
+}
@@ -0,0 +1,398 @@
+/*
+ *  Copyright 2021 Cisco Systems, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*
+ * Micro-benchmarks of the TLV codec.
+ *
+ *   varint  ProtobufVarint_* on 1-byte and full-width values
+ *   tlvid   csmptlv_strn2id and csmptlv_id2str of standard and vendor ids
+ *   get     every csmp_get_* handler, tables holding 1, 16 and 256 rows
+ *   row     the table handlers asked for their last row only
+ *   block   csmpagent_get_block of the last 1024-byte block of each table
+ *   write   csmptlv_write of one instance of each TLV type
+ *   readTL  csmptlv_readTL of one instance of each TLV type
+ *   read    csmptlv_read and csmptlv_free of one instance of each TLV type
+ *   find    csmptlv_find of each TLV type in a response holding all of them
+ *
+ * Cases are named <type>/<rows>. Only get, row, block and find depend on the
+ * table size, everything else is measured with the first size only.
+ *
+ *   csmp_codec [-t ms] [-r rows[,rows...]] [bench ...]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "csmp.h"
+#include "csmptlv.h"
+#include "csmpfunction.h"
+#include "csmpagent.h"
+#include "ProtobufVarint.h"
+#include "CsmpTlvs.pb-c.h"
+#include "csmpservice.h"
+#include "bench.h"
+
+enum {
+  VARINT_VALS = 64,
+  CODEC_BUF_SIZE = 64 * 1024,
+  CODEC_BLOCK_SIZE = 1024,
+  CODEC_ROWS_MAX = 8
+};
+
+typedef int (*codec_get_t)(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex);
+
+typedef struct {
+  const char *name;
+  uint32_t type;
+  codec_get_t get;
+  const ProtobufCMessageDescriptor *desc;
+  bool table;  // instances follow the provider's row count
+} codec_tlv_t;
+
+static const codec_tlv_t m_tlvs[] = {
+  {"tlvIndex", TLV_INDEX_TLVID, csmp_get_tlvindex, &tlv_index__descriptor, false},
+  {"deviceId", DEVICE_ID_TLVID, csmp_get_deviceid, &device_id__descriptor, false},
+  {"sessionId", SESSION_ID_TLVID, csmp_get_sessionID, &session_id__descriptor, false},
+  {"hardwareDesc", HARDWARE_DESC_TLVID, csmp_get_hardwareDesc, &hardware_desc__descriptor, false},
+  {"interfaceDesc", INTERFACE_DESC_TLVID, csmp_get_interfaceDesc, &interface_desc__descriptor, true},
+  {"reportSubscribe", REPORT_SUBSCRIBE_TLVID, csmp_get_reportSubscribe, &report_subscribe__descriptor, false},
+  {"ipAddress", IPADDRESS_TLVID, csmp_get_ipAddress, &ipaddress__descriptor, true},
+  {"ipRoute", IPROUTE_TLVID, csmp_get_ipRoute, &iproute__descriptor, true},
+  {"currentTime", CURRENT_TIME_TLVID, csmp_get_currenttime, &current_time__descriptor, false},
+  {"upTime", UPTIME_TLVID, csmp_get_uptime, &uptime__descriptor, false},
+  {"interfaceMetrics", INTERFACE_METRICS_TLVID, csmp_get_interfaceMetrics, &interface_metrics__descriptor, true},
+  {"ipRouteRplMetrics", IPROUTE_RPLMETRICS_TLVID, csmp_get_ipRouteRplMetrics, &iproute_rplmetrics__descriptor, true},
+  {"wpanStatus", WPANSTATUS_TLVID, csmp_get_wpanStatus, &wpanstatus__descriptor, false},
+  {"neighbor802154G", NEIGHBOR802154_G_TLVID, csmp_get_neighbor802154G, &neighbor802154_g__descriptor, true},
+  {"cgmsSettings", CGMSSETTINGS_TLVID, csmp_get_cgmsSettings, &cgmssettings__descriptor, false},
+  {"cgmsStatus", CGMSSTATUS_TLVID, csmp_get_cgmsStatus, &cgmsstatus__descriptor, false},
+  {"cgmsStats", CGMSSTATS_TLVID, csmp_get_cgmsStats, &cgmsstats__descriptor, false},
+  {"rplInstance", RPLINSTANCE_TLVID, csmp_get_rplInstance, &rplinstance__descriptor, false},
+  {"groupAssign", GROUP_ASSIGN_TLVID, csmp_get_groupAssign, &group_assign__descriptor, false},
+  {"groupInfo", GROUP_INFO_TLVID, csmp_get_groupInfo, &group_info__descriptor, false},
+  {"firmwareImageInfo", FIRMWARE_IMAGE_INFO_TLVID, csmp_get_firmwareImageInfo, &firmware_image_info__descriptor, false},
+};
+#define CODEC_TLV_CNT (sizeof(m_tlvs) / sizeof(m_tlvs[0]))
+
+/* state of one TLV case */
+typedef struct {
+  const codec_tlv_t *tlv;
+  tlvid_t tlvid;
+  const uint8_t *all;         // every TLV of the run, for find
+  uint32_t all_len;
+  uint8_t enc[CODEC_BUF_SIZE];  // the handler's output
+  uint32_t enc_len;
+  ProtobufCMessage *msg;      // first instance, decoded
+  int32_t last;               // index of the last row
+  csmp_cursor_t block;        // start of the last block
+} codec_case_t;
+
+typedef struct {
+  uint64_t val[VARINT_VALS];
+  uint8_t buf[VARINT_VALS * 10];
+  uint32_t len;
+  uint64_t sink;
+} varint_set_t;
+
+static uint8_t m_out[CODEC_BUF_SIZE];
+static uint8_t m_all[CODEC_BUF_SIZE * 4];
+static codec_case_t m_case[CODEC_TLV_CNT];
+
+#define VARINT_FNS(T, ctype) \
+static size_t varint_encode_##T(void *arg) { \
+  varint_set_t *set = arg; \
+  uint32_t i, used = 0; \
+  for (i = 0; i < VARINT_VALS; i++) \
+    used += ProtobufVarint_encode##T(set->buf + used, sizeof(set->buf) - used, (ctype)set->val[i]); \
+  set->len = used; \
+  return used; \
+} \
+static size_t varint_decode_##T(void *arg) { \
+  varint_set_t *set = arg; \
+  uint32_t i, used = 0; \
+  ctype v; \
+  for (i = 0; i < VARINT_VALS; i++) { \
+    used += ProtobufVarint_decode##T(set->buf + used, set->len - used, &v); \
+    set->sink += (uint64_t)v; \
+  } \
+  return used; \
+}
+
+VARINT_FNS(UINT32, uint32_t)
+VARINT_FNS(INT32, int32_t)
+VARINT_FNS(SINT32, int32_t)
+VARINT_FNS(UINT64, uint64_t)
+VARINT_FNS(INT64, int64_t)
+VARINT_FNS(SINT64, int64_t)
+
+typedef struct {
+  const char *name;
+  bench_fn_t encode;
+  bench_fn_t decode;
+  int64_t small;  // 1-byte encoding from here on
+  int64_t large;  // widest encoding
+} varint_kind_t;
+
+static void bench_varint() {
+  static const varint_kind_t kinds[] = {
+    {"UINT32", varint_encode_UINT32, varint_decode_UINT32, 0, (int64_t)UINT32_MAX},
+    {"INT32", varint_encode_INT32, varint_decode_INT32, 0, -1},
+    {"SINT32", varint_encode_SINT32, varint_decode_SINT32, -32, INT32_MIN},
+    {"UINT64", varint_encode_UINT64, varint_decode_UINT64, 0, -1},
+    {"INT64", varint_encode_INT64, varint_decode_INT64, 0, -1},
+    {"SINT64", varint_encode_SINT64, varint_decode_SINT64, -32, INT64_MIN},
+  };
+  static varint_set_t set;
+  char name[64];
+  uint32_t k, i, w;
+
+  for (k = 0; k < sizeof(kinds) / sizeof(kinds[0]); k++) {
+    for (w = 0; w < 2; w++) {
+      for (i = 0; i < VARINT_VALS; i++)
+        set.val[i] = w ? (uint64_t)kinds[k].large : (uint64_t)(kinds[k].small + (i % 64));
+      snprintf(name, sizeof(name), "encode%s/%s", kinds[k].name, w ? "large" : "small");
+      bench_run("varint", name, kinds[k].encode, &set, VARINT_VALS);
+      snprintf(name, sizeof(name), "decode%s/%s", kinds[k].name, w ? "large" : "small");
+      bench_run("varint", name, kinds[k].decode, &set, VARINT_VALS);
+    }
+  }
+}
+
+typedef struct {
+  const char *str;
+  tlvid_t id;
+  char out[16];
+} tlvid_case_t;
+
+static size_t run_strn2id(void *arg) {
+  tlvid_case_t *c = arg;
+
+  return csmptlv_strn2id(c->str, strlen(c->str), &c->id);
+}
+
+static size_t run_id2str(void *arg) {
+  tlvid_case_t *c = arg;
+  int rv = csmptlv_id2str(c->out, sizeof(c->out), &c->id);
+
+  return (rv > 0) ? rv : 0;
+}
+
+static void bench_tlvid() {
+  static tlvid_case_t cases[] = {
+    {"11", {0, 0}, ""},
+    {"e9.1234", {0, 0}, ""},
+  };
+  char name[64];
+  uint32_t i;
+
+  for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+    snprintf(name, sizeof(name), "strn2id/%s", cases[i].str);
+    bench_run("tlvid", name, run_strn2id, &cases[i], 1);
+    snprintf(name, sizeof(name), "id2str/%s", cases[i].str);
+    bench_run("tlvid", name, run_id2str, &cases[i], 1);
+  }
+}
+
+static size_t run_get(void *arg) {
+  codec_case_t *c = arg;
+  int rv = c->tlv->get(c->tlvid, m_out, sizeof(m_out), -1);
+
+  return (rv > 0) ? rv : 0;
+}
+
+static size_t run_row(void *arg) {
+  codec_case_t *c = arg;
+  int rv = c->tlv->get(c->tlvid, m_out, sizeof(m_out), c->last);
+
+  return (rv > 0) ? rv : 0;
+}
+
+static size_t run_block(void *arg) {
+  codec_case_t *c = arg;
+  csmp_cursor_t cursor = c->block;
+  bool more;
+  int rv = csmpagent_get_block(c->tlvid, m_out, CODEC_BLOCK_SIZE, &cursor, &more);
+
+  return (rv > 0) ? rv : 0;
+}
+
+static size_t run_write(void *arg) {
+  codec_case_t *c = arg;
+
+  return csmptlv_write(m_out, sizeof(m_out), c->tlvid, c->msg);
+}
+
+static size_t run_readTL(void *arg) {
+  codec_case_t *c = arg;
+  tlvid_t tlvid;
+  uint32_t tlvlen;
+
+  return csmptlv_readTL(c->enc, c->enc_len, &tlvid, &tlvlen);
+}
+
+static size_t run_read(void *arg) {
+  codec_case_t *c = arg;
+  ProtobufCMessage *msg = NULL;
+  tlvid_t tlvid;
+  size_t rv;
+
+  rv = csmptlv_read(c->enc, c->enc_len, &tlvid, &msg, c->tlv->desc);
+  if (msg)
+    csmptlv_free(msg);
+  return rv;
+}
+
+static size_t run_find(void *arg) {
+  codec_case_t *c = arg;
+  uint32_t len = 0;
+
+  csmptlv_find(c->all, c->all_len, c->tlvid, &len);
+  return len;
+}
+
+static bool bench_enabled(char **list, int cnt, const char *bench) {
+  int i;
+
+  if (cnt == 0)
+    return true;
+  for (i = 0; i < cnt; i++) {
+    if (strcmp(list[i], bench) == 0)
+      return true;
+  }
+  return false;
+}
+
+/* encode every TLV once, the cases then work from the captured output */
+static void codec_prepare(uint32_t rows) {
+  csmp_handle_t *handle = bench_provider(rows);
+  codec_case_t *c;
+  uint32_t all_len = 0, i;
+  csmp_cursor_t cursor;
+  tlvid_t tlvid;
+  uint32_t tlvlen;
+  bool more;
+  int rv;
+
+  g_csmptlvs_get = handle->csmptlvs_get;
+  g_csmptlvs_get_rows = handle->csmptlvs_get_rows;
+  for (i = 0; i < CODEC_TLV_CNT; i++) {
+    c = &m_case[i];
+    if (c->msg)
+      protobuf_c_message_free_unpacked(c->msg, NULL);
+    memset(c, 0, sizeof(*c));
+    c->tlv = &m_tlvs[i];
+    c->tlvid.type = m_tlvs[i].type;
+    c->last = m_tlvs[i].table ? (int32_t)rows - 1 : -1;
+    // Steps through the blocks, the case then starts at the last one
+    for (cursor = c->block, more = m_tlvs[i].table; more; ) {
+      c->block = cursor;
+      if (csmpagent_get_block(c->tlvid, m_out, CODEC_BLOCK_SIZE, &cursor, &more) < 0)
+        break;
+    }
+
+    rv = c->tlv->get(c->tlvid, c->enc, sizeof(c->enc), -1);
+    if (rv <= 0)
+      continue;
+    c->enc_len = rv;
+    if (all_len + rv <= sizeof(m_all)) {
+      memcpy(m_all + all_len, c->enc, rv);
+      all_len += rv;
+    }
+    // Held for the write case, kept out of the decode arena read uses
+    rv = csmptlv_readTL(c->enc, c->enc_len, &tlvid, &tlvlen);
+    if (rv > 0)
+      c->msg = protobuf_c_message_unpack(c->tlv->desc, NULL, tlvlen, c->enc + rv);
+  }
+  for (i = 0; i < CODEC_TLV_CNT; i++) {
+    m_case[i].all = m_all;
+    m_case[i].all_len = all_len;
+  }
+}
+
+static void bench_tlvs(char **list, int cnt, uint32_t rows, bool first) {
+  codec_case_t *c;
+  char name[64];
+  uint32_t i;
+
+  codec_prepare(rows);
+  for (i = 0; i < CODEC_TLV_CNT; i++) {
+    c = &m_case[i];
+    // Single instance TLVs do not change with the table size
+    if (!c->tlv->table && !first)
+      continue;
+    snprintf(name, sizeof(name), "%s/%u", c->tlv->name, c->tlv->table ? rows : 1);
+
+    if (bench_enabled(list, cnt, "get"))
+      bench_run("get", name, run_get, c, 1);
+    if (c->tlv->table && bench_enabled(list, cnt, "row"))
+      bench_run("row", name, run_row, c, 1);
+    if (c->tlv->table && bench_enabled(list, cnt, "block"))
+      bench_run("block", name, run_block, c, 1);
+    if (c->enc_len == 0) {
+      fprintf(stderr, "codec: %s has no encoding, codec cases skipped\n", name);
+      continue;
+    }
+    // Single TLVs are coded alike whatever the table size
+    if (first && c->msg && bench_enabled(list, cnt, "write"))
+      bench_run("write", name, run_write, c, 1);
+    if (first && bench_enabled(list, cnt, "readTL"))
+      bench_run("readTL", name, run_readTL, c, 1);
+    if (first && bench_enabled(list, cnt, "read"))
+      bench_run("read", name, run_read, c, 1);
+    if (bench_enabled(list, cnt, "find"))
+      bench_run("find", name, run_find, c, 1);
+  }
+}
+
+static void usage(const char *prog) {
+  fprintf(stderr, "usage: %s [-t ms] [-r rows[,rows...]] [varint|tlvid|get|row|block|write|readTL|read|find ...]\n", prog);
+  exit(1);
+}
+
+int main(int argc, char **argv) {
+  uint32_t rows[CODEC_ROWS_MAX] = {1, 16, 256};
+  uint32_t rows_cnt = 3, i;
+  char *tok, *save;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "t:r:")) != -1) {
+    switch (opt) {
+      case 't':
+        bench_target(strtoul(optarg, NULL, 10));
+        break;
+      case 'r':
+        rows_cnt = 0;
+        for (tok = strtok_r(optarg, ",", &save); tok && (rows_cnt < CODEC_ROWS_MAX);
+             tok = strtok_r(NULL, ",", &save))
+          rows[rows_cnt++] = strtoul(tok, NULL, 10);
+        if (rows_cnt == 0)
+          usage(argv[0]);
+        break;
+      default:
+        usage(argv[0]);
+    }
+  }
+
+  if (bench_enabled(argv + optind, argc - optind, "varint"))
+    bench_varint();
+  if (bench_enabled(argv + optind, argc - optind, "tlvid"))
+    bench_tlvid();
+  for (i = 0; i < rows_cnt; i++)
+    bench_tlvs(argv + optind, argc - optind, rows[i], i == 0);
+  return 0;
+}
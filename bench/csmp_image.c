@@ -0,0 +1,287 @@
+/*
+ *  Copyright 2021 Cisco Systems, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*
+ * Measures firmware image reception into the image slot and the cost of
+ * verifying the image hash once the final block is in.
+ *
+ *   sha256    sha256_update throughput over the image
+ *   inorder   blocks in order
+ *   lossy     blocks in order, 5% of them lost and resent in order
+ *   shuffled  blocks in random order
+ *   reverse   blocks from the last one down
+ *   atend     the image read back from the slot file and hashed
+ *
+ * Each order reports <order>/transfer, the whole transfer with the
+ * streaming hash, and <order>/final, storing the final block and
+ * verifying the image. atend/final is the hash-at-end alternative to
+ * the latter: storing the final block of an in-order transfer, then
+ * reading the image back and hashing it.
+ *
+ *   csmp_image [-n transfers] [-s size] [-b blocksize] [-f slot] [bench ...]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "imageslot.h"
+#include "sha256.h"
+#include "bench.h"
+
+enum {
+  IMAGE_TRANSFERS = 20,
+  IMAGE_SIZE = 250 * 1024 + 77,
+  IMAGE_BLOCK_SIZE = 512,
+  IMAGE_LOSS_PCT = 5
+};
+
+typedef struct {
+  const char *name;
+  uint32_t *order;  // blocks in sending order, resends included
+  uint32_t cnt;
+} image_order_t;
+
+static uint8_t *m_image[2];  // transfers alternate between two images
+static imageslot_info_t m_info[2];
+static uint32_t m_size = IMAGE_SIZE;
+static uint32_t m_bs = IMAGE_BLOCK_SIZE;
+static uint32_t m_blocks;
+static uint32_t m_transfers = IMAGE_TRANSFERS;
+static const char *m_slot = "/tmp/csmp_image.slot";
+
+static size_t run_sha256(void *arg) {
+  sha256_ctx_t ctx;
+  uint8_t digest[SHA256_DIGEST_SIZE];
+
+  (void) arg; // Suppress unused param compiler warning.
+  sha256_init(&ctx);
+  sha256_update(&ctx, m_image[0], m_size);
+  sha256_final(&ctx, digest);
+  return m_size;
+}
+
+static uint32_t block_len(uint32_t n) {
+  return (n == m_blocks - 1) ? m_size - n * m_bs : m_bs;
+}
+
+static void build_order(image_order_t *o, const char *name) {
+  uint32_t i, j, t, lost = 0;
+
+  o->name = name;
+  o->order = malloc(2 * m_blocks * sizeof(uint32_t));
+  o->cnt = m_blocks;
+  for (i = 0; i < m_blocks; i++)
+    o->order[i] = strcmp(name, "reverse") ? i : m_blocks - 1 - i;
+
+  if (strcmp(name, "shuffled") == 0) {
+    for (i = m_blocks - 1; i > 0; i--) {
+      j = rand() % (i + 1);
+      t = o->order[i]; o->order[i] = o->order[j]; o->order[j] = t;
+    }
+  }
+  else if (strcmp(name, "lossy") == 0) {
+    // Lost blocks stay in the first round, the slot drops nothing so
+    // they are moved to a second round
+    for (i = 0, j = 0; i < m_blocks; i++) {
+      if ((uint32_t)(rand() % 100) < IMAGE_LOSS_PCT)
+        o->order[m_blocks + lost++] = i;
+      else
+        o->order[j++] = i;
+    }
+    memmove(o->order + j, o->order + m_blocks, lost * sizeof(uint32_t));
+  }
+}
+
+/* write every block of an image but the final one, returns the ns spent */
+static uint64_t transfer(const image_order_t *o, uint32_t img) {
+  uint64_t start = bench_now();
+  uint32_t i, n;
+
+  if (imageslot_start(&m_info[img]) < 0) {
+    fprintf(stderr, "image: transfer start failed\n");
+    exit(1);
+  }
+  for (i = 0; i + 1 < o->cnt; i++) {
+    n = o->order[i];
+    imageslot_write(n, m_image[img] + n * m_bs, block_len(n));
+  }
+  return bench_now() - start;
+}
+
+static void bench_order(const image_order_t *o) {
+  bench_result_t all = {"image", NULL, 0, 0, 0, {0, 0, 0}};
+  bench_result_t final = {"image", NULL, 0, 0, 0, {0, 0, 0}};
+  char allname[64], finalname[64];
+  uint64_t start;
+  uint32_t r, n, img;
+
+  snprintf(allname, sizeof(allname), "%s/transfer", o->name);
+  snprintf(finalname, sizeof(finalname), "%s/final", o->name);
+  all.name = allname;
+  final.name = finalname;
+
+  bench_heap(&all.heap);
+  for (r = 0; r < m_transfers; r++) {
+    img = r & 1;
+    all.ns += transfer(o, img);
+
+    n = o->order[o->cnt - 1];
+    start = bench_now();
+    imageslot_write(n, m_image[img] + n * m_bs, block_len(n));
+    if (imageslot_verify() != 1) {
+      fprintf(stderr, "image: %s image hash not verified\n", o->name);
+      exit(1);
+    }
+    final.ns += bench_now() - start;
+  }
+  bench_heap_since(&all.heap);
+
+  all.ns += final.ns;
+  all.ops = final.ops = m_transfers;
+  all.bytes = (uint64_t)m_size * m_transfers;
+  bench_report(&all);
+  bench_report(&final);
+}
+
+static void bench_atend() {
+  bench_result_t res = {"image", "atend/final", 0, 0, 0, {0, 0, 0}};
+  image_order_t o;
+  uint8_t digest[SHA256_DIGEST_SIZE];
+  uint8_t *buf = malloc(m_bs);
+  sha256_ctx_t ctx;
+  uint64_t start;
+  uint32_t r, i, img;
+  int fd;
+
+  build_order(&o, "inorder");
+  bench_heap(&res.heap);
+  for (r = 0; r < m_transfers; r++) {
+    img = r & 1;
+    transfer(&o, img);
+
+    // Read back through the file, as the slot would be read from flash
+    start = bench_now();
+    imageslot_write(m_blocks - 1, m_image[img] + (m_blocks - 1) * m_bs, block_len(m_blocks - 1));
+    fd = open(m_slot, O_RDONLY);
+    sha256_init(&ctx);
+    for (i = 0; i < m_blocks; i++) {
+      if (pread(fd, buf, block_len(i), (off_t)i * m_bs) != (ssize_t)block_len(i)) {
+        fprintf(stderr, "image: slot read failed\n");
+        exit(1);
+      }
+      sha256_update(&ctx, buf, block_len(i));
+    }
+    sha256_final(&ctx, digest);
+    close(fd);
+    res.ns += bench_now() - start;
+    if (memcmp(digest, m_info[img].filehash, SHA256_DIGEST_SIZE)) {
+      fprintf(stderr, "image: read back image does not match\n");
+      exit(1);
+    }
+  }
+  bench_heap_since(&res.heap);
+
+  res.ops = m_transfers;
+  res.bytes = (uint64_t)m_size * m_transfers;
+  bench_report(&res);
+  free(buf);
+  free(o.order);
+}
+
+static bool bench_enabled(char **list, int cnt, const char *bench) {
+  int i;
+
+  if (cnt == 0)
+    return true;
+  for (i = 0; i < cnt; i++) {
+    if (strcmp(list[i], bench) == 0)
+      return true;
+  }
+  return false;
+}
+
+static void usage(const char *prog) {
+  fprintf(stderr, "usage: %s [-n transfers] [-s size] [-b blocksize] [-f slot] "
+          "[sha256|inorder|lossy|shuffled|reverse|atend ...]\n", prog);
+  exit(1);
+}
+
+int main(int argc, char **argv) {
+  static const char *orders[] = {"inorder", "lossy", "shuffled", "reverse"};
+  image_order_t o;
+  sha256_ctx_t ctx;
+  uint32_t i, k;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "n:s:b:f:")) != -1) {
+    switch (opt) {
+      case 'n':
+        m_transfers = strtoul(optarg, NULL, 10);
+        break;
+      case 's':
+        m_size = strtoul(optarg, NULL, 10);
+        break;
+      case 'b':
+        m_bs = strtoul(optarg, NULL, 10);
+        break;
+      case 'f':
+        m_slot = optarg;
+        break;
+      default:
+        usage(argv[0]);
+    }
+  }
+  if ((m_transfers == 0) || (m_size == 0) || (m_bs == 0))
+    usage(argv[0]);
+
+  srand(1);
+  m_blocks = (m_size - 1) / m_bs + 1;
+  for (k = 0; k < 2; k++) {
+    m_image[k] = malloc(m_size);
+    for (i = 0; i < m_size; i++)
+      m_image[k][i] = (uint8_t)rand();
+    m_info[k].filesize = m_size;
+    m_info[k].blocksize = m_bs;
+    m_info[k].hashlen = SHA256_DIGEST_SIZE;
+    sha256_init(&ctx);
+    sha256_update(&ctx, m_image[k], m_size);
+    sha256_final(&ctx, m_info[k].filehash);
+  }
+
+  if (bench_enabled(argv + optind, argc - optind, "sha256"))
+    bench_run("image", "sha256", run_sha256, NULL, 1);
+
+  if (imageslot_open(m_slot, m_size) < 0) {
+    fprintf(stderr, "image: unable to open %s\n", m_slot);
+    return 1;
+  }
+  for (k = 0; k < sizeof(orders) / sizeof(orders[0]); k++) {
+    if (!bench_enabled(argv + optind, argc - optind, orders[k]))
+      continue;
+    build_order(&o, orders[k]);
+    bench_order(&o);
+    free(o.order);
+  }
+  if (bench_enabled(argv + optind, argc - optind, "atend"))
+    bench_atend();
+
+  imageslot_close();
+  unlink(m_slot);
+  return 0;
+}
@@ -0,0 +1,542 @@
+/*
+ *  Copyright 2021 Cisco Systems, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*
+ * Measures GET and POST round trips to an agent over loopback.
+ *
+ * The agent is started in this process with the benchmark tables, or
+ * reached at -a (a running CsmpAgentLib_sample for instance), and a
+ * built-in CoAP client sends it requests on an open-loop schedule: the
+ * n-th request of a run is due at start + n / rate whether the earlier
+ * ones were answered or not, and its latency is counted from that due
+ * time. An agent falling behind thus shows in the percentiles instead
+ * of slowing the client down (coordinated omission).
+ *
+ *   get    GET /c/<tlv> of a single TLV (-g)
+ *   query  GET /c?q=<tlvs> of the TLVs the NMS polls after registration
+ *   post   signed POST /c of the current time
+ *
+ * Each case runs at the rates of -R, or without it doubles the rate
+ * until the agent falls behind and then bisects to the highest rate it
+ * sustains: every request answered with 2.xx and p99 within the SLO
+ * (-s). Every run is a JSON line, and each case ends with a line giving
+ * its sustainable rate.
+ *
+ * With -z the benchmark fails if the in-process agent calls its
+ * allocator hook after the first run.
+ *
+ *   csmp_loopback [-t ms] [-R rate[,rate...]] [-s slo_us] [-r rows] [-g tlv] [-a agent] [-z] [get|query|post ...]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+
+#include "coap.h"
+#include "csmp.h"
+#include "csmptlv.h"
+#include "csmpservice.h"
+#include "CsmpTlvs.pb-c.h"
+#include "bench.h"
+
+enum {
+  LOOP_RUN_MS = 1000,
+  LOOP_DRAIN_MS = 500,     // wait for late answers after the last request
+  LOOP_PAUSE_MS = 100,     // let the agent settle between runs
+  LOOP_SLO_US = 10000,
+  LOOP_ROWS = 2,
+  LOOP_RATE_START = 500,
+  LOOP_RATE_MAX = 1000000,
+  LOOP_BISECT_STEPS = 4,
+  LOOP_RATES_MAX = 16,
+  LOOP_SOCK_BUF = 4 * 1024 * 1024,
+  LOOP_MSG_MAX = 512,
+  LOOP_RECV_BUF = 1280,
+  LOOP_SPIN_NS = 50000,    // sleep until this close to a due time, then spin
+  LOOP_TOKEN_LEN = 8,      // run tag and sequence number
+  LOOP_SIG_LEN = 72,       // DER encoded ECDSA P-256 signature
+  LOOP_REG_MIN = 3600,
+  LOOP_REG_MAX = 7200
+};
+
+#define LOOP_QUERY "q=" HARDWARE_DESC_ID_STRING " " INTERFACE_DESC_ID_STRING " " \
+  IPADDRESS_ID_STRING " " IPROUTE_ID_STRING " " CURRENT_TIME_ID_STRING " " \
+  UPTIME_ID_STRING " " INTERFACE_METRICS_ID_STRING " " IPROUTE_RPLMETRICS_ID_STRING " " \
+  WPANSTATUS_ID_STRING " " RPLINSTANCE_ID_STRING " " FIRMWARE_IMAGE_INFO_ID_STRING
+
+typedef struct {
+  const char *name;
+  uint8_t msg[LOOP_MSG_MAX];
+  uint16_t len;
+} loop_case_t;
+
+typedef struct {
+  uint32_t tag;            // tags the requests of this run
+  uint32_t cnt;            // requests scheduled
+  uint64_t *done;          // answer time of each request, 0 while pending
+  uint32_t received;       // answers, updated by the receive thread
+  uint32_t errors;         // answers other than 2.xx
+  bool stop;
+} loop_run_t;
+
+typedef struct {
+  uint32_t lost;
+  uint32_t errors;
+  uint64_t p99;
+} loop_result_t;
+
+// CoAP option encoder, defined in coapclient.c
+int write_option(uint8_t *buf, uint16_t buf_len, coap_option_t this_option, coap_option_t *last_option,
+                 const uint8_t *option_buf, uint32_t option_len, uint32_t *written_len);
+
+static int m_sockfd = -1;
+static uint32_t m_tag;
+static uint32_t m_run_ms = LOOP_RUN_MS;
+static uint64_t m_slo_ns = LOOP_SLO_US * 1000ULL;
+static uint64_t m_hook_allocs = 0;
+static uint64_t m_warm_allocs = UINT64_MAX;  // hook calls at the end of the first run
+
+static loop_case_t m_cases[] = {
+  {"get", {0}, 0},
+  {"query", {0}, 0},
+  {"post", {0}, 0},
+};
+
+#define LOOP_CASE_CNT (sizeof(m_cases) / sizeof(m_cases[0]))
+
+/* CON request with a zeroed token, the options and an optional payload */
+static int build_request(loop_case_t *c, coap_method_t method, const char *path,
+                         const char *query, const uint8_t *body, uint32_t body_len) {
+  coap_header_t *hdr = (coap_header_t *)c->msg;
+  coap_option_t last = (coap_option_t)0;
+  uint32_t used = sizeof(coap_header_t) + LOOP_TOKEN_LEN, written;
+
+  memset(c->msg, 0, sizeof(c->msg));
+  hdr->control = (1 << 6) | (COAP_CON << 4) | LOOP_TOKEN_LEN;
+  hdr->code = method;
+
+  if (write_option(c->msg + used, sizeof(c->msg) - used, COAP_URI_PATH, &last,
+                   (const uint8_t *)"c", 1, &written) < 0)
+    return -1;
+  used += written;
+  if (path) {
+    if (write_option(c->msg + used, sizeof(c->msg) - used, COAP_URI_PATH, &last,
+                     (const uint8_t *)path, strlen(path), &written) < 0)
+      return -1;
+    used += written;
+  }
+  if (query) {
+    if (write_option(c->msg + used, sizeof(c->msg) - used, COAP_URI_QUERY, &last,
+                     (const uint8_t *)query, strlen(query), &written) < 0)
+      return -1;
+    used += written;
+  }
+  if (body_len) {
+    if (used + 1 + body_len > sizeof(c->msg))
+      return -1;
+    c->msg[used++] = COAP_PAYLOAD_MARKER;
+    memcpy(c->msg + used, body, body_len);
+    used += body_len;
+  }
+  c->len = used;
+  return 0;
+}
+
+/*
+ * The body an NMS sends: the signed TLVs between SignatureValidity and
+ * Signature. The signature is a placeholder of the size of an ECDSA
+ * P-256 one, checking it is up to the application's signature_verify.
+ */
+static uint32_t build_post_body(uint8_t *buf, size_t len) {
+  SignatureValidity validity = SIGNATURE_VALIDITY__INIT;
+  CurrentTime now = CURRENT_TIME__INIT;
+  Signature sig = SIGNATURE__INIT;
+  uint8_t sigval[LOOP_SIG_LEN] = {0};
+  tlvid_t tlvid = {0, 0};
+  uint32_t t = (uint32_t)time(NULL);
+  size_t used = 0, rv;
+
+  validity.not_before_present_case = SIGNATURE_VALIDITY__NOT_BEFORE_PRESENT_NOT_BEFORE;
+  validity.notbefore = t - 3600;
+  validity.not_after_present_case = SIGNATURE_VALIDITY__NOT_AFTER_PRESENT_NOT_AFTER;
+  validity.notafter = t + 86400;
+  tlvid.type = SIGNATURE_VALIDITY_TLVID;
+  rv = csmptlv_write(buf + used, len - used, tlvid, (ProtobufCMessage *)&validity);
+  if (rv == 0)
+    return 0;
+  used += rv;
+
+  now.posix_present_case = CURRENT_TIME__POSIX_PRESENT_POSIX;
+  now.posix = t;
+  tlvid.type = CURRENT_TIME_TLVID;
+  rv = csmptlv_write(buf + used, len - used, tlvid, (ProtobufCMessage *)&now);
+  if (rv == 0)
+    return 0;
+  used += rv;
+
+  sig.value_present_case = SIGNATURE__VALUE_PRESENT_VALUE;
+  sig.value.data = sigval;
+  sig.value.len = sizeof(sigval);
+  tlvid.type = SIGNATURE_TLVID;
+  rv = csmptlv_write(buf + used, len - used, tlvid, (ProtobufCMessage *)&sig);
+  if (rv == 0)
+    return 0;
+  return used + rv;
+}
+
+static int build_cases(const char *get_tlv) {
+  uint8_t body[LOOP_MSG_MAX];
+  uint32_t body_len;
+
+  if (build_request(&m_cases[0], COAP_GET, get_tlv, NULL, NULL, 0) < 0)
+    return -1;
+  if (build_request(&m_cases[1], COAP_GET, NULL, LOOP_QUERY, NULL, 0) < 0)
+    return -1;
+  body_len = build_post_body(body, sizeof(body));
+  if (body_len == 0)
+    return -1;
+  return build_request(&m_cases[2], COAP_POST, NULL, NULL, body, body_len);
+}
+
+static void *count_alloc(void *ctx, size_t size) {
+  (void)ctx; // Suppress unused param compiler warning.
+  __atomic_add_fetch(&m_hook_allocs, 1, __ATOMIC_RELAXED);
+  return malloc(size);
+}
+
+static void count_free(void *ctx, void *ptr) {
+  (void)ctx; // Suppress unused param compiler warning.
+  free(ptr);
+}
+
+static int open_client(const struct sockaddr_in6 *agent) {
+  struct sockaddr_in6 local = {0};
+  struct timeval tv = {0, 50000};
+  int buf = LOOP_SOCK_BUF;
+  int fd;
+
+  fd = socket(AF_INET6, SOCK_DGRAM, 0);
+  if (fd < 0)
+    return -1;
+  setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &buf, sizeof(buf));
+  setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &buf, sizeof(buf));
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+
+  local.sin6_family = AF_INET6;
+  local.sin6_addr = in6addr_loopback;
+  if (IN6_IS_ADDR_LOOPBACK(&agent->sin6_addr) &&
+      (bind(fd, (const struct sockaddr *)&local, sizeof(local)) < 0)) {
+    close(fd);
+    return -1;
+  }
+  if (connect(fd, (const struct sockaddr *)agent, sizeof(*agent)) < 0) {
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+static void *recv_thread(void *arg) {
+  loop_run_t *run = arg;
+  uint8_t data[LOOP_RECV_BUF];
+  uint32_t tag, seq;
+  ssize_t len;
+
+  while (!__atomic_load_n(&run->stop, __ATOMIC_ACQUIRE)) {
+    len = recv(m_sockfd, data, sizeof(data), 0);
+    if (len < (ssize_t)(sizeof(coap_header_t) + LOOP_TOKEN_LEN))
+      continue;
+    if ((data[0] & 0xf) != LOOP_TOKEN_LEN)
+      continue;
+    memcpy(&tag, data + sizeof(coap_header_t), sizeof(tag));
+    memcpy(&seq, data + sizeof(coap_header_t) + sizeof(tag), sizeof(seq));
+    // Answers to an earlier run or duplicates
+    if ((tag != run->tag) || (seq >= run->cnt) || run->done[seq])
+      continue;
+    run->done[seq] = bench_now();
+    if (COAP_RESPONSE_CLASS(data[1]) != 2)
+      run->errors++;
+    __atomic_add_fetch(&run->received, 1, __ATOMIC_RELEASE);
+  }
+  return NULL;
+}
+
+static void wait_until(uint64_t due) {
+  struct timespec ts;
+  uint64_t now;
+
+  while ((now = bench_now()) < due) {
+    if (due - now > LOOP_SPIN_NS) {
+      ts.tv_sec = 0;
+      ts.tv_nsec = due - now - LOOP_SPIN_NS;
+      nanosleep(&ts, NULL);
+    }
+  }
+}
+
+static int cmp_u64(const void *a, const void *b) {
+  uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+
+  return (x > y) - (x < y);
+}
+
+static uint64_t percentile(const uint64_t *sorted, uint32_t cnt, double p) {
+  uint32_t i = (uint32_t)(p * cnt + 0.999999);
+
+  if (cnt == 0)
+    return 0;
+  return sorted[(i ? i : 1) - 1];
+}
+
+/* one open-loop run of a case at a fixed rate */
+static int loop_run(loop_case_t *c, uint32_t rate, loop_result_t *res) {
+  loop_run_t run = {0};
+  pthread_t tid;
+  uint64_t *due, *lat, start, last = 0, deadline;
+  uint32_t i, n = 0, send_errors = 0;
+  uint8_t msg[LOOP_MSG_MAX];
+  coap_header_t *hdr = (coap_header_t *)msg;
+
+  run.tag = ++m_tag;
+  run.cnt = (uint32_t)((uint64_t)rate * m_run_ms / 1000);
+  if (run.cnt == 0)
+    run.cnt = 1;
+  due = calloc(run.cnt, sizeof(uint64_t));
+  lat = calloc(run.cnt, sizeof(uint64_t));
+  run.done = calloc(run.cnt, sizeof(uint64_t));
+  if (!due || !lat || !run.done) {
+    free(due);
+    free(lat);
+    free(run.done);
+    return -1;
+  }
+  memcpy(msg, c->msg, c->len);
+  memcpy(msg + sizeof(coap_header_t), &run.tag, sizeof(run.tag));
+
+  if (pthread_create(&tid, NULL, recv_thread, &run) != 0) {
+    free(due);
+    free(lat);
+    free(run.done);
+    return -1;
+  }
+
+  start = bench_now() + 1000000;
+  for (i = 0; i < run.cnt; i++) {
+    due[i] = start + (uint64_t)i * 1000000000ULL / rate;
+    wait_until(due[i]);
+    hdr->message_id = (uint16_t)i;
+    memcpy(msg + sizeof(coap_header_t) + sizeof(run.tag), &i, sizeof(i));
+    if (send(m_sockfd, msg, c->len, 0) < 0)
+      send_errors++;
+  }
+
+  deadline = bench_now() + LOOP_DRAIN_MS * 1000000ULL;
+  while ((__atomic_load_n(&run.received, __ATOMIC_ACQUIRE) + send_errors < run.cnt) &&
+         (bench_now() < deadline))
+    usleep(1000);
+  __atomic_store_n(&run.stop, true, __ATOMIC_RELEASE);
+  pthread_join(tid, NULL);
+  if (m_warm_allocs == UINT64_MAX)
+    m_warm_allocs = __atomic_load_n(&m_hook_allocs, __ATOMIC_RELAXED);
+
+  for (i = 0; i < run.cnt; i++) {
+    if (!run.done[i])
+      continue;
+    lat[n++] = run.done[i] - due[i];
+    if (run.done[i] > last)
+      last = run.done[i];
+  }
+  qsort(lat, n, sizeof(uint64_t), cmp_u64);
+
+  res->lost = run.cnt - n;
+  res->errors = run.errors;
+  res->p99 = percentile(lat, n, 0.99);
+  printf("{\"bench\":\"loopback\",\"name\":\"%s\",\"rate\":%u,\"sent\":%u,\"received\":%u,"
+         "\"lost\":%u,\"errors\":%u,\"achieved_per_sec\":%.0f,\"p50_us\":%.1f,"
+         "\"p99_us\":%.1f,\"p999_us\":%.1f,\"max_us\":%.1f}\n",
+         c->name, rate, run.cnt - send_errors, n, res->lost, res->errors,
+         (last > start) ? n * 1e9 / (last - start) : 0.0,
+         percentile(lat, n, 0.50) / 1e3, res->p99 / 1e3,
+         percentile(lat, n, 0.999) / 1e3, n ? lat[n - 1] / 1e3 : 0.0);
+  fflush(stdout);
+
+  free(due);
+  free(lat);
+  free(run.done);
+  usleep(LOOP_PAUSE_MS * 1000);
+  return 0;
+}
+
+static bool loop_sustained(loop_case_t *c, uint32_t rate) {
+  loop_result_t res;
+
+  if (loop_run(c, rate, &res) < 0)
+    return false;
+  return (res.lost == 0) && (res.errors == 0) && (res.p99 <= m_slo_ns);
+}
+
+static void loop_case(loop_case_t *c, const uint32_t *rates, uint32_t rate_cnt) {
+  uint32_t best = 0, bad = 0, rate, i;
+
+  if (rate_cnt) {
+    for (i = 0; i < rate_cnt; i++) {
+      if (loop_sustained(c, rates[i]) && (rates[i] > best))
+        best = rates[i];
+    }
+  }
+  else {
+    for (rate = LOOP_RATE_START; rate <= LOOP_RATE_MAX; rate *= 2) {
+      if (!loop_sustained(c, rate)) {
+        bad = rate;
+        break;
+      }
+      best = rate;
+    }
+    for (i = 0; bad && (i < LOOP_BISECT_STEPS); i++) {
+      rate = best + (bad - best) / 2;
+      if (rate <= best)
+        break;
+      if (loop_sustained(c, rate))
+        best = rate;
+      else
+        bad = rate;
+    }
+  }
+
+  printf("{\"bench\":\"loopback\",\"name\":\"%s\",\"max_sustainable_per_sec\":%u,"
+         "\"slo_p99_us\":%.1f}\n", c->name, best, m_slo_ns / 1e3);
+  fflush(stdout);
+}
+
+static void usage(const char *prog) {
+  fprintf(stderr, "usage: %s [-t ms] [-R rate[,rate...]] [-s slo_us] [-r rows] [-g tlv] "
+          "[-a agent] [-z] [-1] [get|query|post ...]\n", prog);
+  exit(1);
+}
+
+int main(int argc, char **argv) {
+  dev_config_t config = {0};
+  csmp_allocator_t allocator = {count_alloc, count_free, NULL};
+  struct sockaddr_in6 agent = {0};
+  const char *agent_addr = NULL, *get_tlv = HARDWARE_DESC_ID_STRING;
+  uint32_t rates[LOOP_RATES_MAX], rate_cnt = 0, rows = LOOP_ROWS, i;
+  csmp_handle_t *handle;
+  bool zero_malloc = false, single = false;
+  char *tok;
+  int opt, j, rv = 0;
+
+  while ((opt = getopt(argc, argv, "t:R:s:r:g:a:z1")) != -1) {
+    switch (opt) {
+      case 't':
+        m_run_ms = strtoul(optarg, NULL, 10);
+        break;
+      case 'R':
+        for (tok = strtok(optarg, ","); tok && (rate_cnt < LOOP_RATES_MAX); tok = strtok(NULL, ","))
+          rates[rate_cnt++] = strtoul(tok, NULL, 10);
+        break;
+      case 's':
+        m_slo_ns = strtoull(optarg, NULL, 10) * 1000ULL;
+        break;
+      case 'r':
+        rows = strtoul(optarg, NULL, 10);
+        break;
+      case 'g':
+        get_tlv = optarg;
+        break;
+      case 'a':
+        agent_addr = optarg;
+        break;
+      case 'z':
+        zero_malloc = true;
+        break;
+      case '1':
+        single = true;
+        break;
+      default:
+        usage(argv[0]);
+    }
+  }
+  if (m_run_ms == 0)
+    usage(argv[0]);
+  for (i = 0; i < rate_cnt; i++) {
+    if (rates[i] == 0)
+      usage(argv[0]);
+  }
+
+  agent.sin6_family = AF_INET6;
+  agent.sin6_port = htons(CSMP_DEFAULT_PORT);
+  agent.sin6_addr = in6addr_loopback;
+  if (agent_addr && (inet_pton(AF_INET6, agent_addr, &agent.sin6_addr) != 1))
+    usage(argv[0]);
+
+  if (build_cases(get_tlv) < 0) {
+    fprintf(stderr, "loopback: unable to build the requests\n");
+    return 1;
+  }
+
+  if (!agent_addr) {
+    // The NMS is never reached, only the agent's server is exercised
+    inet_pton(AF_INET6, "2001:db8::1", &config.NMSaddr);
+    memcpy(config.ieee_eui64.data, "\x0a\x00\x27\xff\xfe\x3b\x2a\xb2", 8);
+    config.reginterval_min = LOOP_REG_MIN;
+    config.reginterval_max = LOOP_REG_MAX;
+    config.sock_rcvbuf = LOOP_SOCK_BUF;
+    config.sock_sndbuf = LOOP_SOCK_BUF;
+    csmp_allocator_config(&allocator);
+    handle = bench_provider(rows);
+    if (single)
+      handle->csmptlvs_get_batch = NULL;
+    if (csmp_service_start(&config, handle) != 0) {
+      fprintf(stderr, "loopback: unable to start the CSMP service\n");
+      return 1;
+    }
+  }
+
+  m_sockfd = open_client(&agent);
+  if (m_sockfd < 0) {
+    fprintf(stderr, "loopback: unable to open the client socket: %s\n", strerror(errno));
+    return 1;
+  }
+
+  for (i = 0; i < LOOP_CASE_CNT; i++) {
+    if (optind < argc) {
+      for (j = optind; (j < argc) && strcmp(argv[j], m_cases[i].name); j++)
+        ;
+      if (j == argc)
+        continue;
+    }
+    loop_case(&m_cases[i], rates, rate_cnt);
+  }
+
+  close(m_sockfd);
+  if (!agent_addr)
+    csmp_service_stop();
+
+  if (zero_malloc && !agent_addr && (m_warm_allocs != UINT64_MAX) &&
+      (__atomic_load_n(&m_hook_allocs, __ATOMIC_RELAXED) > m_warm_allocs)) {
+    fprintf(stderr, "loopback: %llu allocations through the allocator hook after the first run\n",
+            (unsigned long long)(m_hook_allocs - m_warm_allocs));
+    rv = 1;
+  }
+  return rv;
+}
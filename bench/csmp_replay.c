@@ -0,0 +1,340 @@
+/*
+ *  Copyright 2021 Cisco Systems, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*
+ * Replays captured CSMP traffic through the agent's receive path.
+ *
+ * NMS requests to the agent (GET/POST below /c) are fed to the CoAP
+ * server's datagram parser and from there to the CSMP request handler,
+ * NMS responses to the agent's own requests to the CoAP client's
+ * response parser and the registration handler. The agent's side of
+ * the capture is left out. Each file is replayed -n times in a loop and
+ * reported as one JSON line.
+ *
+ * With -z the replay fails if the passes after the first allocate from
+ * the heap, either through the library's allocator hook or directly.
+ *
+ *   csmp_replay [-n passes] [-r rows] [-d nms] [-z] file.pcap ...
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <libgen.h>
+#include <arpa/inet.h>
+
+#include "coap.h"
+#include "csmpservice.h"
+#include "pcapreader.h"
+#include "bench.h"
+
+enum {
+  REPLAY_PASSES = 2000,
+  REPLAY_ROWS = 2,
+  REPLAY_PEER_PORT = 9,  // discard, answers to replayed requests go nowhere
+  REPLAY_AGENT_PORTS_MAX = 16,
+  REPLAY_RECV_BUF = 1024 // as the CoAP receive threads
+};
+
+typedef enum {
+  REPLAY_REQUEST,
+  REPLAY_RESPONSE
+} replay_kind_t;
+
+typedef struct {
+  replay_kind_t kind;
+  const uint8_t *data;
+  uint16_t len;
+} replay_msg_t;
+
+typedef struct {
+  pcap_reader_t rd;      // kept open, the messages point into the mapping
+  replay_msg_t *msg;
+  uint32_t cnt;
+  uint32_t requests;
+  uint32_t responses;
+  uint32_t skipped;
+  uint64_t bytes;
+} replay_set_t;
+
+// CoAP receive paths, defined in coapserver.c and coapclient.c
+void process_datagram(void *data, uint16_t len, struct sockaddr_in6 *from);
+void process_response(uint8_t *data, uint16_t len, struct sockaddr_in6 *from);
+
+static struct sockaddr_in6 m_peer;
+static struct sockaddr_in6 m_nms;
+static bool m_zero_malloc = false;
+static uint64_t m_hook_allocs = 0;
+
+static void *count_alloc(void *ctx, size_t size) {
+  (void)ctx; // Suppress unused param compiler warning.
+  __atomic_add_fetch(&m_hook_allocs, 1, __ATOMIC_RELAXED);
+  return malloc(size);
+}
+
+static void count_free(void *ctx, void *ptr) {
+  (void)ctx; // Suppress unused param compiler warning.
+  free(ptr);
+}
+
+/* first Uri-Path segment of a request, false if it has none */
+static bool first_path(const uint8_t *msg, uint16_t len, const uint8_t **seg, uint32_t *seglen) {
+  uint32_t off = sizeof(coap_header_t) + (msg[0] & 0xf);
+  uint32_t code = 0, delta, olen;
+
+  while ((off < len) && (msg[off] != COAP_PAYLOAD_MARKER)) {
+    delta = msg[off] >> 4;
+    olen = msg[off] & 0xf;
+    off++;
+    if (off + ((delta == 14) ? 2 : (delta == 13)) + ((olen == 14) ? 2 : (olen == 13)) > len)
+      return false;
+    if (delta == 13)
+      delta = msg[off++] + 13;
+    else if (delta == 14) {
+      delta = (msg[off] << 8 | msg[off + 1]) + 269;
+      off += 2;
+    }
+    if (olen == 13)
+      olen = msg[off++] + 13;
+    else if (olen == 14) {
+      olen = (msg[off] << 8 | msg[off + 1]) + 269;
+      off += 2;
+    }
+    code += delta;
+    if (off + olen > len)
+      return false;
+    if (code == COAP_URI_PATH) {
+      *seg = msg + off;
+      *seglen = olen;
+      return true;
+    }
+    if (code > COAP_URI_PATH)
+      return false;
+    off += olen;
+  }
+  return false;
+}
+
+static bool port_listed(const uint16_t *ports, uint32_t cnt, uint16_t port) {
+  uint32_t i;
+
+  for (i = 0; i < cnt; i++) {
+    if (ports[i] == port)
+      return true;
+  }
+  return false;
+}
+
+static void replay_free(replay_set_t *set) {
+  pcap_close(&set->rd);
+  free(set->msg);
+  set->msg = NULL;
+}
+
+/*
+ * Requests below /c are the NMS talking to the agent. Any other request
+ * comes from the agent's client port, and the responses sent back to
+ * that port are the NMS answering the agent.
+ */
+static int replay_load(const char *path, replay_set_t *set) {
+  uint16_t agent_ports[REPLAY_AGENT_PORTS_MAX];
+  uint32_t agent_port_cnt = 0, cap = 0, seglen;
+  const uint8_t *seg;
+  pcap_udp_t udp;
+  replay_msg_t *msg;
+  uint8_t code;
+
+  memset(set, 0, sizeof(*set));
+  if (pcap_open(&set->rd, path) < 0)
+    return -1;
+
+  while (pcap_next_udp(&set->rd, &udp)) {
+    if ((udp.src.sin6_port != htons(CSMP_DEFAULT_PORT)) &&
+        (udp.dst.sin6_port != htons(CSMP_DEFAULT_PORT)))
+      continue;
+    if ((udp.len < sizeof(coap_header_t)) || (udp.len > REPLAY_RECV_BUF)) {
+      set->skipped++;
+      continue;
+    }
+
+    code = udp.payload[1];
+    if ((code >> 5) == 0) {
+      if (code == 0) {
+        set->skipped++;
+        continue;
+      }
+      if (!first_path(udp.payload, udp.len, &seg, &seglen) || (seglen != 1) || (seg[0] != 'c')) {
+        if (!port_listed(agent_ports, agent_port_cnt, udp.src.sin6_port) &&
+            (agent_port_cnt < REPLAY_AGENT_PORTS_MAX))
+          agent_ports[agent_port_cnt++] = udp.src.sin6_port;
+        set->skipped++;
+        continue;
+      }
+    }
+    else if (!port_listed(agent_ports, agent_port_cnt, udp.dst.sin6_port)) {
+      set->skipped++;
+      continue;
+    }
+
+    if (set->cnt == cap) {
+      cap = cap ? cap * 2 : 64;
+      msg = realloc(set->msg, cap * sizeof(replay_msg_t));
+      if (!msg) {
+        replay_free(set);
+        return -1;
+      }
+      set->msg = msg;
+    }
+    msg = &set->msg[set->cnt++];
+    msg->kind = ((code >> 5) == 0) ? REPLAY_REQUEST : REPLAY_RESPONSE;
+    if (msg->kind == REPLAY_REQUEST)
+      set->requests++;
+    else
+      set->responses++;
+    msg->data = udp.payload;
+    msg->len = udp.len;
+    set->bytes += udp.len;
+  }
+  return 0;
+}
+
+static void replay_pass(const replay_set_t *set) {
+  uint8_t data[REPLAY_RECV_BUF];
+  struct sockaddr_in6 from;
+  const replay_msg_t *msg;
+  uint32_t i;
+
+  for (i = 0; i < set->cnt; i++) {
+    msg = &set->msg[i];
+    // As the receive threads hand over a datagram
+    memcpy(data, msg->data, msg->len);
+    if (msg->kind == REPLAY_REQUEST) {
+      from = m_peer;
+      process_datagram(data, msg->len, &from);
+    }
+    else {
+      from = m_nms;
+      process_response(data, msg->len, &from);
+    }
+  }
+}
+
+static int replay_file(const char *path, uint32_t passes) {
+  char name[256];
+  replay_set_t set;
+  bench_result_t res = {0};
+  uint64_t start, hook_allocs;
+  uint32_t i;
+  int rv = 0;
+
+  if (replay_load(path, &set) < 0)
+    return -1;
+  fprintf(stderr, "replay: %s: %u requests, %u responses, %u skipped\n",
+          path, set.requests, set.responses, set.skipped);
+  if (set.cnt == 0) {
+    replay_free(&set);
+    return 0;
+  }
+
+  replay_pass(&set);
+
+  snprintf(name, sizeof(name), "%s", path);
+  res.bench = "replay";
+  res.name = basename(name);
+  hook_allocs = __atomic_load_n(&m_hook_allocs, __ATOMIC_RELAXED);
+  bench_heap(&res.heap);
+  start = bench_now();
+  for (i = 0; i < passes; i++)
+    replay_pass(&set);
+  res.ns = bench_now() - start;
+  bench_heap_since(&res.heap);
+  hook_allocs = __atomic_load_n(&m_hook_allocs, __ATOMIC_RELAXED) - hook_allocs;
+  res.ops = (uint64_t)set.cnt * passes;
+  res.bytes = set.bytes * passes;
+  bench_report(&res);
+
+  if (m_zero_malloc && (res.heap.allocs || hook_allocs)) {
+    fprintf(stderr, "replay: %s: %llu heap allocations, %llu through the allocator hook\n",
+            path, (unsigned long long)res.heap.allocs, (unsigned long long)hook_allocs);
+    rv = -1;
+  }
+
+  replay_free(&set);
+  return rv;
+}
+
+static void usage(const char *prog) {
+  fprintf(stderr, "usage: %s [-n passes] [-r rows] [-d nms] [-z] file.pcap ...\n", prog);
+  exit(1);
+}
+
+int main(int argc, char **argv) {
+  dev_config_t config = {0};
+  csmp_allocator_t allocator = {count_alloc, count_free, NULL};
+  const char *nms = "2001:db8::1";
+  uint32_t passes = REPLAY_PASSES, rows = REPLAY_ROWS;
+  int opt, rv = 0;
+
+  while ((opt = getopt(argc, argv, "n:r:d:z")) != -1) {
+    switch (opt) {
+      case 'n':
+        passes = strtoul(optarg, NULL, 10);
+        break;
+      case 'r':
+        rows = strtoul(optarg, NULL, 10);
+        break;
+      case 'd':
+        nms = optarg;
+        break;
+      case 'z':
+        m_zero_malloc = true;
+        break;
+      default:
+        usage(argv[0]);
+    }
+  }
+  if (optind >= argc)
+    usage(argv[0]);
+
+  // The NMS is never reached, registration is driven by the replayed responses
+  if (inet_pton(AF_INET6, nms, &config.NMSaddr) != 1)
+    usage(argv[0]);
+  memcpy(config.ieee_eui64.data, "\x0a\x00\x27\xff\xfe\x3b\x2a\xb2", 8);
+  config.reginterval_min = 3600;
+  config.reginterval_max = 7200;
+
+  m_nms.sin6_family = AF_INET6;
+  m_nms.sin6_addr = config.NMSaddr;
+  m_nms.sin6_port = htons(CSMP_DEFAULT_PORT);
+  m_peer.sin6_family = AF_INET6;
+  m_peer.sin6_addr = in6addr_loopback;
+  m_peer.sin6_port = htons(REPLAY_PEER_PORT);
+
+  csmp_allocator_config(&allocator);
+  if (csmp_service_start(&config, bench_provider(rows)) != 0) {
+    fprintf(stderr, "replay: unable to start the CSMP service\n");
+    return 1;
+  }
+
+  for (; optind < argc; optind++) {
+    if (replay_file(argv[optind], passes) < 0)
+      rv = 1;
+  }
+
+  csmp_service_stop();
+  return rv;
+}
@@ -0,0 +1,193 @@
+/*
+ *  Copyright 2021 Cisco Systems, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "pcapreader.h"
+
+enum {
+  PCAP_MAGIC_US = 0xa1b2c3d4,
+  PCAP_MAGIC_NS = 0xa1b23c4d,
+  PCAP_HDR_LEN = 24,
+  PCAP_REC_LEN = 16,
+
+  LINKTYPE_ETHERNET = 1,
+  LINKTYPE_RAW = 101,
+  LINKTYPE_LINUX_SLL = 113,
+  LINKTYPE_IPV6 = 229,
+
+  ETHERTYPE_VLAN = 0x8100,
+  ETHERTYPE_IPV6 = 0x86dd,
+
+  IPV6_HDR_LEN = 40,
+  UDP_HDR_LEN = 8,
+  NH_HOPOPTS = 0,
+  NH_UDP = 17,
+  NH_ROUTING = 43,
+  NH_DSTOPTS = 60
+};
+
+static uint32_t rd32(const pcap_reader_t *rd, const uint8_t *p) {
+  uint32_t v;
+
+  memcpy(&v, p, sizeof(v));
+  return rd->swapped ? __builtin_bswap32(v) : v;
+}
+
+static uint16_t be16(const uint8_t *p) {
+  return (uint16_t)(p[0] << 8 | p[1]);
+}
+
+int pcap_open(pcap_reader_t *rd, const char *path) {
+  struct stat st;
+  uint32_t magic;
+  void *map;
+
+  memset(rd, 0, sizeof(*rd));
+  rd->fd = open(path, O_RDONLY);
+  if (rd->fd < 0) {
+    fprintf(stderr, "pcap: open %s failed: %s\n", path, strerror(errno));
+    return -1;
+  }
+  if ((fstat(rd->fd, &st) < 0) || (st.st_size < PCAP_HDR_LEN)) {
+    fprintf(stderr, "pcap: %s is too short\n", path);
+    goto fail;
+  }
+
+  map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, rd->fd, 0);
+  if (map == MAP_FAILED) {
+    fprintf(stderr, "pcap: mmap %s failed: %s\n", path, strerror(errno));
+    goto fail;
+  }
+  // Records are read front to back once
+  madvise(map, st.st_size, MADV_SEQUENTIAL);
+  rd->map = map;
+  rd->len = st.st_size;
+
+  memcpy(&magic, rd->map, sizeof(magic));
+  if ((magic != PCAP_MAGIC_US) && (magic != PCAP_MAGIC_NS)) {
+    magic = __builtin_bswap32(magic);
+    if ((magic != PCAP_MAGIC_US) && (magic != PCAP_MAGIC_NS)) {
+      fprintf(stderr, "pcap: %s is not a pcap file\n", path);
+      pcap_close(rd);
+      return -1;
+    }
+    rd->swapped = true;
+  }
+  rd->linktype = rd32(rd, rd->map + 20);
+  rd->off = PCAP_HDR_LEN;
+  return 0;
+
+fail:
+  close(rd->fd);
+  rd->fd = -1;
+  return -1;
+}
+
+void pcap_close(pcap_reader_t *rd) {
+  if (rd->map)
+    munmap((void *)rd->map, rd->len);
+  if (rd->fd >= 0)
+    close(rd->fd);
+  rd->map = NULL;
+  rd->fd = -1;
+}
+
+/* offset of the IPv6 header in a frame, -1 if the frame carries something else */
+static int32_t ipv6_offset(uint32_t linktype, const uint8_t *pkt, uint32_t len) {
+  uint32_t off;
+
+  switch (linktype) {
+    case LINKTYPE_ETHERNET:
+      off = 12;
+      if ((len >= off + 2) && (be16(pkt + off) == ETHERTYPE_VLAN))
+        off += 4;
+      if ((len < off + 2) || (be16(pkt + off) != ETHERTYPE_IPV6))
+        return -1;
+      return off + 2;
+    case LINKTYPE_LINUX_SLL:
+      if ((len < 16) || (be16(pkt + 14) != ETHERTYPE_IPV6))
+        return -1;
+      return 16;
+    case LINKTYPE_RAW:
+    case LINKTYPE_IPV6:
+      return 0;
+    default:
+      return -1;
+  }
+}
+
+static bool decode_udp(uint32_t linktype, const uint8_t *pkt, uint32_t len, pcap_udp_t *udp) {
+  int32_t off = ipv6_offset(linktype, pkt, len);
+  const uint8_t *ip;
+  uint32_t nh, ulen;
+
+  if ((off < 0) || (len < (uint32_t)off + IPV6_HDR_LEN))
+    return false;
+  ip = pkt + off;
+  if ((ip[0] >> 4) != 6)
+    return false;
+
+  nh = ip[6];
+  off += IPV6_HDR_LEN;
+  while ((nh == NH_HOPOPTS) || (nh == NH_ROUTING) || (nh == NH_DSTOPTS)) {
+    if (len < (uint32_t)off + 2)
+      return false;
+    nh = pkt[off];
+    off += (pkt[off + 1] + 1) * 8;
+  }
+  if ((nh != NH_UDP) || (len < (uint32_t)off + UDP_HDR_LEN))
+    return false;
+
+  ulen = be16(pkt + off + 4);
+  if ((ulen < UDP_HDR_LEN) || (len < (uint32_t)off + ulen))
+    return false;
+
+  memset(udp, 0, sizeof(*udp));
+  udp->src.sin6_family = AF_INET6;
+  memcpy(&udp->src.sin6_addr, ip + 8, 16);
+  udp->src.sin6_port = htons(be16(pkt + off));
+  udp->dst.sin6_family = AF_INET6;
+  memcpy(&udp->dst.sin6_addr, ip + 24, 16);
+  udp->dst.sin6_port = htons(be16(pkt + off + 2));
+  udp->payload = pkt + off + UDP_HDR_LEN;
+  udp->len = ulen - UDP_HDR_LEN;
+  return true;
+}
+
+bool pcap_next_udp(pcap_reader_t *rd, pcap_udp_t *udp) {
+  const uint8_t *rec;
+  uint32_t incl, orig;
+
+  while (rd->off + PCAP_REC_LEN <= rd->len) {
+    rec = rd->map + rd->off;
+    incl = rd32(rd, rec + 8);
+    orig = rd32(rd, rec + 12);
+    if (incl > rd->len - rd->off - PCAP_REC_LEN)
+      break;
+    rd->off += PCAP_REC_LEN + incl;
+
+    if ((incl == orig) && decode_udp(rd->linktype, rec + PCAP_REC_LEN, incl, udp))
+      return true;
+  }
+  return false;
+}
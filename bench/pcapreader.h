@@ -0,0 +1,81 @@
+/*
+ *  Copyright 2021 Cisco Systems, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef _PCAPREADER_H
+#define _PCAPREADER_H
+
+/*! \file
+ *
+ * Pcap file reader
+ *
+ * Walks the records of a classic pcap file (either byte order,
+ * microsecond or nanosecond timestamps) in a read-only mapping, so
+ * records are handed out in place without copying. Only the IPv6/UDP
+ * datagrams of Ethernet, raw IP and Linux cooked captures are decoded.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <netinet/in.h>
+
+/** \brief an open capture */
+typedef struct {
+  int fd;
+  const uint8_t *map;
+  size_t len;
+  size_t off;        /**< next record */
+  bool swapped;      /**< file byte order differs from the host */
+  uint32_t linktype;
+} pcap_reader_t;
+
+/** \brief a UDP datagram found in a record, pointing into the mapping */
+typedef struct {
+  struct sockaddr_in6 src;
+  struct sockaddr_in6 dst;
+  const uint8_t *payload;
+  uint16_t len;
+} pcap_udp_t;
+
+/**
+ * @brief map a capture file
+ *
+ * @param rd the reader
+ * @param path the file
+ * @return int 0 on success, -1 if the file is missing or not a pcap
+ */
+int pcap_open(pcap_reader_t *rd, const char *path);
+
+/**
+ * @brief unmap a capture file
+ *
+ * @param rd the reader
+ */
+void pcap_close(pcap_reader_t *rd);
+
+/**
+ * @brief next IPv6/UDP datagram of the capture
+ *
+ * Records holding anything else, or cut short by the snap length,
+ * are skipped.
+ *
+ * @param rd the reader
+ * @param udp filled with the datagram
+ * @return bool false at the end of the file
+ */
+bool pcap_next_udp(pcap_reader_t *rd, pcap_udp_t *udp);
+
+#endif
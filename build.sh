@@ -6,6 +6,7 @@ TOPDIR=`pwd`
 ###set PATH only used in this script
 DESTDIR=$TOPDIR
 SAMPLEDIR=$TOPDIR/sample
+BENCHDIR=$TOPDIR/bench
 TLVPROTODIR=$TOPDIR/src/csmpagent/tlvs
 
 build_header()
@@ -19,6 +20,11 @@ build_sample()
   make -C $SAMPLEDIR
 }
 
+build_bench()
+{
+  make -C $BENCHDIR
+}
+
 build_lib()
 {
   make -C $DESTDIR
@@ -30,12 +36,19 @@ clean_all()
 {
   make clean -C $DESTDIR
   make clean -C $SAMPLEDIR
+  make clean -C $BENCHDIR
 #  make clean -C $TLVPROTODIR
 }
 
 if [ "$1"x = "clean"x ];then
   echo "########## start cleaning...##########"
   clean_all;
+elif [ "$1"x = "bench"x ];then
+  echo "########## start building benchmarks...##########"
+  clean_all;
+  build_lib;
+  build_sample;
+  build_bench;
 else
   echo "########## start building...##########"
   clean_all;
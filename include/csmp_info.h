@@ -52,7 +52,11 @@ typedef struct _Up_time Up_Time;                       /**< data related to TLV
 typedef struct _Interface_Metrics Interface_Metrics;   /**< data related to TLV 23 */
 typedef struct _IPRoute_RPLMetrics IPRoute_RPLMetrics; /**< data related to TLV 25 */
 typedef struct _WPAN_Status WPAN_Status;               /**< data related to TLV 35 */
+typedef struct _Neighbor_802154G Neighbor_802154G;     /**< data related to TLV 52 */
 typedef struct _RPL_Instance RPL_Instance;             /**< data related to TLV 53 */
+typedef struct _Load_Request Load_Request;             /**< data related to TLV 68 */
+typedef struct _Cancel_Load_Request Cancel_Load_Request; /**< data related to TLV 69 */
+typedef struct _Set_Backup_Request Set_Backup_Request; /**< data related to TLV 70 */
 typedef struct _Firmware_Image_Info Firmware_Image_Info; /**< data related to TLV 75 */
 
 // HARDWARE_DESC
@@ -395,6 +399,31 @@ struct  _WPAN_Status
  { 0,0, 0,{0,{0}}, 0,0, 0,0, 0,0, 0,0, 0,0, 0,0, 0,0, 0,0, 0,0, 0,0, 0,0, 0,0, 0,0, 0,0 }
 
 
+// NEIGHBOR
+struct  _Neighbor_802154G
+{
+  bool has_nbrindex;/* 'Y' */
+  int32_t nbrindex;/* 'Y' */
+  bool has_physaddress;/* 'Y' */
+  struct {
+    size_t len;
+    uint8_t data[8];
+  } physaddress;/* 'Y' */
+  bool has_lastchanged;
+  uint32_t lastchanged;
+  bool has_rssiforward;/* 'Y' */
+  int32_t rssiforward;/* 'Y' */
+  bool has_rssireverse;/* 'Y' */
+  int32_t rssireverse;/* 'Y' */
+  bool has_lqiforward;
+  uint32_t lqiforward;
+  bool has_lqireverse;
+  uint32_t lqireverse;
+};
+#define NEIGHBOR802154_G_INIT \
+ { 0,0, 0,{0,{0}}, 0,0, 0,0, 0,0, 0,0, 0,0 }
+
+
 // RPL_INSTANCE
 struct  _RPL_Instance
 {
@@ -458,4 +487,45 @@ struct  _Firmware_Image_Info
 };
 #define FIRMWARE_IMAGE_INFO_INIT \
    { 0,0, 0,{0,{0}}, 0,{0}, 0,{0}, 0,0, 0,0, 0,{0,{0}}, 0,0, 0,0, 0,0, 0,{0,{0}, 0,{0}} }
+
+
+// LOAD_REQUEST
+struct  _Load_Request
+{
+  bool has_filehash;/* 'Y' */
+  struct {
+    size_t len;
+    uint8_t data[32];
+  } filehash;/* 'Y' */
+  bool has_loadtime;
+  uint32_t loadtime;
+};
+#define LOAD_REQUEST_INIT \
+ { 0,{0,{0}}, 0,0 }
+
+
+// CANCEL_LOAD_REQUEST
+struct  _Cancel_Load_Request
+{
+  bool has_filehash;/* 'Y' */
+  struct {
+    size_t len;
+    uint8_t data[32];
+  } filehash;/* 'Y' */
+};
+#define CANCEL_LOAD_REQUEST_INIT \
+ { 0,{0,{0}} }
+
+
+// SET_BACKUP_REQUEST
+struct  _Set_Backup_Request
+{
+  bool has_filehash;/* 'Y' */
+  struct {
+    size_t len;
+    uint8_t data[32];
+  } filehash;/* 'Y' */
+};
+#define SET_BACKUP_REQUEST_INIT \
+ { 0,{0,{0}} }
 #endif
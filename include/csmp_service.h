@@ -44,7 +44,11 @@ typedef enum {
   INTERFACE_METRICS_ID = 23, /**< interface metrics request */
   IPROUTE_RPLMETRICS_ID = 25, /**< rpl metrics request */
   WPANSTATUS_ID = 35, /**< wpan status request */
+  NEIGHBOR802154_G_ID = 52, /**< 802.15.4g neighbor table request */
   RPLINSTANCE_ID = 53, /**< rpl instance info request */
+  LOAD_REQUEST_ID = 68, /**< firmware load request */
+  CANCEL_LOAD_REQUEST_ID = 69, /**< firmware load cancel request */
+  SET_BACKUP_REQUEST_ID = 70, /**< firmware backup request */
   FIRMWARE_IMAGE_INFO_ID = 75 /**< firmware info request */
 } tlv_type_t;
 
@@ -59,6 +63,19 @@ typedef struct _dev_config {
   } ieee_eui64;          /**< the device’s eui64, should be the same with the EID that imported on NMS*/
   uint32_t reginterval_min;  /**< the minimum interval to send register message to NMS*/
   uint32_t reginterval_max;  /**< the maximum interval to send register message to NMS*/
+  uint32_t report_refresh;  /**< report only changed TLVs, with a full report every report_refresh periods (0 disables)*/
+  const char *report_queue_path;  /**< file keeping reports while the NMS is unreachable (NULL disables)*/
+  uint32_t report_queue_size;  /**< size in bytes of the report queue*/
+  uint32_t report_queue_rate;  /**< queued reports replayed per second once registered again (0 means 1)*/
+  bool outage_recovery;  /**< the device is starting after a power outage*/
+  uint32_t reg_storm_window;  /**< after an outage, spread the first registration over this many seconds (0 disables)*/
+  const struct in6_addr *NMSaddr_failover;  /**< NMS addresses to fail over to, in order (NULL if none)*/
+  uint32_t NMSaddr_failover_cnt;  /**< number of addresses in NMSaddr_failover*/
+  uint32_t sock_rcvbuf;  /**< CoAP socket receive buffer in bytes (0 keeps the system default)*/
+  uint32_t sock_sndbuf;  /**< CoAP socket send buffer in bytes (0 keeps the system default)*/
+  const char *metrics_socket_path;  /**< Unix socket serving OpenMetrics text (NULL disables)*/
+  const char *image_slot_path;  /**< file receiving firmware images from the NMS (NULL disables)*/
+  uint32_t image_slot_size;  /**< largest firmware image in bytes*/
 } dev_config_t;
 
 /**
@@ -70,6 +87,118 @@ typedef struct _tlvid {
   uint32_t type;   /**< type identification */
 } tlvid_t;
 
+/**
+ * @brief event identifier
+ *
+ */
+typedef struct _eventid {
+  uint32_t vendor; /**< vendor identification */
+  uint32_t code;   /**< event code */
+} eventid_t;
+
+/**
+ * @brief TLV reported with an event
+ *
+ */
+typedef struct {
+  tlvid_t id;     /**< TLV identification */
+  int32_t index;  /**< TLV index, -1 for all entries */
+} csmp_event_tlvlist_t;
+
+/**
+ * @brief event priority
+ *
+ */
+typedef enum {
+  CSMP_EVENT_PRIORITY_INVALID = 0,  /**< invalid */
+  CSMP_EVENT_PRIORITY_LOW = 1,      /**< batched, rate limited */
+  CSMP_EVENT_PRIORITY_MEDIUM = 2,   /**< batched, rate limited */
+  CSMP_EVENT_PRIORITY_HIGH = 3      /**< sent at once as a confirmable message */
+} csmp_event_priority_t;
+
+/**
+ * @brief event statistics
+ *
+ */
+typedef struct {
+  uint32_t trigger_low;  /**< low priority events raised */
+  uint32_t trigger_med;  /**< medium priority events raised */
+  uint32_t trigger_high; /**< high priority events raised */
+  uint32_t sent;         /**< events sent to the NMS */
+  uint32_t bad_priority; /**< events raised with an invalid priority */
+  uint32_t coalesced;    /**< repeats merged into an earlier report of the same event and TLVs */
+  uint32_t dropped;      /**< queue full or message too large */
+  uint32_t acked;        /**< high priority events the NMS acknowledged */
+  uint32_t rejected;     /**< high priority events the NMS answered with an error */
+} csmp_event_stats_t;
+
+/**
+ * @brief NMS endpoint health
+ *
+ */
+typedef struct {
+  struct in6_addr addr;  /**< NMS address */
+  uint16_t port;  /**< NMS port */
+  bool active;  /**< the endpoint the agent registers with */
+  uint32_t srtt;  /**< smoothed round trip time (ms), 0 until measured */
+  uint32_t fails;  /**< consecutive failed or unanswered requests */
+  uint32_t failovers;  /**< times the agent failed over away from this endpoint */
+} csmp_nms_endpoint_t;
+
+/**
+ * @brief log levels
+ *
+ */
+typedef enum {
+  CSMP_LOG_ERROR = 0,  /**< errors */
+  CSMP_LOG_WARN = 1,   /**< warnings */
+  CSMP_LOG_INFO = 2,   /**< informational */
+  CSMP_LOG_DEBUG = 3   /**< debug traces */
+} csmp_log_level_t;
+
+/**
+ * @brief log subsystems, bits of the subsystem mask
+ *
+ */
+typedef enum {
+  CSMP_LOG_COAP = 0x01,     /**< CoAP client and server */
+  CSMP_LOG_AGENT = 0x02,    /**< TLV handlers */
+  CSMP_LOG_SERVICE = 0x04,  /**< registration, reports, events and the CSMP server */
+  CSMP_LOG_API = 0x08,      /**< public API */
+  CSMP_LOG_TLV = 0x10,      /**< TLV encoding */
+  CSMP_LOG_LIB = 0x20,      /**< timers and other helpers */
+  CSMP_LOG_ALL = 0x3F       /**< every subsystem */
+} csmp_log_subsys_t;
+
+/**
+ * @brief latency histogram kinds
+ *
+ */
+typedef enum {
+  CSMP_LATENCY_REQUEST = 0,        /**< CSMP server request handling, keyed by CoAP method */
+  CSMP_LATENCY_HANDLER_GET = 1,    /**< TLV GET handler, keyed by TLV type */
+  CSMP_LATENCY_HANDLER_POST = 2,   /**< TLV POST handler, keyed by TLV type */
+  CSMP_LATENCY_PROVIDER_GET = 3,   /**< application GET callback, keyed by TLV type */
+  CSMP_LATENCY_PROVIDER_POST = 4,  /**< application POST callback, keyed by TLV type */
+  CSMP_LATENCY_SIGNATURE = 5,      /**< signature check */
+  CSMP_LATENCY_RESPONSE = 6,       /**< sending a CoAP response */
+  CSMP_LATENCY_PROVIDER_BATCH = 7, /**< application batched GET callback */
+  CSMP_LATENCY_KIND_CNT = 8        /**< number of kinds */
+} csmp_latency_kind_t;
+
+/**
+ * @brief latency summary of one histogram
+ *
+ */
+typedef struct {
+  csmp_latency_kind_t kind;  /**< what was timed */
+  uint32_t key;  /**< TLV type or CoAP method, see csmp_latency_kind_t */
+  uint32_t count;  /**< samples */
+  uint32_t p50;  /**< median (us) */
+  uint32_t p99;  /**< 99th percentile (us) */
+  uint32_t max;  /**< longest sample (us) */
+} csmp_latency_stats_t;
+
 /**
  * @brief GET function definition
  *
@@ -78,6 +207,20 @@ typedef struct _tlvid {
  */
 typedef void* (* csmptlvs_get_t)(tlvid_t tlvid, uint32_t *num);
 
+/**
+ * @brief table GET function definition
+ *
+ * Reads part of a table TLV, so a request for a few rows costs work in
+ * proportion to the rows returned rather than to the table.
+ *
+ * @param tlvid the URL being called
+ * @param first the first row wanted, counted from 0
+ * @param max the most rows wanted
+ * @param num set to the rows returned, 0 past the end of the table
+ * @return void* the first row returned, NULL if none
+ */
+typedef void* (* csmptlvs_get_rows_t)(tlvid_t tlvid, uint32_t first, uint32_t max, uint32_t *num);
+
 /**
  * @brief POST function definition
  *
@@ -86,6 +229,30 @@ typedef void* (* csmptlvs_get_t)(tlvid_t tlvid, uint32_t *num);
  */
 typedef void (* csmptlvs_post_t)(tlvid_t tlvid, void *tlv);
 
+/**
+ * @brief one TLV of a batched GET
+ *
+ */
+typedef struct {
+  tlvid_t tlvid;  /**< the TLV to read */
+  void *data;     /**< storage for an array of the TLV's data structure */
+  uint32_t max;   /**< instances that fit in data */
+  uint32_t num;   /**< set to the instances written, 0 if not available, above max if they did not fit */
+} csmp_tlv_slot_t;
+
+/**
+ * @brief batched GET function definition
+ *
+ * Copies every TLV of a request into the slots at once, so that the
+ * values sent together are consistent with each other. A TLV whose num
+ * is set above max is read again with the GET function.
+ *
+ * @param slots the TLVs to read
+ * @param cnt number of slots
+ * @return uint32_t generation of the data, changed whenever the data changes
+ */
+typedef uint32_t (* csmptlvs_get_batch_t)(csmp_tlv_slot_t *slots, uint32_t cnt);
+
 /**
  * @brief signature verification function definition
  *
@@ -104,8 +271,20 @@ typedef struct _csmp_handle {
   csmptlvs_get_t csmptlvs_get;   /**< GET function */
   csmptlvs_post_t csmptlvs_post;  /**< POST function */
   signature_verify_t signature_verify; /**< signature check function */
+  csmptlvs_get_batch_t csmptlvs_get_batch; /**< batched GET function (NULL reads TLVs one by one) */
+  csmptlvs_get_rows_t csmptlvs_get_rows; /**< table GET function (NULL reads whole tables with the GET function) */
 } csmp_handle_t;
 
+/**
+ * @brief heap allocator of the library
+ *
+ */
+typedef struct {
+  void *(*alloc)(void *ctx, size_t size);  /**< allocate size bytes, NULL on failure */
+  void (*free)(void *ctx, void *ptr);  /**< release a block from alloc */
+  void *ctx;  /**< passed to alloc and free */
+} csmp_allocator_t;
+
 /**
  * @brief service status
  *
@@ -128,10 +307,32 @@ typedef struct {
     uint32_t error_signature; /**< signature check failure */
     uint32_t error_process; /**< overall error */
   } reg_fails_stats; /**< failure stats */
+  uint32_t reg_holds; /**< registrations held to spread the load on the NMS */
+  uint32_t nms_failovers; /**< failovers to the next NMS endpoint */
+  uint32_t nms_redirects; /**< redirects to another NMS */
+  uint32_t reg_rtt; /**< smoothed registration round trip time (ms) */
+  uint32_t reg_rtt_max; /**< longest registration round trip time (ms) */
+  uint32_t reg_retransmits; /**< registrations resent while the previous one was unanswered */
   uint32_t metrics_reports; /**< metric reports */
+  uint32_t metrics_tlvs_suppressed; /**< unchanged TLVs left out of delta reports */
+  uint32_t metrics_reports_queued; /**< reports queued while the NMS was unreachable */
+  uint32_t metrics_reports_replayed; /**< queued reports sent to the NMS */
+  uint32_t metrics_reports_dropped; /**< queued reports dropped because the queue was full */
+  uint32_t metrics_report_latency; /**< smoothed time to encode and send a report (us) */
+  uint32_t metrics_report_latency_max; /**< longest time to encode and send a report (us) */
 
   uint32_t csmp_get_succeed; /**< CoAP GET successfull */
   uint32_t csmp_post_succeed;/**< CoAP POST successfull */
+  uint32_t csmp_outbuf_overflows; /**< POST responses that overflowed the response buffer */
+
+  uint32_t coap_rx_errors; /**< failed CoAP socket receives */
+  uint32_t coap_rx_truncated; /**< datagrams larger than the receive buffer, dropped */
+  uint32_t coap_rx_malformed; /**< datagrams that did not parse as CoAP */
+  uint32_t coap_rx_kernel_drops; /**< datagrams dropped by the kernel because the socket queue was full */
+  uint32_t coap_tx_errors; /**< failed CoAP sends */
+  uint32_t log_dropped; /**< debug log messages dropped because the log rings were full */
+  uint32_t tlv_heap_allocs; /**< decoded TLVs that did not fit the decode arena and used the heap */
+  uint32_t latency_dropped; /**< latency samples not recorded because every histogram was in use */
 
   uint32_t sig_ok; /**< signature status */
   uint32_t sig_no_signature; /**< no signature needed */
@@ -139,6 +340,17 @@ typedef struct {
   uint32_t sig_bad_validity; /**< signature failure on time check */
 } csmp_service_stats_t;
 
+/**
+ * @brief what the counters of a statistics snapshot count from
+ *
+ * Smoothed values and maxima are reported as they are in every mode.
+ */
+typedef enum {
+  CSMP_STATS_TOTAL = 0,  /**< since the service started or the last reset */
+  CSMP_STATS_DELTA = 1,  /**< since the previous delta or reset snapshot */
+  CSMP_STATS_RESET = 2   /**< since the last reset, then count from zero again */
+} csmp_stats_mode_t;
+
 /**
  * @brief start the csmp server
  *
@@ -167,10 +379,136 @@ csmp_service_status_t csmp_service_status();
 /**
  * @brief retrieve the service statistics
  *
+ * Deprecated, use csmp_service_stats_snapshot(). Kept for compatibility,
+ * returns a total snapshot in a copy private to the calling thread, valid
+ * until that thread calls it again.
+ *
  * @return csmp_service_stats_t*
  */
 csmp_service_stats_t* csmp_service_stats();
 
+/**
+ * @brief take a consistent snapshot of the service statistics
+ *
+ * Lock-free for the threads that update the counters, safe to call from
+ * any thread at any rate. Counters survive csmp_service_stop() and are
+ * cleared by csmp_service_start().
+ *
+ * @param out filled with the statistics
+ * @param mode total, delta since the previous delta snapshot, or total then reset
+ * @return int 0 on success, -1 if out is NULL
+ */
+int csmp_service_stats_snapshot(csmp_service_stats_t *out, csmp_stats_mode_t mode);
+
+/**
+ * @brief tell the service that TLV data has changed
+ *
+ * The registration message is encoded once and kept. The current time,
+ * IP routes, interface and RPL route metrics, WPAN status and RPL
+ * instance are requested again from the application on every attempt.
+ * The device id, hardware and interface descriptions, IP addresses and
+ * firmware image info are requested again when invalidated here, or
+ * once they are older than REG_CACHE_MAX_AGE (5 minutes by default).
+ *
+ * The application calls it whenever the data returned for one of those
+ * TLVs changes, so that the next registration carries it at once. GETs
+ * and reports always read the current data. Safe to call from any
+ * thread, callbacks included.
+ *
+ * @param type the changed TLV, 0 for all of them
+ */
+void csmp_service_invalidate(tlv_type_t type);
+
+/**
+ * @brief raise an event to be reported to the NMS
+ *
+ * May be called from any thread. High priority events are sent at once,
+ * low and medium priority events are batched and rate limited. Events
+ * raised before registration completes are held until it does.
+ *
+ * @param eventid the event
+ * @param priority event priority
+ * @param tlvlist TLVs to report with the event, may be NULL
+ * @param tlvcnt number of TLVs in tlvlist (at most 4)
+ * @return int 0 on success, -1 on bad arguments or full queue
+ */
+int csmp_event_raise(eventid_t eventid, csmp_event_priority_t priority,
+                     const csmp_event_tlvlist_t *tlvlist, uint32_t tlvcnt);
+
+/**
+ * @brief copy the event statistics
+ *
+ * Each counter is read atomically, safe to call from any thread at any
+ * rate. Counters are cleared by csmp_service_start().
+ *
+ * @param out filled with the statistics
+ * @return int 0 on success, -1 if out is NULL
+ */
+int csmp_event_stats_snapshot(csmp_event_stats_t *out);
+
+/**
+ * @brief retrieve the health of the NMS endpoints
+ *
+ * The configured NMS is listed first, followed by its failover
+ * endpoints and the last NMS the agent was redirected to.
+ *
+ * @param list filled with up to cnt endpoints
+ * @param cnt size of list
+ * @return int number of endpoints written to list, -1 if the service is not started
+ */
+int csmp_nms_endpoints(csmp_nms_endpoint_t *list, uint32_t cnt);
+
+/**
+ * @brief retrieve latency summaries
+ *
+ * One summary per timed kind and key: request handling per CoAP method,
+ * TLV handlers and application callbacks per TLV type, signature checks
+ * and response sending.
+ *
+ * @param list filled with up to cnt summaries
+ * @param cnt size of list
+ * @return int number of summaries written to list, -1 if the service is not started
+ */
+int csmp_latency_snapshot(csmp_latency_stats_t *list, uint32_t cnt);
+
+/**
+ * @brief render the statistics as OpenMetrics text
+ *
+ * Service, event and CoAP drop counters and the latency summaries, taken
+ * from snapshots without allocating. Use it to serve metrics from an
+ * application event loop instead of the metrics_socket_path exporter.
+ *
+ * @param buf filled with the text, NUL terminated
+ * @param size size of buf
+ * @return int length of the text, -1 if the service is not started or the text does not fit
+ */
+int csmp_metrics_render(char *buf, uint32_t size);
+
+/**
+ * @brief set the log filters
+ *
+ * Messages above level or outside the subsystem mask are skipped at the
+ * call site. Debug messages are only built into libraries built with
+ * PRINTDEBUG, the others always are. Until this is called only errors
+ * are logged, or everything in PRINTDEBUG builds.
+ *
+ * @param level highest level logged
+ * @param subsys mask of csmp_log_subsys_t subsystems logged
+ */
+void csmp_log_config(csmp_log_level_t level, uint32_t subsys);
+
+/**
+ * @brief set the heap allocator
+ *
+ * The library decodes TLVs into a per-thread arena and keeps everything
+ * else in static storage, so once started it only calls the allocator
+ * for TLVs too large for the arena, counted in tlv_heap_allocs. Set it
+ * before csmp_service_start().
+ *
+ * @param allocator the allocator, NULL for malloc and free
+ */
+void csmp_allocator_config(const csmp_allocator_t *allocator);
+
 /**
  * @brief stop the csmp service
  *
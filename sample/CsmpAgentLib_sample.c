@@ -22,6 +22,7 @@
 #include <string.h>
 #include <ifaddrs.h>
 #include <unistd.h>
+#include <pthread.h>
 
 #include "csmp_service.h"
 #include "csmp_info.h"
@@ -36,7 +37,12 @@ uint32_t g_init_time;
 uint8_t neighbor_eui64[2][8] = {{0x0a, 0x00, 0x27, 0xff, 0xfe, 0x3b, 0x2a, 0xb1},
                              {0x0a, 0x00, 0x27, 0xff, 0xfe, 0x3b, 0x2a, 0xb0}};
 dev_config_t g_devconfig;
+struct in6_addr g_nms_failover[nms_failover_max_num];
 csmp_handle_t g_csmp_handle;
+pthread_mutex_t g_tlv_lock = PTHREAD_MUTEX_INITIALIZER;
+uint32_t g_tlv_generation;
+uint32_t g_lowpan_inoctets;
+uint32_t g_lowpan_outoctets;
 
 /**
  * @brief hardware description function
@@ -220,6 +226,38 @@ void currenttime_post(Current_Time *tlv) {
   }
 }
 
+/**
+ * @brief load a firmware image
+ *
+ * The image received from the NMS is the start of the -image file,
+ * the library already checked a SHA-256 fileHash. A device would check
+ * its signature and boot into it at loadtime.
+ *
+ * @param tlv
+ */
+void load_request_post(Load_Request *tlv) {
+  printf("load request: %u byte hash, load time %u\n",
+         (unsigned)tlv->filehash.len, tlv->has_loadtime ? tlv->loadtime : 0);
+}
+
+/**
+ * @brief cancel a scheduled firmware load
+ *
+ * @param tlv
+ */
+void cancel_load_request_post(Cancel_Load_Request *tlv) {
+  printf("cancel load request: %u byte hash\n", (unsigned)tlv->filehash.len);
+}
+
+/**
+ * @brief keep a firmware image as the backup image
+ *
+ * @param tlv
+ */
+void set_backup_request_post(Set_Backup_Request *tlv) {
+  printf("set backup request: %u byte hash\n", (unsigned)tlv->filehash.len);
+}
+
 /**
  * @brief Get the uptime
  *
@@ -245,13 +283,8 @@ void* uptime_get(uint32_t *num) {
  * @return void* pointer to global g_interfaceMetrics
  */
 void* interface_metrics_get(uint32_t *num) {
-  static int outnum = 0;
-  static int innum = 0;
   int i;
 
-  outnum += 1320;
-  innum += 610;
-
   *num = 2;
   for(i=0;i<2;i++) {
     g_interfaceMetrics[i].has_ifindex = true;
@@ -280,8 +313,8 @@ void* interface_metrics_get(uint32_t *num) {
   g_interfaceMetrics[1].ifadminstatus = IF_ADMIN_STATUS_UP;
   g_interfaceMetrics[1].ifoperstatus = IF_OPER_STATUS_UP_INSECURE;
   g_interfaceMetrics[1].iflastchange = 10;
-  g_interfaceMetrics[1].ifinoctets = outnum;
-  g_interfaceMetrics[1].ifoutoctets = innum;
+  g_interfaceMetrics[1].ifinoctets = g_lowpan_inoctets;
+  g_interfaceMetrics[1].ifoutoctets = g_lowpan_outoctets;
   g_interfaceMetrics[1].ifindiscards = 23;
   g_interfaceMetrics[1].ifinerrors = 0;
   g_interfaceMetrics[1].ifoutdiscards = 0;
@@ -368,6 +401,39 @@ void* wpanstatus_get(uint32_t *num) {
   return &g_wpanStatus;
 }
 
+/**
+ * @brief 802.15.4g neighbor table
+ *
+ * @param num amount of instances of g_neighbor802154G
+ * @return void* pointer to global g_neighbor802154G
+ */
+void* neighbor802154g_get(uint32_t *num) {
+  uint8_t physaddress[8] = {0x00, 0x17, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00};
+  uint32_t i;
+
+  *num = neighbor_max_num;
+  for (i = 0; i < neighbor_max_num; i++) {
+    g_neighbor802154G[i].has_nbrindex = true;
+    g_neighbor802154G[i].has_physaddress = true;
+    g_neighbor802154G[i].has_lastchanged = true;
+    g_neighbor802154G[i].has_rssiforward = true;
+    g_neighbor802154G[i].has_rssireverse = true;
+    g_neighbor802154G[i].has_lqiforward = true;
+    g_neighbor802154G[i].has_lqireverse = true;
+
+    g_neighbor802154G[i].nbrindex = i + 1;
+    physaddress[7] = i + 1;
+    g_neighbor802154G[i].physaddress.len = sizeof(physaddress);
+    memcpy(g_neighbor802154G[i].physaddress.data, physaddress, sizeof(physaddress));
+    g_neighbor802154G[i].lastchanged = 0;
+    g_neighbor802154G[i].rssiforward = -69 - 4 * i;
+    g_neighbor802154G[i].rssireverse = -59 - 4 * i;
+    g_neighbor802154G[i].lqiforward = 60;
+    g_neighbor802154G[i].lqireverse = 8;
+  }
+  return &g_neighbor802154G;
+}
+
 /**
  * @brief RPL instance information
  *
@@ -432,13 +498,13 @@ void* firmware_image_info_get(uint32_t *num) {
 }
 
 /**
- * @brief csmp get TLV request
+ * @brief refresh the global variable of a TLV, with g_tlv_lock held
  *
  * @param tlvid the tlvid to handle
  * @param num returned amount of instances
  * @return void* pointer to the global variable containing the return data
  */
-void* csmptlvs_get(tlvid_t tlvid, uint32_t *num) {
+static void* tlv_get(tlvid_t tlvid, uint32_t *num) {
   switch(tlvid.type) {
     case HARDWARE_DESC_ID:
       return hardware_desc_get(num);
@@ -467,6 +533,9 @@ void* csmptlvs_get(tlvid_t tlvid, uint32_t *num) {
     case WPANSTATUS_ID:
       return wpanstatus_get(num);
       break;
+    case NEIGHBOR802154_G_ID:
+      return neighbor802154g_get(num);
+      break;
     case RPLINSTANCE_ID:
       return rplinstance_get(num);
       break;
@@ -480,6 +549,75 @@ void* csmptlvs_get(tlvid_t tlvid, uint32_t *num) {
   return NULL;
 }
 
+/**
+ * @brief size of the data of a TLV
+ *
+ * @param type the TLV type
+ * @return size_t size of one instance, 0 if unknown
+ */
+static size_t tlv_size(uint32_t type) {
+  switch(type) {
+    case HARDWARE_DESC_ID: return sizeof(Hardware_Desc);
+    case INTERFACE_DESC_ID: return sizeof(Interface_Desc);
+    case IPADDRESS_ID: return sizeof(IP_Address);
+    case IPROUTE_ID: return sizeof(IP_Route);
+    case CURRENT_TIME_ID: return sizeof(Current_Time);
+    case UPTIME_ID: return sizeof(Up_Time);
+    case INTERFACE_METRICS_ID: return sizeof(Interface_Metrics);
+    case IPROUTE_RPLMETRICS_ID: return sizeof(IPRoute_RPLMetrics);
+    case WPANSTATUS_ID: return sizeof(WPAN_Status);
+    case NEIGHBOR802154_G_ID: return sizeof(Neighbor_802154G);
+    case RPLINSTANCE_ID: return sizeof(RPL_Instance);
+    case FIRMWARE_IMAGE_INFO_ID: return sizeof(Firmware_Image_Info);
+    default: return 0;
+  }
+}
+
+/**
+ * @brief csmp get TLV request
+ *
+ * @param tlvid the tlvid to handle
+ * @param num returned amount of instances
+ * @return void* pointer to the global variable containing the return data
+ */
+void* csmptlvs_get(tlvid_t tlvid, uint32_t *num) {
+  void *tlv;
+
+  pthread_mutex_lock(&g_tlv_lock);
+  tlv = tlv_get(tlvid, num);
+  pthread_mutex_unlock(&g_tlv_lock);
+  return tlv;
+}
+
+/**
+ * @brief csmp batched get TLV request
+ *
+ * Copies all requested TLVs under one lock, so they are consistent.
+ *
+ * @param slots the TLVs to copy
+ * @param cnt number of slots
+ * @return uint32_t generation of the global variables
+ */
+uint32_t csmptlvs_get_batch(csmp_tlv_slot_t *slots, uint32_t cnt) {
+  uint32_t i, num, gen;
+  void *tlv;
+
+  pthread_mutex_lock(&g_tlv_lock);
+  for (i = 0; i < cnt; i++) {
+    num = 0;
+    tlv = tlv_get(slots[i].tlvid, &num);
+    if (tlv == NULL)
+      num = 0;
+    if (num <= slots[i].max)
+      memcpy(slots[i].data, tlv, num * tlv_size(slots[i].tlvid.type));
+    slots[i].num = num;
+  }
+  // The getters refresh the variables on every read
+  gen = ++g_tlv_generation;
+  pthread_mutex_unlock(&g_tlv_lock);
+  return gen;
+}
+
 /**
  * @brief csmp post TLV request
  *
@@ -487,13 +625,24 @@ void* csmptlvs_get(tlvid_t tlvid, uint32_t *num) {
  * @param tlv the request data
  */
 void csmptlvs_post(tlvid_t tlvid, void *tlv) {
+  pthread_mutex_lock(&g_tlv_lock);
   switch(tlvid.type) {
     case CURRENT_TIME_ID:
       currenttime_post((Current_Time*)tlv);
       break;
+    case LOAD_REQUEST_ID:
+      load_request_post((Load_Request*)tlv);
+      break;
+    case CANCEL_LOAD_REQUEST_ID:
+      cancel_load_request_post((Cancel_Load_Request*)tlv);
+      break;
+    case SET_BACKUP_REQUEST_ID:
+      set_backup_request_post((Set_Backup_Request*)tlv);
+      break;
     default:
       break;
   }
+  pthread_mutex_unlock(&g_tlv_lock);
 }
 
 int8_t char2hex(char ch) {
@@ -537,17 +686,34 @@ int str2addr(char *str, uint8_t *addr) {
           [-min reginterval_min]
           [-max reginterval_max]
           [-eid ieee_eui64]
+          [-refresh report_refresh]
+          [-queue report_queue_path]
+          [-outage reg_storm_window]
+          [-f failover_NMS_ipv6_address]...
+          [-rcvbuf socket_receive_buffer]
+          [-sndbuf socket_send_buffer]
+          [-metrics metrics_socket_path]
+          [-image image_slot_path]
 ***************************************************************/
 int main(int argc, char **argv)
 {
   struct timeval tv = {0};
   csmp_service_status_t status;
-  csmp_service_stats_t *stats_ptr;
+  csmp_service_stats_t stats, delta, *stats_ptr = &stats;
+  csmp_event_stats_t event_stats, *event_stats_ptr = &event_stats;
+  csmp_nms_endpoint_t endpoints[nms_failover_max_num + 2];
+  csmp_latency_stats_t latency[latency_max_num];
+  char *latency_kind[] = {"request", "get", "post", "provider get", "provider post",
+                          "signature", "response", "provider batch"};
+  char addr_str[INET6_ADDRSTRLEN];
+  eventid_t event_registered = {0, sample_event_registered};
+  csmp_event_tlvlist_t event_tlvs[] = {{{0, UPTIME_ID}, -1}};
+  bool event_raised = false;
   char *status_msg[] = {"CSMP service is not started\n",
                        "Failed to start CSMP service\n",
                        "Registration is in progress...\n",
                        "Regist to the NMS successfully\n"};
-  int ret, i;
+  int ret, i, cnt;
   char *endptr;
 
   gettimeofday(&tv, NULL);
@@ -586,6 +752,55 @@ int main(int argc, char **argv)
         goto start_error;
       if (*endptr != '\0')
         goto start_error;
+    } else if (strcmp(argv[i], "-refresh") == 0) {   // delta report refresh
+      if (++i >= argc)
+        goto start_error;
+      g_devconfig.report_refresh = strtol(argv[i], &endptr, 0);
+      if (*endptr != '\0')
+        goto start_error;
+    } else if (strcmp(argv[i], "-queue") == 0) {   // offline report queue file
+      if (++i >= argc)
+        goto start_error;
+      g_devconfig.report_queue_path = argv[i];
+      g_devconfig.report_queue_size = report_queue_len;
+    } else if (strcmp(argv[i], "-outage") == 0) {   // starting after a power outage
+      if (++i >= argc)
+        goto start_error;
+      g_devconfig.outage_recovery = true;
+      g_devconfig.reg_storm_window = strtol(argv[i], &endptr, 0);
+      if (*endptr != '\0')
+        goto start_error;
+    } else if (strcmp(argv[i], "-rcvbuf") == 0) {   // CoAP socket receive buffer
+      if (++i >= argc)
+        goto start_error;
+      g_devconfig.sock_rcvbuf = strtol(argv[i], &endptr, 0);
+      if (*endptr != '\0')
+        goto start_error;
+    } else if (strcmp(argv[i], "-sndbuf") == 0) {   // CoAP socket send buffer
+      if (++i >= argc)
+        goto start_error;
+      g_devconfig.sock_sndbuf = strtol(argv[i], &endptr, 0);
+      if (*endptr != '\0')
+        goto start_error;
+    } else if (strcmp(argv[i], "-metrics") == 0) {   // OpenMetrics exporter socket
+      if (++i >= argc)
+        goto start_error;
+      g_devconfig.metrics_socket_path = argv[i];
+    } else if (strcmp(argv[i], "-image") == 0) {   // firmware image slot file
+      if (++i >= argc)
+        goto start_error;
+      g_devconfig.image_slot_path = argv[i];
+      g_devconfig.image_slot_size = image_slot_len;
+    } else if (strcmp(argv[i], "-f") == 0) {  // failover NMS address
+      if ((++i >= argc) || (g_devconfig.NMSaddr_failover_cnt >= nms_failover_max_num))
+        goto start_error;
+      if (inet_pton(AF_INET6, argv[i],
+                    &g_nms_failover[g_devconfig.NMSaddr_failover_cnt].s6_addr) <= 0) {
+        printf("NMS address in presentation format\n");
+        goto start_error;
+      }
+      g_devconfig.NMSaddr_failover = g_nms_failover;
+      g_devconfig.NMSaddr_failover_cnt++;
     } else if (strcmp(argv[i], "-d") == 0) {  // NMS address
       if (++i >= argc)
         goto start_error;
@@ -608,10 +823,12 @@ int main(int argc, char **argv)
   /*************************************************************
     init the csmp_handle parameter of csmp_service_start func:
       * callback function for the GET TLV request
+      * callback function for the batched GET TLV request
       * callback function for the POST TLV request
       * callback function for the signature verification
   **************************************************************/
   g_csmp_handle.csmptlvs_get = (csmptlvs_get_t)csmptlvs_get;
+  g_csmp_handle.csmptlvs_get_batch = (csmptlvs_get_batch_t)csmptlvs_get_batch;
   g_csmp_handle.csmptlvs_post = (csmptlvs_post_t)csmptlvs_post;
   g_csmp_handle.signature_verify = (signature_verify_t)signature_verify;
 
@@ -629,18 +846,71 @@ int main(int argc, char **argv)
     status = csmp_service_status();
     printf("%s\n",status_msg[status]);
 
+    // traffic on the lowpan interface, interface metrics are sent with
+    // the registration so the library is told they changed
+    pthread_mutex_lock(&g_tlv_lock);
+    g_lowpan_inoctets += 1320;
+    g_lowpan_outoctets += 610;
+    pthread_mutex_unlock(&g_tlv_lock);
+    csmp_service_invalidate(INTERFACE_METRICS_ID);
+
+    // raise an event the first time the device is registered
+    if (status == REGISTRATION_SUCCESS && !event_raised) {
+      csmp_event_raise(event_registered, CSMP_EVENT_PRIORITY_HIGH, event_tlvs, 1);
+      event_raised = true;
+    }
+
     // get the stats of CSMP agent service
-    stats_ptr = csmp_service_stats();
+    csmp_service_stats_snapshot(&stats, CSMP_STATS_TOTAL);
+    csmp_service_stats_snapshot(&delta, CSMP_STATS_DELTA);
     printf("-------------- CSMP service stats --------------\n");
-    printf(" reg_succeed: %d\n reg_attempts: %d\n reg_fails: %d\n\
+    printf(" reg_succeed: %d\n reg_attempts: %d\n reg_fails: %d\n reg_holds: %d\n nms_failovers: %d\n nms_redirects: %d\n\
+ reg_rtt: %dms\n reg_rtt_max: %dms\n reg_retransmits: %d\n\
         \n *** reg_fail reason ***\n  error_coap: %d\n  error_signature: %d\n  error_process: %d\n\
-        \n metrics_reports: %d\n csmp_get_succeed: %d\n csmp_post_succeed: %d\n\
+        \n metrics_reports: %d\n metrics_tlvs_suppressed: %d\n\
+        \n metrics_reports_queued: %d\n metrics_reports_replayed: %d\n metrics_reports_dropped: %d\n\
+ metrics_report_latency: %dus\n metrics_report_latency_max: %dus\n csmp_get_succeed: %d\n csmp_post_succeed: %d\n\
         \n sig_ok: %d\n sig_no_signature: %d\n sig_bad_auth: %d\n sig_bad_validity: %d\n",\
-        stats_ptr->reg_succeed,stats_ptr->reg_attempts,stats_ptr->reg_fails,\
+        stats_ptr->reg_succeed,stats_ptr->reg_attempts,stats_ptr->reg_fails,stats_ptr->reg_holds,\
+        stats_ptr->nms_failovers,stats_ptr->nms_redirects,\
+        stats_ptr->reg_rtt,stats_ptr->reg_rtt_max,stats_ptr->reg_retransmits,\
         stats_ptr->reg_fails_stats.error_coap,stats_ptr->reg_fails_stats.error_signature,\
         stats_ptr->reg_fails_stats.error_process,stats_ptr->metrics_reports,\
-        stats_ptr->csmp_get_succeed,stats_ptr->csmp_post_succeed,stats_ptr->sig_ok,\
+        stats_ptr->metrics_tlvs_suppressed,stats_ptr->metrics_reports_queued,\
+        stats_ptr->metrics_reports_replayed,stats_ptr->metrics_reports_dropped,\
+        stats_ptr->metrics_report_latency,stats_ptr->metrics_report_latency_max,stats_ptr->csmp_get_succeed,stats_ptr->csmp_post_succeed,stats_ptr->sig_ok,\
         stats_ptr->sig_no_signature,stats_ptr->sig_bad_auth,stats_ptr->sig_bad_validity);
+    printf(" csmp_outbuf_overflows: %d\n coap_rx_errors: %d\n coap_rx_truncated: %d\n coap_rx_malformed: %d\n\
+ coap_rx_kernel_drops: %d\n coap_tx_errors: %d\n log_dropped: %d\n tlv_heap_allocs: %d\n latency_dropped: %d\n",
+        stats_ptr->csmp_outbuf_overflows,stats_ptr->coap_rx_errors,stats_ptr->coap_rx_truncated,
+        stats_ptr->coap_rx_malformed,stats_ptr->coap_rx_kernel_drops,stats_ptr->coap_tx_errors,
+        stats_ptr->log_dropped,stats_ptr->tlv_heap_allocs,stats_ptr->latency_dropped);
+    printf(" since last print: metrics_reports: %d csmp_get_succeed: %d csmp_post_succeed: %d\n",
+        delta.metrics_reports,delta.csmp_get_succeed,delta.csmp_post_succeed);
+
+    // get the event stats
+    csmp_event_stats_snapshot(&event_stats);
+    printf(" event trigger_low: %d\n event trigger_med: %d\n event trigger_high: %d\n\
+ event sent: %d\n event coalesced: %d\n event dropped: %d\n",\
+        event_stats_ptr->trigger_low,event_stats_ptr->trigger_med,event_stats_ptr->trigger_high,\
+        event_stats_ptr->sent,event_stats_ptr->coalesced,event_stats_ptr->dropped);
+
+    // get the NMS endpoints
+    cnt = csmp_nms_endpoints(endpoints, sizeof(endpoints)/sizeof(endpoints[0]));
+    for (i = 0; i < cnt; i++) {
+      inet_ntop(AF_INET6, &endpoints[i].addr, addr_str, sizeof(addr_str));
+      printf(" NMS [%s]:%u%s srtt: %ums fails: %u failovers: %u\n", addr_str, endpoints[i].port,
+             endpoints[i].active ? " (active)" : "", endpoints[i].srtt, endpoints[i].fails,
+             endpoints[i].failovers);
+    }
+
+    // get the latency summaries
+    cnt = csmp_latency_snapshot(latency, latency_max_num);
+    for (i = 0; i < cnt; i++) {
+      printf(" latency %s %u: count %u p50 %uus p99 %uus max %uus\n",
+             latency_kind[latency[i].kind], latency[i].key, latency[i].count,
+             latency[i].p50, latency[i].p99, latency[i].max);
+    }
     printf("---------------------- end --------------------\n");
   }
 
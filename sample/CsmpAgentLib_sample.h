@@ -80,6 +80,7 @@
  *
  * The example application has a callback handler csmptlvs_get() for the received GET CoAP Method call.
  * The example application has a callback handler csmptlvs_post() for the received POST CoAP method call.
+ * The example application has a callback handler csmptlvs_get_batch() copying all TLVs of a request under one lock.
  * Each handler function will call according to the supplied TLV the appropriate GET/POST TLV function.
  * This function sets the appropriate global variable on the wanted value, e.g. this call can be extended to read/write from the actual hardware.
  * The global variable is then passed down the stack and will be converted in to the protobuf TLV before passing it into the CoAP stack.
@@ -92,8 +93,13 @@
  *
  * Device configuration endpoints, e.g. where the NMS Client interacts with:
  * - <base-url>/c
- * - <base-url>/c/<tlvid>
- * - <base-url>/c/<tlvid>/<index>
+ * - <base-url>/c/<tlvid> - a TLV larger than 1024 bytes, such as a long neighbor table, is sent in Block2 blocks
+ * - <base-url>/c/<tlvid>/<index> - one row of a table
+ * - <base-url>/c/<tlvid>?s=<first>&n=<count> - a page of a table, the next page starts at first plus the rows received
+ * - <base-url>/c/<tlvid>?f=<field><op><value> - the rows of a metrics table matching every f= predicate, e.g. f=ifinerrors>0 or f=rssiforward<-90
+ *
+ * Firmware images posted by the NMS (TLVs 65 and 67) are received into the -image file,
+ * TLV 75 reports the blocks received so far and load requests reach csmptlvs_post().
  */
 
 /************************ start ********************************************/
@@ -109,6 +115,16 @@ uint8_t g_eui64[8] = {0x0a, 0x00, 0x27, 0xff, 0xfe, 0x3b, 0x2a, 0xb2};
 #define reg_interval_min 10
 /** \brief  maximum registation interval*/
 #define reg_interval_max 20
+/** \brief event code raised when the device registers*/
+#define sample_event_registered 1
+/** \brief size of the offline report queue*/
+#define report_queue_len (64*1024)
+/** \brief largest firmware image received from the NMS*/
+#define image_slot_len (512*1024)
+/** \brief max number of failover NMS addresses*/
+#define nms_failover_max_num 3
+/** \brief max number of latency summaries printed*/
+#define latency_max_num 48
 
 /** \brief max number of interfaces*/
 #define interface_max_num 2
@@ -144,6 +160,9 @@ IPRoute_RPLMetrics g_iprouteRplmetrics = IPROUTE_RPLMETRICS_INIT;
 /** \brief the wpan status data */
 WPAN_Status g_wpanStatus = WPANSTATUS_INIT;
 
+/** \brief the 802.15.4g neighbor table */
+Neighbor_802154G g_neighbor802154G[neighbor_max_num] = {NEIGHBOR802154_G_INIT};
+
 /** \brief the rpl data */
 RPL_Instance g_rplInstance = RPLINSTANCE_INIT;
 
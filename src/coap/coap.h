@@ -123,6 +123,7 @@ typedef enum {
   COAP_CODE_CONTENT = 205,  /**< 2.05 Content */
   COAP_CODE_BAD_REQ = 400,  /**< 4.00 Bad Request */
   COAP_CODE_UNAUTHORIZED = 401,  /**< 4.01 Unauthorized */
+  COAP_CODE_BAD_OPTION = 402,  /**< 4.02 Bad Option */
   COAP_CODE_FORBIDDEN = 403,  /**< 4.03 Forbidden */
   COAP_CODE_NOT_FOUND = 404,  /**< 4.04 Not Found */
   COAP_CODE_METHOD_NOT_ALLOWED = 405,  /**< 4.05 Method Not Allowed */
@@ -143,4 +144,45 @@ typedef enum {
  */
 #define COAP_RESPONSE_CLASS(C) (((C) >> 5) & 0xFF)
 
+/**
+  * coap_block_t
+  * Block1 or Block2 option value, https://tools.ietf.org/html/rfc7959
+  */
+typedef struct {
+  uint32_t num;  /**< block number */
+  bool more;     /**< more blocks follow */
+  uint8_t szx;   /**< block size is 16 << szx */
+} coap_block_t;
+
+/**
+ * Largest block size exponent, 1024 byte blocks
+ */
+#define COAP_BLOCK_SZX_MAX (6)
+
+/**
+ * Block size of exponent SZX
+ */
+#define COAP_BLOCK_SIZE(SZX) (16U << (SZX))
+
+/**
+  * coap_socket_config_t
+  * CoAP socket options, 0 keeps the system default
+  */
+typedef struct {
+  uint32_t rcvbuf;  /**< SO_RCVBUF in bytes */
+  uint32_t sndbuf;  /**< SO_SNDBUF in bytes */
+} coap_socket_config_t;
+
+/**
+  * coap_stats_t
+  * CoAP socket drop counters
+  */
+typedef struct {
+  uint32_t rx_errors;       /**< failed receives */
+  uint32_t rx_truncated;    /**< datagrams larger than the receive buffer, dropped */
+  uint32_t rx_malformed;    /**< datagrams that did not parse as CoAP */
+  uint32_t rx_kernel_drops; /**< datagrams dropped by the kernel, socket queue full */
+  uint32_t tx_errors;       /**< failed sends */
+} coap_stats_t;
+
 #endif
@@ -30,6 +30,7 @@
 
 #include "coap.h"
 #include "coapclient.h"
+#include "coapsocket.h"
 
 enum {
   MAX_OPTION_LEN = 128,
@@ -40,6 +41,7 @@ static int m_sock = 0;
 static bool m_client_opened = false;
 static uint16_t m_transaction_id = 0;
 static pthread_t recvt_id;
+static coapsocket_t m_socket;
 
 void *recv_fn(void*);
 int write_option( uint8_t *buf, uint16_t buf_len, coap_option_t this_option, coap_option_t *last_option,
@@ -54,12 +56,12 @@ int coapclient_stop()
   return close(m_sock);
 }
 
-int coapclient_open(response_handler_t response_handler)
+int coapclient_open(response_handler_t response_handler, const coap_socket_config_t *config)
 {
   int sockfd;
 
   if (m_client_opened) {
-    DPRINTF("coaplient was already opened!\n");
+    EPRINTF("coaplient was already opened!\n");
     errno = EBUSY;
     return -1;
   }
@@ -68,11 +70,12 @@ int coapclient_open(response_handler_t response_handler)
 
   sockfd = socket(AF_INET6, SOCK_DGRAM, 0);
   if (sockfd < 0) {
-    DPRINTF("CoapClient.open - failed.\n");
+    EPRINTF("CoapClient.open - failed.\n");
     return -1;
   }
 
   DPRINTF("CoapClient.open - Socket opened.\n");
+  coapsocket_setup(&m_socket, sockfd, config);
 
   m_sock = sockfd;
   m_client_opened = true;
@@ -169,7 +172,8 @@ int coapclient_request (const struct sockaddr_in6 *to,
 
   rv = sendto(m_sock, outbuf, outbuf_len, 0, (const struct sockaddr *)to, sizeof(struct sockaddr_in6));
   if (rv < 0) {
-    DPRINTF("CoapClient.request sendto error, errno:%d\n", errno);
+    EPRINTF("CoapClient.request sendto error, errno:%d\n", errno);
+    coapsocket_count(&m_socket.stats.tx_errors);
     return -1;
   } else {
     DPRINTF("CoapClient.request sendto %d bytes\n", rv);
@@ -255,7 +259,6 @@ void *recv_fn(void* arg)
 
   int rv;
   struct sockaddr_in6 from = {0};
-  socklen_t socklen = sizeof(struct sockaddr_in6);
   uint8_t data[1024];
   int16_t len;
 
@@ -281,9 +284,9 @@ void *recv_fn(void* arg)
 
     if (FD_ISSET(m_sock, &readset))
     {
-      len = recvfrom(m_sock, data, sizeof(data), 0, (struct sockaddr *)(&from), &socklen);
+      len = coapsocket_recv(&m_socket, m_sock, data, sizeof(data), &from);
       if (len < 0) {
-        DPRINTF("coapserver_listen recv_fn recvmsg error!\n");
+        EPRINTF("coapserver_listen recv_fn recvmsg error!\n");
         continue;
       }
 
@@ -309,20 +312,21 @@ void process_response(uint8_t* data, uint16_t len, struct sockaddr_in6 *from)
 {
   uint8_t* cur = data;
   coap_header_t *hdr;
+  const uint8_t *token;
   uint8_t tkl;
   uint8_t status_class;
   uint8_t status_detail;
   uint16_t status, buf_used = 0;
   uint32_t option_delta, option_len;
   if ( (len - buf_used) < (uint16_t)sizeof(coap_header_t) )
-    return;
+    goto short_msg;
 
   hdr = (coap_header_t*) cur;
 
   tkl = hdr->control & 0xF;
 
   if ((len - buf_used) < ((uint16_t)sizeof(coap_header_t) + tkl) || tkl > COAP_MAX_TKL)
-    return;
+    goto short_msg;
 
   status_class = (hdr->code >> 5);
   status_detail = hdr->code & ((1 << 5) - 1);
@@ -330,8 +334,8 @@ void process_response(uint8_t* data, uint16_t len, struct sockaddr_in6 *from)
 
   cur += sizeof(coap_header_t); buf_used += sizeof(coap_header_t);
 
-  if (tkl)
-    return;
+  token = tkl ? cur : NULL;
+  cur += tkl; buf_used += tkl;
 
   while (len - buf_used > 0 && *cur != COAP_PAYLOAD_MARKER) {
     option_delta = (*cur & 0xf0) >> 4;
@@ -341,16 +345,16 @@ void process_response(uint8_t* data, uint16_t len, struct sockaddr_in6 *from)
     switch (option_delta) {
     case 13:
       if (len - buf_used < 1)
-        return;
+        goto short_msg;
       cur++; buf_used++;
       break;
     case 14:
       if (len - buf_used < 2)
-        return;
+        goto short_msg;
       cur += 2; buf_used += 2;
       break;
     case 15:
-      return;
+      goto short_msg;
     default:
       break;
     }
@@ -358,24 +362,24 @@ void process_response(uint8_t* data, uint16_t len, struct sockaddr_in6 *from)
     switch (option_len) {
     case 13:
       if (len - buf_used < 1)
-        return;
+        goto short_msg;
       option_len = *cur + 13;
       cur++; buf_used++;
       break;
     case 14:
       if (len - buf_used < 2)
-        return;
+        goto short_msg;
       option_len = (cur[0] << 8 | cur[1]) + 269;
       cur += 2; buf_used += 2;
       break;
     case 15:
-      return;
+      goto short_msg;
     default:
       break;
     }
 
     if ((uint32_t)(len - buf_used) < option_len)
-      return;
+      goto short_msg;
 
     cur += option_len; buf_used += option_len;
   }
@@ -383,9 +387,18 @@ void process_response(uint8_t* data, uint16_t len, struct sockaddr_in6 *from)
   if (len - buf_used > 0) {
     cur++; buf_used++;
     if (len - buf_used == 0)
-      return;
+      goto short_msg;
   }
 
 
-  m_response_handler(from, status, cur, len-(cur-data));
+  m_response_handler(from, status, token, tkl, cur, len-(cur-data));
+  return;
+
+short_msg:
+  coapsocket_count(&m_socket.stats.rx_malformed);
+}
+
+void coapclient_stats(coap_stats_t *stats)
+{
+  coapsocket_stats(&m_socket, stats);
 }
@@ -34,21 +34,25 @@
  *
  * @param from return address
  * @param status status of the response
+ * @param token token of the request answered, NULL if token_len is 0
+ * @param token_len length of the token
  * @param body body of the response
  * @param body_len length of the respons
  *
  */
 typedef void (*response_handler_t)(struct sockaddr_in6 *from,
 		       uint16_t status,
+		       const uint8_t *token, uint8_t token_len,
 		       const void *body, uint16_t body_len);
 
 /**
  * @brief function to install the respons handler for the request
  *
  * @param response_handler
+ * @param config socket options, NULL keeps the defaults
  * @return int The return value is 0 on success and -1 on failure.
  */
-int coapclient_open(response_handler_t response_handler);
+int coapclient_open(response_handler_t response_handler, const coap_socket_config_t *config);
 
 int coapclient_stop();
 
@@ -76,4 +80,13 @@ int coapclient_request(const struct sockaddr_in6 *to,
 		const coap_uri_seg_t *query, uint32_t query_cnt,
 		const void *body, uint16_t body_len);
 
+/**
+ * @brief retrieve the drop counters of the client socket
+ *
+ * Counters are kept across coapclient_stop() and coapclient_open().
+ *
+ * @param stats filled with the counters
+ */
+void coapclient_stats(coap_stats_t *stats);
+
 #endif
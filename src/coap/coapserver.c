@@ -30,6 +30,7 @@
 
 #include "coap.h"
 #include "coapserver.h"
+#include "coapsocket.h"
 
 enum {
   MAX_PATH_ELEMENTS = 10,
@@ -40,6 +41,7 @@ static pthread_t recvt_id;
 static int m_sockfd = 0;
 static bool m_server_opened = false;
 static recv_handler_t m_recv_handler = NULL;
+static coapsocket_t m_socket;
 
 void process_datagram(void *data, uint16_t len, struct sockaddr_in6 *from );
 void send_internal_response(const struct sockaddr_in6 *from, uint16_t tx_id,
@@ -54,19 +56,20 @@ int coapserver_stop()
   return close(m_sockfd);
 }
 
-int coapserver_listen(uint16_t sport, recv_handler_t recv_handler)
+int coapserver_listen(uint16_t sport, recv_handler_t recv_handler,
+                      const coap_socket_config_t *config)
 {
   int sockfd;
   struct sockaddr_in6 listen_addr;
 
   if (m_server_opened) {
-    DPRINTF("coapserver_listen coapserver was already opened!\n");
+    EPRINTF("coapserver_listen coapserver was already opened!\n");
     errno = EBUSY;
     return -1;
   }
 
   if (!recv_handler) {
-    DPRINTF("coapserver_listen Invaid recv_handler!\n");
+    EPRINTF("coapserver_listen Invaid recv_handler!\n");
     errno = EINVAL;
     return -1;
   } else {
@@ -78,17 +81,19 @@ int coapserver_listen(uint16_t sport, recv_handler_t recv_handler)
     return -1;
   }
 
+  coapsocket_setup(&m_socket, sockfd, config);
+
   listen_addr.sin6_family = AF_INET6;
   listen_addr.sin6_addr = in6addr_any;
   listen_addr.sin6_port = htons(sport);
 
   if (bind(sockfd, (const struct sockaddr *)(&listen_addr), sizeof(listen_addr)) < 0) {
-    DPRINTF("coapserver_listen bind error!\n");
+    EPRINTF("coapserver_listen bind error!\n");
     close(sockfd);
     return -1;
   }
 
-  DPRINTF("Listening on port %d\n", ntohs(listen_addr.sin6_port));
+  IPRINTF("Listening on port %d\n", ntohs(listen_addr.sin6_port));
 
   m_sockfd = sockfd;
   m_server_opened = true;
@@ -104,7 +109,6 @@ void *recv_thread(void* arg)
 
   int rv;
   struct sockaddr_in6 from = {0};
-  socklen_t socklen = sizeof(struct sockaddr_in6);
   uint8_t data[1024];
   int32_t len;
 
@@ -130,9 +134,9 @@ void *recv_thread(void* arg)
 
     if (FD_ISSET(m_sockfd, &readset))
     {
-      len = recvfrom(m_sockfd, data, sizeof(data), 0, (struct sockaddr *)(&from), &socklen);
+      len = coapsocket_recv(&m_socket, m_sockfd, data, sizeof(data), &from);
       if (len < 0) {
-        DPRINTF("coapserver_listen recv_fn recvmsg error!\n");
+        EPRINTF("coapserver_listen recv_fn recvmsg error!\n");
         continue;
       }
 
@@ -159,22 +163,24 @@ int coapserver_response(const struct sockaddr_in6 *to,
     uint16_t tx_id,
     uint8_t token_length, uint8_t *token,
     uint16_t status,
+    const coap_block_t *block2,
     const void* body, uint16_t body_len)
 {
   coap_header_t coap_hdr;
   uint32_t version = 1;
   int rv;
   uint8_t payload_marker = COAP_PAYLOAD_MARKER;
+  uint8_t opt[5];
+  uint32_t val, opt_len, i;
 
   struct msghdr msg_hdr = {0};
-  struct iovec iov[4] = {{0}};
+  struct iovec iov[5] = {{0}};
 
   msg_hdr.msg_name = (struct sockaddr_in6 *)to;
   msg_hdr.msg_namelen = sizeof(struct sockaddr_in6);
   msg_hdr.msg_iov = iov;
   msg_hdr.msg_iovlen = 1;
 
-  // don't encode any options
   coap_hdr.control = ( version << 6 ) | ( tx_type << 4 ) | token_length;
   coap_hdr.code = COAP_RESPONSE_CODE(status);
   coap_hdr.message_id = tx_id;
@@ -182,31 +188,32 @@ int coapserver_response(const struct sockaddr_in6 *to,
   iov[0].iov_base = &coap_hdr;
   iov[0].iov_len = sizeof(coap_hdr);
   if (token_length) {
-    iov[1].iov_base = token;
-    iov[1].iov_len = token_length;
-    msg_hdr.msg_iovlen++;
+    iov[msg_hdr.msg_iovlen].iov_base = token;
+    iov[msg_hdr.msg_iovlen++].iov_len = token_length;
+  }
 
-    if ( body && body_len ) {
-      iov[2].iov_base = &payload_marker;
-      iov[2].iov_len = 1;
+  // Block2 is the only option encoded, its delta takes one extended byte
+  if (block2) {
+    val = (block2->num << 4) | (block2->more << 3) | block2->szx;
+    opt_len = (val > 0xffff) ? 3 : (val > 0xff) ? 2 : (val > 0) ? 1 : 0;
+    opt[0] = (13 << 4) | opt_len;
+    opt[1] = COAP_BLOCK2 - 13;
+    for (i = 0; i < opt_len; i++)
+      opt[2 + i] = val >> (8 * (opt_len - 1 - i));
+    iov[msg_hdr.msg_iovlen].iov_base = opt;
+    iov[msg_hdr.msg_iovlen++].iov_len = 2 + opt_len;
+  }
 
-      iov[3].iov_base = (void *) body;
-      iov[3].iov_len = body_len;
-      msg_hdr.msg_iovlen += 2;
-    }
-  } else {
-    if ( body && body_len ) {
-      iov[1].iov_base = &payload_marker;
-      iov[1].iov_len = 1;
+  if ( body && body_len ) {
+    iov[msg_hdr.msg_iovlen].iov_base = &payload_marker;
+    iov[msg_hdr.msg_iovlen++].iov_len = 1;
 
-      iov[2].iov_base = (void *) body;
-      iov[2].iov_len = body_len;
-      msg_hdr.msg_iovlen += 2;
-    }
+    iov[msg_hdr.msg_iovlen].iov_base = (void *) body;
+    iov[msg_hdr.msg_iovlen++].iov_len = body_len;
   }
 
   DPRINTF("coapserver.response - Sending %d-byte response to [%x:%x:%x:%x:%x:%x:%x:%x%%%u]:%hu\n",
-      (int)(iov[0].iov_len + iov[1].iov_len + iov[2].iov_len + iov[3].iov_len),
+      (int)(iov[0].iov_len + iov[1].iov_len + iov[2].iov_len + iov[3].iov_len + iov[4].iov_len),
       ((uint16_t)to->sin6_addr.s6_addr[0] << 8) | to->sin6_addr.s6_addr[1],
       ((uint16_t)to->sin6_addr.s6_addr[2] << 8) | to->sin6_addr.s6_addr[3],
       ((uint16_t)to->sin6_addr.s6_addr[4] << 8) | to->sin6_addr.s6_addr[5],
@@ -219,6 +226,8 @@ int coapserver_response(const struct sockaddr_in6 *to,
 
   rv = sendmsg(m_sockfd, &msg_hdr, 0);
   if (rv < 0) {
+    EPRINTF("coapserver.response sendmsg error, errno:%d\n", errno);
+    coapsocket_count(&m_socket.stats.tx_errors);
     return -1;
   }
 
@@ -250,6 +259,10 @@ void process_datagram(void *data, uint16_t len, struct sockaddr_in6 *from )
   uint32_t query_seg_cnt = 0;
   //char* query_ptr = query;
 
+  coap_block_t block2 = {0};
+  bool has_block2 = false;
+  uint32_t val, i;
+
   if ( (len - buf_used) < (uint16_t)sizeof(coap_header_t) )
     goto short_msg;
 
@@ -334,6 +347,19 @@ void process_datagram(void *data, uint16_t len, struct sockaddr_in6 *from )
         query_seg_cnt++;
       }
       break;
+    case COAP_BLOCK2:
+      // Up to 3 bytes, SZX 7 is reserved
+      if (option_len > 3)
+        goto short_msg;
+      for (val = 0, i = 0; i < option_len; i++)
+        val = (val << 8) | cur[i];
+      if ((val & 0x7) == 7)
+        goto short_msg;
+      block2.num = val >> 4;
+      block2.more = (val >> 3) & 1;
+      block2.szx = val & 0x7;
+      has_block2 = true;
+      break;
     default:
       break;
     }
@@ -350,11 +376,12 @@ void process_datagram(void *data, uint16_t len, struct sockaddr_in6 *from )
 
   m_recv_handler(from, tx_type, tx_id, token_length, token, method,
       path, path_seg_cnt, query, query_seg_cnt,
-      cur, len-(cur-(uint8_t *)data));
+      has_block2 ? &block2 : NULL, cur, len-(cur-(uint8_t *)data));
 
   return;
 
 short_msg:
+  coapsocket_count(&m_socket.stats.rx_malformed);
   if (tx_type == COAP_CON)
     send_internal_response(from, tx_id, token_length, token, COAP_CODE_BAD_REQ);
 }
@@ -362,5 +389,10 @@ short_msg:
 void send_internal_response(const struct sockaddr_in6 *from, uint16_t tx_id,
                             uint8_t token_length, uint8_t *token, uint16_t status)
 {
-  coapserver_response(from, COAP_ACK, tx_id, token_length, token, status, NULL, 0);
+  coapserver_response(from, COAP_ACK, tx_id, token_length, token, status, NULL, NULL, 0);
+}
+
+void coapserver_stats(coap_stats_t *stats)
+{
+  coapsocket_stats(&m_socket, stats);
 }
@@ -35,6 +35,7 @@
  * - Non confirmable messages
  * - option headers
  * - tokens
+ * - Block2 option, for responses larger than a datagram
  *
  */
 
@@ -52,6 +53,7 @@
  * @param url_cnt Number of URL segments
  * @param query The CoAP option query of the incoming data
  * @param url_cnt Number of query segments
+ * @param block2 The Block2 option of the request, NULL without one
  * @param body The body of the message
  * @param body_len The length of the body message
  */
@@ -65,6 +67,7 @@ typedef void (*recv_handler_t)(struct sockaddr_in6 *from,
                    uint32_t url_cnt,
                    const coap_uri_seg_t *query,
                    uint32_t query_cnt,
+                   const coap_block_t *block2,
                    const void *body,
                    uint16_t body_len );
 
@@ -73,9 +76,11 @@ typedef void (*recv_handler_t)(struct sockaddr_in6 *from,
  *
  * @param sport The server port
  * @param recv_handler The handler to handle incoming traffic.
+ * @param config Socket options, NULL keeps the defaults.
  * @return int The return value is 0 on success and -1 on failure.
  */
-int coapserver_listen(uint16_t sport, recv_handler_t recv_handler);
+int coapserver_listen(uint16_t sport, recv_handler_t recv_handler,
+                      const coap_socket_config_t *config);
 
 /**
  * @brief stops the CoAP server
@@ -93,6 +98,7 @@ int coapserver_stop();
  * @param token_length The length of the CoAP identifier
  * @param token  The CoAP token
  * @param status The (return) status
+ * @param block2 The Block2 option of the response, NULL without one
  * @param body The body of the message
  * @param body_len The length of the body message
  * @return int The return value is 0 on success and -1 on failure.
@@ -102,6 +108,16 @@ int coapserver_response(const struct sockaddr_in6 *to,
     uint16_t tx_id,
     uint8_t token_length, uint8_t *token,
     uint16_t status,
+    const coap_block_t *block2,
     const void* body, uint16_t body_len);
 
+/**
+ * @brief retrieve the drop counters of the server socket
+ *
+ * Counters are kept across coapserver_stop() and coapserver_listen().
+ *
+ * @param stats Filled with the counters.
+ */
+void coapserver_stats(coap_stats_t *stats);
+
 #endif
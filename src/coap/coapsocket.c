@@ -0,0 +1,113 @@
+/*
+ *  Copyright 2021 Cisco Systems, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <netinet/in.h>
+
+#include "coap.h"
+#include "coapsocket.h"
+
+void coapsocket_count(uint32_t *counter)
+{
+  __atomic_add_fetch(counter, 1, __ATOMIC_RELAXED);
+}
+
+void coapsocket_setup(coapsocket_t *sock, int sockfd, const coap_socket_config_t *config)
+{
+  int val;
+
+  sock->rxq_ovfl = 0;
+
+  if (config && config->rcvbuf) {
+    val = config->rcvbuf;
+    if (setsockopt(sockfd, SOL_SOCKET, SO_RCVBUF, &val, sizeof(val)) < 0) {
+      WPRINTF("coapsocket_setup SO_RCVBUF %d failed, errno:%d\n", val, errno);
+    }
+  }
+  if (config && config->sndbuf) {
+    val = config->sndbuf;
+    if (setsockopt(sockfd, SOL_SOCKET, SO_SNDBUF, &val, sizeof(val)) < 0) {
+      WPRINTF("coapsocket_setup SO_SNDBUF %d failed, errno:%d\n", val, errno);
+    }
+  }
+
+#ifdef SO_RXQ_OVFL
+  val = 1;
+  if (setsockopt(sockfd, SOL_SOCKET, SO_RXQ_OVFL, &val, sizeof(val)) < 0) {
+    WPRINTF("coapsocket_setup SO_RXQ_OVFL failed, errno:%d\n", errno);
+  }
+#endif
+}
+
+int coapsocket_recv(coapsocket_t *sock, int sockfd, void *buf, uint16_t size,
+                    struct sockaddr_in6 *from)
+{
+  uint8_t control[CMSG_SPACE(sizeof(uint32_t))];
+  struct iovec iov = { buf, size };
+  struct msghdr msg = {0};
+  int len;
+#ifdef SO_RXQ_OVFL
+  struct cmsghdr *cmsg;
+  uint32_t ovfl;
+#endif
+
+  msg.msg_name = from;
+  msg.msg_namelen = sizeof(struct sockaddr_in6);
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control;
+  msg.msg_controllen = sizeof(control);
+
+  len = recvmsg(sockfd, &msg, 0);
+  if (len < 0) {
+    if (errno != EINTR)
+      coapsocket_count(&sock->stats.rx_errors);
+    return -1;
+  }
+
+#ifdef SO_RXQ_OVFL
+  // The kernel reports its running drop count with every datagram
+  for (cmsg = CMSG_FIRSTHDR(&msg); cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+    if ((cmsg->cmsg_level == SOL_SOCKET) && (cmsg->cmsg_type == SO_RXQ_OVFL)) {
+      memcpy(&ovfl, CMSG_DATA(cmsg), sizeof(ovfl));
+      __atomic_add_fetch(&sock->stats.rx_kernel_drops, ovfl - sock->rxq_ovfl, __ATOMIC_RELAXED);
+      sock->rxq_ovfl = ovfl;
+    }
+  }
+#endif
+
+  if (msg.msg_flags & MSG_TRUNC) {
+    DPRINTF("coapsocket_recv dropped datagram larger than %u bytes\n", size);
+    coapsocket_count(&sock->stats.rx_truncated);
+    return -1;
+  }
+  return len;
+}
+
+void coapsocket_stats(const coapsocket_t *sock, coap_stats_t *stats)
+{
+  stats->rx_errors = __atomic_load_n(&sock->stats.rx_errors, __ATOMIC_RELAXED);
+  stats->rx_truncated = __atomic_load_n(&sock->stats.rx_truncated, __ATOMIC_RELAXED);
+  stats->rx_malformed = __atomic_load_n(&sock->stats.rx_malformed, __ATOMIC_RELAXED);
+  stats->rx_kernel_drops = __atomic_load_n(&sock->stats.rx_kernel_drops, __ATOMIC_RELAXED);
+  stats->tx_errors = __atomic_load_n(&sock->stats.tx_errors, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,76 @@
+/*
+ *  Copyright 2021 Cisco Systems, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef __COAPSOCKET_H
+#define __COAPSOCKET_H
+
+/*! \file
+ *
+ * UDP socket helpers shared by the CoAP client and server.
+ *
+ * Receives report truncated datagrams and, where the kernel supports
+ * SO_RXQ_OVFL, the datagrams it dropped because the socket queue was full.
+ */
+
+#include <netinet/in.h>
+#include "coap.h"
+
+/**
+ * @brief state of one CoAP socket
+ */
+typedef struct {
+  coap_stats_t stats;  /**< drop counters */
+  uint32_t rxq_ovfl;   /**< kernel drop count last reported by the socket */
+} coapsocket_t;
+
+/**
+ * @brief apply the socket options and start counting kernel drops
+ *
+ * @param sock the socket state, its counters are kept
+ * @param sockfd the socket
+ * @param config socket options, NULL keeps the defaults
+ */
+void coapsocket_setup(coapsocket_t *sock, int sockfd, const coap_socket_config_t *config);
+
+/**
+ * @brief receive one datagram
+ *
+ * @param sock the socket state
+ * @param sockfd the socket
+ * @param buf receive buffer
+ * @param size size of buf
+ * @param from filled with the sender address
+ * @return int length of the datagram, -1 on error or when it was truncated
+ */
+int coapsocket_recv(coapsocket_t *sock, int sockfd, void *buf, uint16_t size,
+                    struct sockaddr_in6 *from);
+
+/**
+ * @brief count a drop
+ *
+ * @param counter the counter in coap_stats_t
+ */
+void coapsocket_count(uint32_t *counter);
+
+/**
+ * @brief copy the counters of a socket
+ *
+ * @param sock the socket state
+ * @param stats filled with the counters
+ */
+void coapsocket_stats(const coapsocket_t *sock, coap_stats_t *stats);
+
+#endif
@@ -24,6 +24,8 @@
  */
 
 #include <stdint.h>
+#include <stdbool.h>
+#include <netinet/in.h>
 #include "coap.h"
 
 /**
@@ -49,6 +51,114 @@ typedef struct _eventid_t {
 #define MAX_SUBSCRIBE_LIST_CNT (15)
 #endif
 
+#ifndef MAX_SUBSCRIPTION_CNT
+/** maximum concurrent report subscriptions */
+#define MAX_SUBSCRIPTION_CNT (4)
+#endif
+
+#ifndef MAX_EVENT_TLV_CNT
+/** maximum TLVs reported with an event */
+#define MAX_EVENT_TLV_CNT (4)
+#endif
+
+#ifndef MAX_NMS_ENDPOINT_CNT
+/** maximum NMS endpoints, the configured ones and a redirect target */
+#define MAX_NMS_ENDPOINT_CNT (4)
+#endif
+
+#ifndef NMS_FAILOVER_ATTEMPTS
+/** consecutive failed requests before failing over to the next NMS */
+#define NMS_FAILOVER_ATTEMPTS (3)
+#endif
+
+#ifndef REPORT_ACK_TIMEOUT
+/** seconds to wait for the NMS to confirm a queued report before resending it */
+#define REPORT_ACK_TIMEOUT (30)
+#endif
+
+#ifndef REG_CACHE_MAX_AGE
+/** seconds a registration TLV that was not invalidated is sent from the cache */
+#define REG_CACHE_MAX_AGE (300)
+#endif
+
+#ifndef LATENCY_SITE_MAX
+/**
+ * maximum latency histograms, one per kind and key. The GET and POST
+ * handlers, provider callbacks and CoAP methods come to about 60.
+ */
+#define LATENCY_SITE_MAX (96)
+#endif
+
+#ifndef LATENCY_SHARD_CNT
+/** latency histogram shards, threads beyond this share them */
+#define LATENCY_SHARD_CNT (4)
+#endif
+
+#ifndef STATS_SHARD_CNT
+/** service statistics shards, threads beyond this share them */
+#define STATS_SHARD_CNT (4)
+#endif
+
+#ifndef EVENT_QUEUE_LEN
+/** events queued per priority, must be a power of 2 */
+#define EVENT_QUEUE_LEN (16)
+#endif
+
+#ifndef EVENT_BATCH_MAX
+/** maximum events in one event message */
+#define EVENT_BATCH_MAX (8)
+#endif
+
+#ifndef EVENT_LOW_INTERVAL
+/** minimum seconds between low priority event messages */
+#define EVENT_LOW_INTERVAL (60)
+#endif
+
+#ifndef EVENT_MEDIUM_INTERVAL
+/** minimum seconds between medium priority event messages */
+#define EVENT_MEDIUM_INTERVAL (10)
+#endif
+
+#ifndef TLV_ARENA_SIZE
+/** bytes per thread for decoded TLVs, larger messages use the heap */
+#define TLV_ARENA_SIZE (2048)
+#endif
+
+#ifndef PROVIDER_BATCH_MAX
+/** maximum TLVs read from the application in one batch */
+#define PROVIDER_BATCH_MAX (20)
+#endif
+
+#ifndef PROVIDER_SNAPSHOT_SIZE
+/** bytes per thread holding a batch read from the application */
+#define PROVIDER_SNAPSHOT_SIZE (8192)
+#endif
+
+#ifndef FILTER_PRED_MAX
+/** maximum predicates of a row filter */
+#define FILTER_PRED_MAX (4)
+#endif
+
+#ifndef BLOCK_ROWS_SIZE
+/** bytes of whole rows encoded for one Block2 block, at least the block plus its longest row */
+#define BLOCK_ROWS_SIZE (2048)
+#endif
+
+#ifndef BLOCK_XFER_MAX
+/** Block2 transfers resumed from where the last block ended, one per client and TLV */
+#define BLOCK_XFER_MAX (4)
+#endif
+
+#ifndef IMAGE_SLOT_INDEX
+/** FirmwareImageInfo index of the image being received */
+#define IMAGE_SLOT_INDEX (2)
+#endif
+
+#ifndef IMAGE_MISSING_SIZE
+/** most bytes of missing block runs in a TransferResponse, at least 10 */
+#define IMAGE_MISSING_SIZE (64)
+#endif
+
 /**
  * @brief subscription list
  *
@@ -57,6 +167,8 @@ typedef struct {
   uint32_t period;  /**< period */
   uint32_t cnt;  /**< counter for the subscriber */
   tlvid_t list[MAX_SUBSCRIBE_LIST_CNT];  /**< list of subscribers */
+  bool phase_set;  /**< phase was set by the NMS, otherwise derived from the EUI-64 */
+  uint32_t phase;  /**< offset of the reports within the period (sec) */
 } csmp_subscription_list_t;
 
 /**
@@ -73,13 +185,59 @@ typedef struct {
  *
  */
 typedef struct {
-  uint16_t trigger_low; /**< trigger low */
-  uint16_t trigger_med; /**< triggger medium */
-  uint16_t trigger_high; /**< trigger high */
-  uint16_t sent; /**< trigger processed */
-  uint16_t bad_priority; /**< bad priority */
+  uint32_t trigger_low; /**< trigger low */
+  uint32_t trigger_med; /**< triggger medium */
+  uint32_t trigger_high; /**< trigger high */
+  uint32_t sent; /**< trigger processed */
+  uint32_t bad_priority; /**< bad priority */
+  uint32_t coalesced; /**< repeats merged into an earlier report of the same event and TLVs */
+  uint32_t dropped; /**< queue full or message too large */
+  uint32_t acked; /**< high priority events the NMS acknowledged */
+  uint32_t rejected; /**< high priority events the NMS answered with an error */
 } csmp_event_stats_t;
 
+/**
+ * @brief NMS endpoint health
+ *
+ */
+typedef struct {
+  struct in6_addr addr;  /**< NMS address */
+  uint16_t port;  /**< NMS port */
+  bool active;  /**< the endpoint the agent registers with */
+  uint32_t srtt;  /**< smoothed round trip time (ms), 0 until measured */
+  uint32_t fails;  /**< consecutive failed or unanswered requests */
+  uint32_t failovers;  /**< times the agent failed over away from this endpoint */
+} csmp_nms_endpoint_t;
+
+/**
+ * @brief latency histogram kinds
+ *
+ */
+typedef enum {
+  CSMP_LATENCY_REQUEST = 0,        /**< CSMP server request handling, keyed by CoAP method */
+  CSMP_LATENCY_HANDLER_GET = 1,    /**< TLV GET handler, keyed by TLV type */
+  CSMP_LATENCY_HANDLER_POST = 2,   /**< TLV POST handler, keyed by TLV type */
+  CSMP_LATENCY_PROVIDER_GET = 3,   /**< application GET callback, keyed by TLV type */
+  CSMP_LATENCY_PROVIDER_POST = 4,  /**< application POST callback, keyed by TLV type */
+  CSMP_LATENCY_SIGNATURE = 5,      /**< signature check */
+  CSMP_LATENCY_RESPONSE = 6,       /**< sending a CoAP response */
+  CSMP_LATENCY_PROVIDER_BATCH = 7, /**< application batched GET callback */
+  CSMP_LATENCY_KIND_CNT = 8        /**< number of kinds */
+} csmp_latency_kind_t;
+
+/**
+ * @brief latency summary of one histogram
+ *
+ */
+typedef struct {
+  csmp_latency_kind_t kind;  /**< what was timed */
+  uint32_t key;  /**< TLV type or CoAP method, see csmp_latency_kind_t */
+  uint32_t count;  /**< samples */
+  uint32_t p50;  /**< median (us) */
+  uint32_t p99;  /**< 99th percentile (us) */
+  uint32_t max;  /**< longest sample (us) */
+} csmp_latency_stats_t;
+
 /**
  * @brief public key
  *
@@ -118,6 +276,17 @@ enum {
   CSMP_GROUP_NUM_TYPES   = 3
 };
 
+// Response of TransferResponse, LoadResponse, CancelLoadResponse and SetBackupResponse
+enum {
+  CSMP_IMAGE_OK = 0,
+  CSMP_IMAGE_NO_SLOT = 1,      // no image slot configured
+  CSMP_IMAGE_BAD_REQUEST = 2,  // fileHash, fileSize or blockSize missing or invalid
+  CSMP_IMAGE_TOO_LARGE = 3,    // image larger than the slot
+  CSMP_IMAGE_UNKNOWN = 4,      // no transfer of the image
+  CSMP_IMAGE_INCOMPLETE = 5,   // blocks of the image are missing
+  CSMP_IMAGE_BAD_HASH = 6      // image received, its SHA-256 does not match fileHash
+};
+
 enum {
   CSMP_PHYSICAL_FUNCTION_METER = 1,
   CSMP_PHYSICAL_FUNCTION_RE = 2,
@@ -168,8 +337,10 @@ enum {
   DHCP6_CLIENT_STATUS_TLVID = 36,
   CGMSSETTINGS_TLVID = 42,
   CGMSSTATUS_TLVID = 43,
+  CGMSSTATS_TLVID = 45,
   IEEE8021X_SETTINGS_TLVID = 47,
   IEEE802154_BEACON_STATS_TLVID = 48,
+  NEIGHBOR802154_G_TLVID = 52,
   RPLINSTANCE_TLVID = 53,
   GROUP_ASSIGN_TLVID = 55,
   GROUP_EVICT_TLVID = 56,
@@ -227,8 +398,10 @@ enum {
 #define DHCP6_CLIENT_STATUS_ID_STRING "36"
 #define CGMSSETTINGS_ID_STRING "42"
 #define CGMSSTATUS_ID_STRING "43"
+#define CGMSSTATS_ID_STRING "45"
 #define IEEE8021X_SETTINGS_ID_STRING "47"
 #define IEEE802154_BEACON_STATS_ID_STRING "48"
+#define NEIGHBOR802154_G_ID_STRING "52"
 #define RPLINSTANCE_ID_STRING "53"
 #define GROUP_ASSIGN_ID_STRING "55"
 #define GROUP_EVICT_ID_STRING "56"
@@ -0,0 +1,115 @@
+/*
+ *  Copyright 2021 Cisco Systems, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "csmp.h"
+#include "csmptlv.h"
+#include "csmpagent.h"
+#include "csmpfunction.h"
+#include "CsmpTlvs.pb-c.h"
+
+extern uint32_t g_csmplib_reginterval_min;
+extern uint32_t g_csmplib_reginterval_max;
+
+/* registration spread window hinted by the NMS (sec), 0 if none */
+uint32_t g_csmplib_reg_backoff = 0;
+
+int csmp_get_cgmsSettings(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex)
+{
+  CGMSSettings CGMSSettingsMsg = CGMSSETTINGS__INIT;
+  size_t rv;
+
+  (void) tlvindex; // Suppress unused param compiler warning.
+
+  DPRINTF("csmpagent_cgmsSettings: start working.\n");
+
+  CGMSSettingsMsg.reg_interval_min_present_case = CGMSSETTINGS__REG_INTERVAL_MIN_PRESENT_REG_INTERVAL_MIN;
+  CGMSSettingsMsg.regintervalmin = g_csmplib_reginterval_min;
+  CGMSSettingsMsg.reg_interval_max_present_case = CGMSSETTINGS__REG_INTERVAL_MAX_PRESENT_REG_INTERVAL_MAX;
+  CGMSSettingsMsg.regintervalmax = g_csmplib_reginterval_max;
+  if (g_csmplib_reg_backoff) {
+    CGMSSettingsMsg.reg_backoff_present_case = CGMSSETTINGS__REG_BACKOFF_PRESENT_REG_BACKOFF;
+    CGMSSettingsMsg.regbackoff = g_csmplib_reg_backoff;
+  }
+
+  rv = csmptlv_write(buf, len, tlvid, (ProtobufCMessage *)&CGMSSettingsMsg);
+  if (rv == 0) {
+    EPRINTF("csmpagent_cgmsSettings: csmptlv_write error!\n");
+    return -1;
+  }
+  DPRINTF("csmpagent_cgmsSettings: csmptlv_write [%ld] bytes to buffer!\n", rv);
+  return rv;
+}
+
+/*
+ * The NMS may tune the registration intervals and hint the window over
+ * which devices should spread their registrations while it is loaded.
+ * The hint is applied to the next held registration, see cgmsagent.
+ */
+int csmp_put_cgmsSettings(tlvid_t tlvid, const uint8_t *buf, size_t len, uint8_t *out_buf, size_t out_size, size_t *out_len, int32_t tlvindex)
+{
+  CGMSSettings *CGMSSettingsMsg = NULL;
+  tlvid_t tlvid0;
+  uint32_t tlvlen;
+  uint32_t regmin = g_csmplib_reginterval_min;
+  uint32_t regmax = g_csmplib_reginterval_max;
+  const uint8_t *pbuf = buf;
+  size_t rv;
+  int used = 0;
+
+  (void) tlvid; // Suppress unused param compiler warning.
+  (void) out_buf; // Suppress unused param compiler warning.
+  (void) out_size; // Suppress unused param compiler warning.
+  (void) out_len; // Suppress unused param compiler warning.
+  (void) tlvindex; // Suppress unused param compiler warning.
+
+  DPRINTF("Received POST cgmsSettings TLV\n");
+
+  rv = csmptlv_readTL(pbuf, len, &tlvid0, &tlvlen);
+  if ((rv == 0) || (tlvid0.type != CGMSSETTINGS_TLVID)) {
+    return -1;
+  }
+  pbuf += rv; used += rv;
+
+  rv = csmptlv_readV(pbuf, tlvlen, (ProtobufCMessage **)&CGMSSettingsMsg, &cgmssettings__descriptor);
+  if (rv == 0) {
+    return -1;
+  }
+  pbuf += rv; used += rv;
+
+  if (CGMSSettingsMsg->reg_interval_min_present_case == CGMSSETTINGS__REG_INTERVAL_MIN_PRESENT_REG_INTERVAL_MIN)
+    regmin = CGMSSettingsMsg->regintervalmin;
+  if (CGMSSettingsMsg->reg_interval_max_present_case == CGMSSETTINGS__REG_INTERVAL_MAX_PRESENT_REG_INTERVAL_MAX)
+    regmax = CGMSSettingsMsg->regintervalmax;
+  if ((regmin > 0) && (regmin <= regmax)) {
+    g_csmplib_reginterval_min = regmin;
+    g_csmplib_reginterval_max = regmax;
+  }
+  else {
+    WPRINTF("CGMSSettingsMsg: invalid interval %u..%u ignored\n", regmin, regmax);
+  }
+
+  if (CGMSSettingsMsg->reg_backoff_present_case == CGMSSETTINGS__REG_BACKOFF_PRESENT_REG_BACKOFF) {
+    g_csmplib_reg_backoff = CGMSSettingsMsg->regbackoff;
+    DPRINTF("CGMSSettingsMsg: regBackoff=%u\n", g_csmplib_reg_backoff);
+  }
+
+  DPRINTF("Processed POST %s TLV with size=%d\n", CGMSSettingsMsg->base.descriptor->name, (int)used);
+
+  csmptlv_free((ProtobufCMessage *)CGMSSettingsMsg);
+  return used;
+}
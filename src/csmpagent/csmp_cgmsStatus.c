@@ -0,0 +1,117 @@
+/*
+ *  Copyright 2021 Cisco Systems, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "csmp.h"
+#include "cgmsagent.h"
+#include "csmptlv.h"
+#include "csmpagent.h"
+#include "csmpfunction.h"
+#include "csmpstats.h"
+#include "CsmpTlvs.pb-c.h"
+
+extern uint8_t g_csmplib_status;
+
+int csmp_get_cgmsStatus(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex)
+{
+  CGMSStatus CGMSStatusMsg = CGMSSTATUS__INIT;
+  cgmsagent_status_t status;
+  size_t rv;
+
+  (void) tlvindex; // Suppress unused param compiler warning.
+
+  DPRINTF("csmpagent_cgmsStatus: start working.\n");
+
+  cgmsagent_status(&status);
+
+  CGMSStatusMsg.registered_present_case = CGMSSTATUS__REGISTERED_PRESENT_REGISTERED;
+  CGMSStatusMsg.registered = (g_csmplib_status == REGISTRATION_SUCCESS);
+  CGMSStatusMsg.nmsaddr_present_case = CGMSSTATUS__NMSADDR_PRESENT_NMSADDR;
+  CGMSStatusMsg.nmsaddr.len = sizeof(status.nms_addr);
+  CGMSStatusMsg.nmsaddr.data = status.nms_addr.s6_addr;
+  CGMSStatusMsg.nmsaddr_origin_present_case = CGMSSTATUS__NMSADDR_ORIGIN_PRESENT_NMSADDR_ORIGIN;
+  CGMSStatusMsg.nmsaddrorigin = status.nms_origin;
+  if (status.last_reg) {
+    CGMSStatusMsg.last_reg_present_case = CGMSSTATUS__LAST_REG_PRESENT_LAST_REG;
+    CGMSStatusMsg.lastreg = status.last_reg;
+    CGMSStatusMsg.last_reg_reason_present_case = CGMSSTATUS__LAST_REG_REASON_PRESENT_LAST_REG_REASON;
+    CGMSStatusMsg.lastregreason = status.last_reg_reason;
+  }
+  if (status.next_reg) {
+    CGMSStatusMsg.next_reg_present_case = CGMSSTATUS__NEXT_REG_PRESENT_NEXT_REG;
+    CGMSStatusMsg.nextreg = status.next_reg;
+  }
+
+  rv = csmptlv_write(buf, len, tlvid, (ProtobufCMessage *)&CGMSStatusMsg);
+  if (rv == 0) {
+    EPRINTF("csmpagent_cgmsStatus: csmptlv_write error!\n");
+    return -1;
+  }
+  DPRINTF("csmpagent_cgmsStatus: csmptlv_write [%ld] bytes to buffer!\n", rv);
+  return rv;
+}
+
+/*
+ * Round trip times are in milliseconds, report latencies, from encoding
+ * to handing the message to the socket, in microseconds.
+ */
+int csmp_get_cgmsStats(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex)
+{
+  CGMSStats CGMSStatsMsg = CGMSSTATS__INIT;
+  csmp_service_stats_t stats;
+  size_t rv;
+
+  (void) tlvindex; // Suppress unused param compiler warning.
+
+  DPRINTF("csmpagent_cgmsStats: start working.\n");
+  csmpstats_snapshot(&stats, CSMP_STATS_TOTAL);
+
+  CGMSStatsMsg.sig_ok_present_case = CGMSSTATS__SIG_OK_PRESENT_SIG_OK;
+  CGMSStatsMsg.sigok = stats.sig_ok;
+  CGMSStatsMsg.sig_bad_auth_present_case = CGMSSTATS__SIG_BAD_AUTH_PRESENT_SIG_BAD_AUTH;
+  CGMSStatsMsg.sigbadauth = stats.sig_bad_auth;
+  CGMSStatsMsg.sig_bad_validity_present_case = CGMSSTATS__SIG_BAD_VALIDITY_PRESENT_SIG_BAD_VALIDITY;
+  CGMSStatsMsg.sigbadvalidity = stats.sig_bad_validity;
+  CGMSStatsMsg.reg_succeed_present_case = CGMSSTATS__REG_SUCCEED_PRESENT_REG_SUCCEED;
+  CGMSStatsMsg.regsucceed = stats.reg_succeed;
+  CGMSStatsMsg.reg_attempts_present_case = CGMSSTATS__REG_ATTEMPTS_PRESENT_REG_ATTEMPTS;
+  CGMSStatsMsg.regattempts = stats.reg_attempts;
+  CGMSStatsMsg.reg_holds_present_case = CGMSSTATS__REG_HOLDS_PRESENT_REG_HOLDS;
+  CGMSStatsMsg.regholds = stats.reg_holds;
+  CGMSStatsMsg.reg_fails_present_case = CGMSSTATS__REG_FAILS_PRESENT_REG_FAILS;
+  CGMSStatsMsg.regfails = stats.reg_fails;
+  CGMSStatsMsg.nms_errors_present_case = CGMSSTATS__NMS_ERRORS_PRESENT_NMS_ERRORS;
+  CGMSStatsMsg.nmserrors = stats.reg_fails_stats.error_coap;
+  CGMSStatsMsg.reg_rtt_present_case = CGMSSTATS__REG_RTT_PRESENT_REG_RTT;
+  CGMSStatsMsg.regrtt = stats.reg_rtt;
+  CGMSStatsMsg.reg_rtt_max_present_case = CGMSSTATS__REG_RTT_MAX_PRESENT_REG_RTT_MAX;
+  CGMSStatsMsg.regrttmax = stats.reg_rtt_max;
+  CGMSStatsMsg.reg_retransmits_present_case = CGMSSTATS__REG_RETRANSMITS_PRESENT_REG_RETRANSMITS;
+  CGMSStatsMsg.regretransmits = stats.reg_retransmits;
+  CGMSStatsMsg.report_latency_present_case = CGMSSTATS__REPORT_LATENCY_PRESENT_REPORT_LATENCY;
+  CGMSStatsMsg.reportlatency = stats.metrics_report_latency;
+  CGMSStatsMsg.report_latency_max_present_case = CGMSSTATS__REPORT_LATENCY_MAX_PRESENT_REPORT_LATENCY_MAX;
+  CGMSStatsMsg.reportlatencymax = stats.metrics_report_latency_max;
+
+  rv = csmptlv_write(buf, len, tlvid, (ProtobufCMessage *)&CGMSStatsMsg);
+  if (rv == 0) {
+    EPRINTF("csmpagent_cgmsStats: csmptlv_write error!\n");
+    return -1;
+  }
+  DPRINTF("csmpagent_cgmsStats: csmptlv_write [%ld] bytes to buffer!\n", rv);
+  return rv;
+}
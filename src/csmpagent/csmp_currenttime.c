@@ -32,7 +32,7 @@ int csmp_get_currenttime(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvind
   CurrentTime CurrentTimeMsg = CURRENT_TIME__INIT;
 
   Current_Time *current_time = NULL;
-  current_time = g_csmptlvs_get(tlvid, &num);
+  current_time = csmp_provider_get(tlvid, &num);
 
   if(current_time) {
     if(current_time->has_posix) {
@@ -51,7 +51,7 @@ int csmp_get_currenttime(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvind
 
   rv = csmptlv_write(buf, len, tlvid, (ProtobufCMessage *)&CurrentTimeMsg);
   if (rv == 0) {
-    DPRINTF("csmpagent_currenttime: csmptlv_write error!\n");
+    EPRINTF("csmpagent_currenttime: csmptlv_write error!\n");
     return -1;
   } else {
     DPRINTF("csmpagent_currenttime: csmptlv_write [%ld] bytes to buffer!\n", rv);
@@ -101,7 +101,7 @@ int csmp_put_currenttime(tlvid_t tlvid, const uint8_t *buf, size_t len, uint8_t
     current_time.source = CurrentTimeMsg->source;
   }
 
-  g_csmptlvs_post(tlvid, &current_time);
+  csmp_provider_post(tlvid, &current_time);
 
   DPRINTF("Processed POST %s TLV with size=%d\n", CurrentTimeMsg->base.descriptor->short_name, used);
 
@@ -46,7 +46,7 @@ int csmp_get_deviceid(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex)
 
   rv = csmptlv_write(buf, len, tlvid, (ProtobufCMessage *)&DeviceIDMsg);
   if (rv == 0) {
-    DPRINTF("csmpagent_deviceid: csmptlv_write error!\n");
+    EPRINTF("csmpagent_deviceid: csmptlv_write error!\n");
     return -1;
   } else {
     DPRINTF("csmpagent_deviceid: csmptlv_write [%ld] bytes to buffer!\n", rv);
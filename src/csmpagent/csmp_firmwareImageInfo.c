@@ -19,84 +19,153 @@
 #include "csmptlv.h"
 #include "csmpagent.h"
 #include "csmpfunction.h"
+#include "imageslot.h"
 #include "CsmpTlvs.pb-c.h"
 
-int csmp_get_firmwareImageInfo(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex)
+static size_t write_image_info(tlvid_t tlvid, uint8_t *buf, size_t len,
+                               Firmware_Image_Info *firmware_image_info)
 {
-  size_t rv = 0;
-  uint32_t num;
-
-  (void)tlvindex; // Suppress unused param warning.
-  DPRINTF("csmpagent_firmwareImageInfo: start working.\n");
-
   FirmwareImageInfo FirmwareImageInfoMsg = FIRMWARE_IMAGE_INFO__INIT;
   HardwareInfo HardwareInfoMsg = HARDWARE_INFO__INIT;
 
-  Firmware_Image_Info *firmware_image_info = NULL;
-  firmware_image_info = g_csmptlvs_get(tlvid, &num);
-
-  if(firmware_image_info) {
-    if(firmware_image_info->has_index) {
-      FirmwareImageInfoMsg.index_present_case = FIRMWARE_IMAGE_INFO__INDEX_PRESENT_INDEX;
-      FirmwareImageInfoMsg.index = firmware_image_info->index;
-    }
-    if(firmware_image_info->has_filehash) {
-      FirmwareImageInfoMsg.file_hash_present_case = FIRMWARE_IMAGE_INFO__FILE_HASH_PRESENT_FILE_HASH;
-      FirmwareImageInfoMsg.filehash.len = firmware_image_info->filehash.len;
-      FirmwareImageInfoMsg.filehash.data = firmware_image_info->filehash.data;
-    }
-   if(firmware_image_info->has_filename) {
-      FirmwareImageInfoMsg.file_name_present_case = FIRMWARE_IMAGE_INFO__FILE_NAME_PRESENT_FILE_NAME;
-      FirmwareImageInfoMsg.filename = firmware_image_info->filename;
-    }
-   if(firmware_image_info->has_version) {
-      FirmwareImageInfoMsg.version_present_case = FIRMWARE_IMAGE_INFO__VERSION_PRESENT_VERSION;
-      FirmwareImageInfoMsg.version = firmware_image_info->version;
-    }
-   if(firmware_image_info->has_filesize) {
-      FirmwareImageInfoMsg.file_size_present_case = FIRMWARE_IMAGE_INFO__FILE_SIZE_PRESENT_FILE_SIZE;
-      FirmwareImageInfoMsg.filesize = firmware_image_info->filesize;
-    }
-    if(firmware_image_info->has_blocksize) {
-      FirmwareImageInfoMsg.block_size_present_case = FIRMWARE_IMAGE_INFO__BLOCK_SIZE_PRESENT_BLOCK_SIZE;
-      FirmwareImageInfoMsg.blocksize = firmware_image_info->blocksize;
-    }
-    if(firmware_image_info->has_bitmap) {
-      FirmwareImageInfoMsg.bitmap_present_case = FIRMWARE_IMAGE_INFO__BITMAP_PRESENT_BITMAP;
-      FirmwareImageInfoMsg.bitmap.len = firmware_image_info->bitmap.len;
-      FirmwareImageInfoMsg.bitmap.data = firmware_image_info->bitmap.data;
-    }
-    if(firmware_image_info->has_isdefault) {
-      FirmwareImageInfoMsg.is_default_present_case = FIRMWARE_IMAGE_INFO__IS_DEFAULT_PRESENT_IS_DEFAULT;
-      FirmwareImageInfoMsg.isdefault = firmware_image_info->isdefault;
+  if(firmware_image_info->has_index) {
+    FirmwareImageInfoMsg.index_present_case = FIRMWARE_IMAGE_INFO__INDEX_PRESENT_INDEX;
+    FirmwareImageInfoMsg.index = firmware_image_info->index;
+  }
+  if(firmware_image_info->has_filehash) {
+    FirmwareImageInfoMsg.file_hash_present_case = FIRMWARE_IMAGE_INFO__FILE_HASH_PRESENT_FILE_HASH;
+    FirmwareImageInfoMsg.filehash.len = firmware_image_info->filehash.len;
+    FirmwareImageInfoMsg.filehash.data = firmware_image_info->filehash.data;
+  }
+  if(firmware_image_info->has_filename) {
+    FirmwareImageInfoMsg.file_name_present_case = FIRMWARE_IMAGE_INFO__FILE_NAME_PRESENT_FILE_NAME;
+    FirmwareImageInfoMsg.filename = firmware_image_info->filename;
+  }
+  if(firmware_image_info->has_version) {
+    FirmwareImageInfoMsg.version_present_case = FIRMWARE_IMAGE_INFO__VERSION_PRESENT_VERSION;
+    FirmwareImageInfoMsg.version = firmware_image_info->version;
+  }
+  if(firmware_image_info->has_filesize) {
+    FirmwareImageInfoMsg.file_size_present_case = FIRMWARE_IMAGE_INFO__FILE_SIZE_PRESENT_FILE_SIZE;
+    FirmwareImageInfoMsg.filesize = firmware_image_info->filesize;
+  }
+  if(firmware_image_info->has_blocksize) {
+    FirmwareImageInfoMsg.block_size_present_case = FIRMWARE_IMAGE_INFO__BLOCK_SIZE_PRESENT_BLOCK_SIZE;
+    FirmwareImageInfoMsg.blocksize = firmware_image_info->blocksize;
+  }
+  if(firmware_image_info->has_bitmap) {
+    FirmwareImageInfoMsg.bitmap_present_case = FIRMWARE_IMAGE_INFO__BITMAP_PRESENT_BITMAP;
+    FirmwareImageInfoMsg.bitmap.len = firmware_image_info->bitmap.len;
+    FirmwareImageInfoMsg.bitmap.data = firmware_image_info->bitmap.data;
+  }
+  if(firmware_image_info->has_isdefault) {
+    FirmwareImageInfoMsg.is_default_present_case = FIRMWARE_IMAGE_INFO__IS_DEFAULT_PRESENT_IS_DEFAULT;
+    FirmwareImageInfoMsg.isdefault = firmware_image_info->isdefault;
+  }
+  if(firmware_image_info->has_isrunning) {
+    FirmwareImageInfoMsg.is_running_present_case = FIRMWARE_IMAGE_INFO__IS_RUNNING_PRESENT_IS_RUNNING;
+    FirmwareImageInfoMsg.isrunning = firmware_image_info->isrunning;
+  }
+  if(firmware_image_info->has_loadtime) {
+    FirmwareImageInfoMsg.load_time_present_case = FIRMWARE_IMAGE_INFO__LOAD_TIME_PRESENT_LOAD_TIME;
+    FirmwareImageInfoMsg.loadtime = firmware_image_info->loadtime;
+  }
+  if(firmware_image_info->has_hwinfo) {
+    FirmwareImageInfoMsg.hwinfo = &HardwareInfoMsg;
+    if(firmware_image_info->hwinfo.has_hwid) {
+      HardwareInfoMsg.hw_id_present_case = HARDWARE_INFO__HW_ID_PRESENT_HW_ID;
+      HardwareInfoMsg.hwid = firmware_image_info->hwinfo.hwid;
     }
-    if(firmware_image_info->has_isrunning) {
-      FirmwareImageInfoMsg.is_running_present_case = FIRMWARE_IMAGE_INFO__IS_RUNNING_PRESENT_IS_RUNNING;
-      FirmwareImageInfoMsg.isrunning = firmware_image_info->isrunning;
+    if(firmware_image_info->hwinfo.has_vendorhwid) {
+      HardwareInfoMsg.vendor_hw_id_present_case = HARDWARE_INFO__VENDOR_HW_ID_PRESENT_VENDOR_HW_ID;
+      HardwareInfoMsg.vendorhwid = firmware_image_info->hwinfo.vendorhwid;
     }
-    if(firmware_image_info->has_loadtime) {
-      FirmwareImageInfoMsg.load_time_present_case = FIRMWARE_IMAGE_INFO__LOAD_TIME_PRESENT_LOAD_TIME;
-      FirmwareImageInfoMsg.loadtime = firmware_image_info->loadtime;
+  }
+
+  return csmptlv_write(buf, len, tlvid, (ProtobufCMessage *)&FirmwareImageInfoMsg);
+}
+
+/* the image being received, with the blocks received so far in the bitmap */
+static size_t write_slot_info(tlvid_t tlvid, uint8_t *buf, size_t len,
+                              const imageslot_info_t *info)
+{
+  FirmwareImageInfo FirmwareImageInfoMsg = FIRMWARE_IMAGE_INFO__INIT;
+  HardwareInfo HardwareInfoMsg = HARDWARE_INFO__INIT;
+  uint32_t bitmap_len;
+
+  FirmwareImageInfoMsg.index_present_case = FIRMWARE_IMAGE_INFO__INDEX_PRESENT_INDEX;
+  FirmwareImageInfoMsg.index = IMAGE_SLOT_INDEX;
+  FirmwareImageInfoMsg.file_hash_present_case = FIRMWARE_IMAGE_INFO__FILE_HASH_PRESENT_FILE_HASH;
+  FirmwareImageInfoMsg.filehash.len = info->hashlen;
+  FirmwareImageInfoMsg.filehash.data = (uint8_t *)info->filehash;
+  if (info->filename[0]) {
+    FirmwareImageInfoMsg.file_name_present_case = FIRMWARE_IMAGE_INFO__FILE_NAME_PRESENT_FILE_NAME;
+    FirmwareImageInfoMsg.filename = (char *)info->filename;
+  }
+  if (info->version[0]) {
+    FirmwareImageInfoMsg.version_present_case = FIRMWARE_IMAGE_INFO__VERSION_PRESENT_VERSION;
+    FirmwareImageInfoMsg.version = (char *)info->version;
+  }
+  FirmwareImageInfoMsg.file_size_present_case = FIRMWARE_IMAGE_INFO__FILE_SIZE_PRESENT_FILE_SIZE;
+  FirmwareImageInfoMsg.filesize = info->filesize;
+  FirmwareImageInfoMsg.block_size_present_case = FIRMWARE_IMAGE_INFO__BLOCK_SIZE_PRESENT_BLOCK_SIZE;
+  FirmwareImageInfoMsg.blocksize = info->blocksize;
+  FirmwareImageInfoMsg.bitmap_present_case = FIRMWARE_IMAGE_INFO__BITMAP_PRESENT_BITMAP;
+  FirmwareImageInfoMsg.bitmap.data = (uint8_t *)imageslot_bitmap(&bitmap_len);
+  FirmwareImageInfoMsg.bitmap.len = bitmap_len;
+  FirmwareImageInfoMsg.is_default_present_case = FIRMWARE_IMAGE_INFO__IS_DEFAULT_PRESENT_IS_DEFAULT;
+  FirmwareImageInfoMsg.isdefault = false;
+  FirmwareImageInfoMsg.is_running_present_case = FIRMWARE_IMAGE_INFO__IS_RUNNING_PRESENT_IS_RUNNING;
+  FirmwareImageInfoMsg.isrunning = false;
+  if (info->hwid[0] || info->vendorhwid[0]) {
+    FirmwareImageInfoMsg.hwinfo = &HardwareInfoMsg;
+    if (info->hwid[0]) {
+      HardwareInfoMsg.hw_id_present_case = HARDWARE_INFO__HW_ID_PRESENT_HW_ID;
+      HardwareInfoMsg.hwid = (char *)info->hwid;
     }
-    if(firmware_image_info->has_hwinfo) {
-      FirmwareImageInfoMsg.hwinfo = &HardwareInfoMsg;
-      if(firmware_image_info->hwinfo.has_hwid) {
-        HardwareInfoMsg.hw_id_present_case = HARDWARE_INFO__HW_ID_PRESENT_HW_ID;
-        HardwareInfoMsg.hwid = firmware_image_info->hwinfo.hwid;
-      }
-      if(firmware_image_info->hwinfo.has_vendorhwid) {
-        HardwareInfoMsg.vendor_hw_id_present_case = HARDWARE_INFO__VENDOR_HW_ID_PRESENT_VENDOR_HW_ID;
-        HardwareInfoMsg.vendorhwid = firmware_image_info->hwinfo.vendorhwid;
-      }
+    if (info->vendorhwid[0]) {
+      HardwareInfoMsg.vendor_hw_id_present_case = HARDWARE_INFO__VENDOR_HW_ID_PRESENT_VENDOR_HW_ID;
+      HardwareInfoMsg.vendorhwid = (char *)info->vendorhwid;
     }
+  }
 
-    rv = csmptlv_write(buf, len, tlvid, (ProtobufCMessage *)&FirmwareImageInfoMsg);
+  return csmptlv_write(buf, len, tlvid, (ProtobufCMessage *)&FirmwareImageInfoMsg);
+}
+
+/*
+ * The images reported by the application, with the image being received
+ * in place of the application's IMAGE_SLOT_INDEX entry.
+ */
+int csmp_get_firmwareImageInfo(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex)
+{
+  const imageslot_info_t *info = imageslot_info();
+  Firmware_Image_Info *firmware_image_info = NULL;
+  size_t rv, used = 0;
+  uint32_t num = 0, i;
+
+  (void)tlvindex; // Suppress unused param warning.
+  DPRINTF("csmpagent_firmwareImageInfo: start working.\n");
+
+  firmware_image_info = csmp_provider_get(tlvid, &num);
+  for (i = 0; firmware_image_info && (i < num); i++) {
+    if (info && firmware_image_info[i].has_index && (firmware_image_info[i].index == IMAGE_SLOT_INDEX))
+      continue;
+    rv = write_image_info(tlvid, buf + used, len - used, &firmware_image_info[i]);
+    if (rv == 0) {
+      EPRINTF("csmpagent_firmwareImageInfo: csmptlv_write error!\n");
+      return -1;
+    }
+    used += rv;
+  }
+  if (info) {
+    rv = write_slot_info(tlvid, buf + used, len - used, info);
     if (rv == 0) {
-      DPRINTF("csmpagent_firmwareImageInfo: csmptlv_write error!\n");
+      EPRINTF("csmpagent_firmwareImageInfo: csmptlv_write error!\n");
       return -1;
     }
+    used += rv;
   }
 
-  DPRINTF("csmpagent_firmwareImageInfo: csmptlv_write [%ld] bytes to buffer!\n", rv);
-  return rv;
+  DPRINTF("csmpagent_firmwareImageInfo: csmptlv_write [%ld] bytes to buffer!\n", used);
+  return used;
 }
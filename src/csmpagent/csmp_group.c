@@ -71,7 +71,7 @@ int csmp_get_groupAssign(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvind
 
     rv = csmptlv_write(pbuf, len - used, tlvid, (ProtobufCMessage *)&GroupAssignMsg);
     if(rv == 0) {
-      DPRINTF("csmpagent_groupAssign: csmptlv_write error!\n");
+      EPRINTF("csmpagent_groupAssign: csmptlv_write error!\n");
       return -1;
     }
     pbuf += rv; used += rv;
@@ -144,6 +144,7 @@ int csmp_put_groupMatch(tlvid_t tlvid, const uint8_t *buf, size_t len, uint8_t *
   (void) tlvindex; // Suppress unused param compiler warning.
 
   DPRINTF("Received POST groupMatch TLV\n");
+  m_bLastMatchValid = false;
 
   rv = csmptlv_readTL(pbuf,len,&tlvid0,&tlvlen);
   if ((rv == 0) || (tlvid.type != GROUP_MATCH_TLVID)) {
@@ -171,6 +172,7 @@ int csmp_put_groupMatch(tlvid_t tlvid, const uint8_t *buf, size_t len, uint8_t *
     }
   }
 
+  csmptlv_free((ProtobufCMessage *)GroupMatchMsg);
   return used;
 
 }
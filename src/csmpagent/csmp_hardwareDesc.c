@@ -33,7 +33,7 @@ int csmp_get_hardwareDesc(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvin
   HardwareDesc HardwareDescMsg = HARDWARE_DESC__INIT;
 
   Hardware_Desc *hardware_desc = NULL;
-  hardware_desc = g_csmptlvs_get(tlvid, &num);
+  hardware_desc = csmp_provider_get(tlvid, &num);
 
   if(hardware_desc) {
     if(hardware_desc->has_entphysicalindex) {
@@ -112,7 +112,7 @@ int csmp_get_hardwareDesc(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvin
 
     rv = csmptlv_write(buf, len, tlvid, (ProtobufCMessage *)&HardwareDescMsg);
     if (rv == 0) {
-      DPRINTF("csmpagent_hardwareDesc: csmptlv_write error!\n");
+      EPRINTF("csmpagent_hardwareDesc: csmptlv_write error!\n");
       return -1;
     }
   }
@@ -21,18 +21,18 @@
 #include "csmpfunction.h"
 #include "CsmpTlvs.pb-c.h"
 
-int csmp_get_interfaceDesc(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex)
+int csmp_get_interfaceDesc_rows(tlvid_t tlvid, uint8_t *buf, size_t len,
+                                uint32_t first, uint32_t count, uint32_t *rows)
 {
   size_t rv = 0;
-  uint32_t i, num;
+  uint32_t i = 0, num;
   uint8_t *pbuf = buf;
   uint32_t used = 0;
 
-  (void)tlvindex; // Suppress unused param warning.
   DPRINTF("csmpagent_interfaceDesc: start working.\n");
 
   Interface_Desc *interface_desc = NULL;
-  interface_desc = g_csmptlvs_get(tlvid, &num);
+  interface_desc = csmp_provider_get_rows(tlvid, first, count, &num);
 
   if(interface_desc) {
     for(i = 0; i < num; i++) {
@@ -65,13 +65,24 @@ int csmp_get_interfaceDesc(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvi
 
       rv = csmptlv_write(pbuf, len-used, tlvid, (ProtobufCMessage *)&InterfaceDescMsg);
       if (rv == 0) {
-        DPRINTF("csmpagent_interfaceDesc: csmptlv_write error!\n");
+        if (rows && (i > 0))
+          break;  // The page ends at the last row that fits
+        EPRINTF("csmpagent_interfaceDesc: csmptlv_write error!\n");
         return -1;
       }
       pbuf += rv; used += rv;
     }
   }
+  if (rows)
+    *rows = i;
   DPRINTF("csmpagent_interfaceDesc: csmptlv_write [%u] bytes to buffer!\n", used);
   return used;
 
 }
+
+int csmp_get_interfaceDesc(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex)
+{
+  if (tlvindex < 0)
+    return csmp_get_interfaceDesc_rows(tlvid, buf, len, 0, CSMP_ROWS_ALL, NULL);
+  return csmp_get_interfaceDesc_rows(tlvid, buf, len, tlvindex, 1, NULL);
+}
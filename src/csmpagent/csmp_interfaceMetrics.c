@@ -22,21 +22,33 @@
 #include "csmpfunction.h"
 #include "CsmpTlvs.pb-c.h"
 
-int csmp_get_interfaceMetrics(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex)
+int csmp_get_interfaceMetrics_rows(tlvid_t tlvid, uint8_t *buf, size_t len,
+                                   uint32_t first, uint32_t count, const csmp_filter_t *filter,
+                                   uint32_t *rows)
 {
   size_t rv = 0;
-  uint32_t i, num;
+  uint32_t i, num, skip = 0, cnt = 0;
   uint8_t *pbuf = buf;
   uint32_t used = 0;
 
-  (void)tlvindex; // Suppress unused param warning.
   DPRINTF("csmpagent_interfaceMetrics: start working.\n");
 
   Interface_Metrics *interface_metrics = NULL;
-  interface_metrics = g_csmptlvs_get(tlvid, &num);
+  // A filtered page counts matching rows, so the table is read whole
+  if (filter) {
+    skip = first;
+    first = 0;
+  }
+  interface_metrics = csmp_provider_get_rows(tlvid, first, filter ? CSMP_ROWS_ALL : count, &num);
 
   if(interface_metrics) {
-    for(i = 0; i < num; i++) {
+    for(i = 0; (i < num) && (cnt < count); i++) {
+      if (!csmpfilter_match(filter, &interface_metrics[i]))
+        continue;
+      if (skip > 0) {
+        skip--;
+        continue;
+      }
       InterfaceMetrics InterfaceMetricsMsg = INTERFACE_METRICS__INIT;
 
       if(interface_metrics[i].has_ifindex) {
@@ -90,13 +102,25 @@ int csmp_get_interfaceMetrics(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t t
 
       rv = csmptlv_write(pbuf, len-used, tlvid, (ProtobufCMessage *)&InterfaceMetricsMsg);
       if (rv == 0) {
-        DPRINTF("csmpagent_interfaceMetrics: csmptlv_write error!\n");
+        if (rows && (cnt > 0))
+          break;  // The page ends at the last row that fits
+        EPRINTF("csmpagent_interfaceMetrics: csmptlv_write error!\n");
         return -1;
       }
       pbuf += rv; used += rv;
+      cnt++;
     }
   }
+  if (rows)
+    *rows = cnt;
   DPRINTF("csmpagent_interfaceMetrics: csmptlv_write [%u] bytes to buffer!\n", used);
 
   return used;
 }
+
+int csmp_get_interfaceMetrics(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex)
+{
+  if (tlvindex < 0)
+    return csmp_get_interfaceMetrics_rows(tlvid, buf, len, 0, CSMP_ROWS_ALL, NULL, NULL);
+  return csmp_get_interfaceMetrics_rows(tlvid, buf, len, tlvindex, 1, NULL, NULL);
+}
@@ -21,75 +21,86 @@
 #include "csmpfunction.h"
 #include "CsmpTlvs.pb-c.h"
 
-int csmp_get_ipRoute(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex)
+int csmp_get_ipRoute_rows(tlvid_t tlvid, uint8_t *buf, size_t len,
+                          uint32_t first, uint32_t count, uint32_t *rows)
 {
   size_t rv = 0;
-  uint32_t i, num;
+  uint32_t i = 0, num;
   uint8_t *pbuf = buf;
   uint32_t used = 0;
 
-  (void)tlvindex; // Suppress unused param warning.
   DPRINTF("csmpagent_ipRoute: start working.\n");
 
 
   IP_Route *ip_route = NULL;
-  ip_route = g_csmptlvs_get(tlvid, &num);
+  ip_route = csmp_provider_get_rows(tlvid, first, count, &num);
 
   if(ip_route) {
     for(i = 0; i < num; i++) {
       IPRoute IPRouteMsg = IPROUTE__INIT;
 
-      if(ip_route->has_inetcidrrouteindex) {
+      if(ip_route[i].has_inetcidrrouteindex) {
         IPRouteMsg.inet_cidr_route_index_present_case = IPROUTE__INET_CIDR_ROUTE_INDEX_PRESENT_INET_CIDR_ROUTE_INDEX;
-        IPRouteMsg.inetcidrrouteindex = ip_route->inetcidrrouteindex;
+        IPRouteMsg.inetcidrrouteindex = ip_route[i].inetcidrrouteindex;
       }
-      if(ip_route->has_inetcidrroutedesttype) {
+      if(ip_route[i].has_inetcidrroutedesttype) {
         IPRouteMsg.inet_cidr_route_dest_type_present_case = IPROUTE__INET_CIDR_ROUTE_DEST_TYPE_PRESENT_INET_CIDR_ROUTE_DEST_TYPE;
-        IPRouteMsg.inetcidrroutedesttype = ip_route->inetcidrroutedesttype;
+        IPRouteMsg.inetcidrroutedesttype = ip_route[i].inetcidrroutedesttype;
       }
-      if(ip_route->has_inetcidrroutedest) {
+      if(ip_route[i].has_inetcidrroutedest) {
         IPRouteMsg.inet_cidr_route_dest_present_case = IPROUTE__INET_CIDR_ROUTE_DEST_PRESENT_INET_CIDR_ROUTE_DEST;
-        IPRouteMsg.inetcidrroutedest.len = ip_route->inetcidrroutedest.len;
-        IPRouteMsg.inetcidrroutedest.data = ip_route->inetcidrroutedest.data;
+        IPRouteMsg.inetcidrroutedest.len = ip_route[i].inetcidrroutedest.len;
+        IPRouteMsg.inetcidrroutedest.data = ip_route[i].inetcidrroutedest.data;
       }
-      if(ip_route->has_inetcidrroutepfxlen) {
+      if(ip_route[i].has_inetcidrroutepfxlen) {
         IPRouteMsg.inet_cidr_route_pfx_len_present_case = IPROUTE__INET_CIDR_ROUTE_PFX_LEN_PRESENT_INET_CIDR_ROUTE_PFX_LEN;
-        IPRouteMsg.inetcidrroutepfxlen = ip_route->inetcidrroutepfxlen;
+        IPRouteMsg.inetcidrroutepfxlen = ip_route[i].inetcidrroutepfxlen;
       }
-      if(ip_route->has_inetcidrroutenexthoptype) {
+      if(ip_route[i].has_inetcidrroutenexthoptype) {
         IPRouteMsg.inet_cidr_route_next_hop_type_present_case = IPROUTE__INET_CIDR_ROUTE_NEXT_HOP_TYPE_PRESENT_INET_CIDR_ROUTE_NEXT_HOP_TYPE;
-        IPRouteMsg.inetcidrroutenexthoptype = ip_route->inetcidrroutenexthoptype;
+        IPRouteMsg.inetcidrroutenexthoptype = ip_route[i].inetcidrroutenexthoptype;
       }
-      if(ip_route->has_inetcidrroutenexthop) {
+      if(ip_route[i].has_inetcidrroutenexthop) {
         IPRouteMsg.inet_cidr_route_next_hop_present_case = IPROUTE__INET_CIDR_ROUTE_NEXT_HOP_PRESENT_INET_CIDR_ROUTE_NEXT_HOP;
-        IPRouteMsg.inetcidrroutenexthop.len = ip_route->inetcidrroutenexthop.len;
-        IPRouteMsg.inetcidrroutenexthop.data = ip_route->inetcidrroutenexthop.data;
+        IPRouteMsg.inetcidrroutenexthop.len = ip_route[i].inetcidrroutenexthop.len;
+        IPRouteMsg.inetcidrroutenexthop.data = ip_route[i].inetcidrroutenexthop.data;
       }
-      if(ip_route->has_inetcidrrouteifindex) {
+      if(ip_route[i].has_inetcidrrouteifindex) {
         IPRouteMsg.inet_cidr_route_if_index_present_case = IPROUTE__INET_CIDR_ROUTE_IF_INDEX_PRESENT_INET_CIDR_ROUTE_IF_INDEX;
-        IPRouteMsg.inetcidrrouteifindex = ip_route->inetcidrrouteifindex;
+        IPRouteMsg.inetcidrrouteifindex = ip_route[i].inetcidrrouteifindex;
       }
-      if(ip_route->has_inetcidrroutetype) {
+      if(ip_route[i].has_inetcidrroutetype) {
         IPRouteMsg.inet_cidr_route_type_present_case = IPROUTE__INET_CIDR_ROUTE_TYPE_PRESENT_INET_CIDR_ROUTE_TYPE;
-        IPRouteMsg.inetcidrroutetype = ip_route->inetcidrroutetype;
+        IPRouteMsg.inetcidrroutetype = ip_route[i].inetcidrroutetype;
       }
-      if(ip_route->inetcidrrouteproto) {
+      if(ip_route[i].inetcidrrouteproto) {
         IPRouteMsg.inet_cidr_route_proto_present_case = IPROUTE__INET_CIDR_ROUTE_PROTO_PRESENT_INET_CIDR_ROUTE_PROTO;
-        IPRouteMsg.inetcidrrouteproto = ip_route->inetcidrrouteproto;
+        IPRouteMsg.inetcidrrouteproto = ip_route[i].inetcidrrouteproto;
       }
-      if(ip_route->has_inetcidrrouteage) {
+      if(ip_route[i].has_inetcidrrouteage) {
         IPRouteMsg.inet_cidr_route_age_present_case = IPROUTE__INET_CIDR_ROUTE_AGE_PRESENT_INET_CIDR_ROUTE_AGE;
-        IPRouteMsg.inetcidrrouteage = ip_route->inetcidrrouteage;
+        IPRouteMsg.inetcidrrouteage = ip_route[i].inetcidrrouteage;
       }
 
       rv = csmptlv_write(pbuf, len-used, tlvid, (ProtobufCMessage *)&IPRouteMsg);
       if (rv == 0) {
-        DPRINTF("csmpagent_ipRoute: csmptlv_write error!\n");
+        if (rows && (i > 0))
+          break;  // The page ends at the last row that fits
+        EPRINTF("csmpagent_ipRoute: csmptlv_write error!\n");
         return -1;
       }
       pbuf += rv; used += rv;
     }
   }
+  if (rows)
+    *rows = i;
   DPRINTF("csmpagent_ipRoute: csmptlv_write [%ld] bytes to buffer!\n", rv);
   return used;
 }
+
+int csmp_get_ipRoute(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex)
+{
+  if (tlvindex < 0)
+    return csmp_get_ipRoute_rows(tlvid, buf, len, 0, CSMP_ROWS_ALL, NULL);
+  return csmp_get_ipRoute_rows(tlvid, buf, len, tlvindex, 1, NULL);
+}
@@ -22,83 +22,110 @@
 #include "csmpfunction.h"
 #include "CsmpTlvs.pb-c.h"
 
-int csmp_get_ipRouteRplMetrics(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex)
+int csmp_get_ipRouteRplMetrics_rows(tlvid_t tlvid, uint8_t *buf, size_t len,
+                                    uint32_t first, uint32_t count, const csmp_filter_t *filter,
+                                    uint32_t *rows)
 {
   size_t rv = 0;
-  uint32_t num;
+  uint32_t i, num, skip = 0, cnt = 0;
   uint8_t *pbuf = buf;
   uint32_t used = 0;
 
-  (void)tlvindex; // Suppress unused param warning.
   DPRINTF("csmpagent_ipRouteRplMetrics: start working.\n");
-  IPRouteRPLMetrics IPRouteRPLMetricsMsg = IPROUTE_RPLMETRICS__INIT;
 
   IPRoute_RPLMetrics *iproute_rplmetrics = NULL;
-  iproute_rplmetrics = g_csmptlvs_get(tlvid, &num);
+  // A filtered page counts matching rows, so the table is read whole
+  if (filter) {
+    skip = first;
+    first = 0;
+  }
+  iproute_rplmetrics = csmp_provider_get_rows(tlvid, first, filter ? CSMP_ROWS_ALL : count, &num);
 
   if(iproute_rplmetrics) {
-    if(iproute_rplmetrics->has_inetcidrrouteindex) {
-      IPRouteRPLMetricsMsg.inet_cidr_route_index_present_case = IPROUTE_RPLMETRICS__INET_CIDR_ROUTE_INDEX_PRESENT_INET_CIDR_ROUTE_INDEX;
-      IPRouteRPLMetricsMsg.inetcidrrouteindex = iproute_rplmetrics->inetcidrrouteindex;
-    }
-
-    if(iproute_rplmetrics->has_instanceindex) {
-      IPRouteRPLMetricsMsg.instance_index_present_case = IPROUTE_RPLMETRICS__INSTANCE_INDEX_PRESENT_INSTANCE_INDEX;
-      IPRouteRPLMetricsMsg.instanceindex = iproute_rplmetrics->instanceindex;
-    }
-
-    if(iproute_rplmetrics->has_rank) {
-      IPRouteRPLMetricsMsg.rank_present_case = IPROUTE_RPLMETRICS__RANK_PRESENT_RANK;
-      IPRouteRPLMetricsMsg.rank = iproute_rplmetrics->rank;
-    }
-
-    if(iproute_rplmetrics->has_hops) {
-      IPRouteRPLMetricsMsg.hops_present_case = IPROUTE_RPLMETRICS__HOPS_PRESENT_HOPS;
-      IPRouteRPLMetricsMsg.hops = iproute_rplmetrics->hops;
-    }
-
-    if(iproute_rplmetrics->has_pathetx) {
-      IPRouteRPLMetricsMsg.path_etx_present_case = IPROUTE_RPLMETRICS__PATH_ETX_PRESENT_PATH_ETX;
-      IPRouteRPLMetricsMsg.pathetx = iproute_rplmetrics->pathetx;
-    }
-
-    if(iproute_rplmetrics->has_linketx) {
-      IPRouteRPLMetricsMsg.link_etx_present_case = IPROUTE_RPLMETRICS__LINK_ETX_PRESENT_LINK_ETX;
-      IPRouteRPLMetricsMsg.linketx = iproute_rplmetrics->linketx;
-    }
-
-    if(iproute_rplmetrics->has_rssiforward) {
-      IPRouteRPLMetricsMsg.rssi_forward_present_case = IPROUTE_RPLMETRICS__RSSI_FORWARD_PRESENT_RSSI_FORWARD;
-      IPRouteRPLMetricsMsg.rssiforward = iproute_rplmetrics->rssiforward;
+    for(i = 0; (i < num) && (cnt < count); i++) {
+      if (!csmpfilter_match(filter, &iproute_rplmetrics[i]))
+        continue;
+      if (skip > 0) {
+        skip--;
+        continue;
+      }
+      IPRouteRPLMetrics IPRouteRPLMetricsMsg = IPROUTE_RPLMETRICS__INIT;
+
+      if(iproute_rplmetrics[i].has_inetcidrrouteindex) {
+        IPRouteRPLMetricsMsg.inet_cidr_route_index_present_case = IPROUTE_RPLMETRICS__INET_CIDR_ROUTE_INDEX_PRESENT_INET_CIDR_ROUTE_INDEX;
+        IPRouteRPLMetricsMsg.inetcidrrouteindex = iproute_rplmetrics[i].inetcidrrouteindex;
+      }
+
+      if(iproute_rplmetrics[i].has_instanceindex) {
+        IPRouteRPLMetricsMsg.instance_index_present_case = IPROUTE_RPLMETRICS__INSTANCE_INDEX_PRESENT_INSTANCE_INDEX;
+        IPRouteRPLMetricsMsg.instanceindex = iproute_rplmetrics[i].instanceindex;
+      }
+
+      if(iproute_rplmetrics[i].has_rank) {
+        IPRouteRPLMetricsMsg.rank_present_case = IPROUTE_RPLMETRICS__RANK_PRESENT_RANK;
+        IPRouteRPLMetricsMsg.rank = iproute_rplmetrics[i].rank;
+      }
+
+      if(iproute_rplmetrics[i].has_hops) {
+        IPRouteRPLMetricsMsg.hops_present_case = IPROUTE_RPLMETRICS__HOPS_PRESENT_HOPS;
+        IPRouteRPLMetricsMsg.hops = iproute_rplmetrics[i].hops;
+      }
+
+      if(iproute_rplmetrics[i].has_pathetx) {
+        IPRouteRPLMetricsMsg.path_etx_present_case = IPROUTE_RPLMETRICS__PATH_ETX_PRESENT_PATH_ETX;
+        IPRouteRPLMetricsMsg.pathetx = iproute_rplmetrics[i].pathetx;
+      }
+
+      if(iproute_rplmetrics[i].has_linketx) {
+        IPRouteRPLMetricsMsg.link_etx_present_case = IPROUTE_RPLMETRICS__LINK_ETX_PRESENT_LINK_ETX;
+        IPRouteRPLMetricsMsg.linketx = iproute_rplmetrics[i].linketx;
+      }
+
+      if(iproute_rplmetrics[i].has_rssiforward) {
+        IPRouteRPLMetricsMsg.rssi_forward_present_case = IPROUTE_RPLMETRICS__RSSI_FORWARD_PRESENT_RSSI_FORWARD;
+        IPRouteRPLMetricsMsg.rssiforward = iproute_rplmetrics[i].rssiforward;
+      }
+
+      if(iproute_rplmetrics[i].has_rssireverse) {
+        IPRouteRPLMetricsMsg.rssi_reverse_present_case = IPROUTE_RPLMETRICS__RSSI_REVERSE_PRESENT_RSSI_REVERSE;
+        IPRouteRPLMetricsMsg.rssireverse = iproute_rplmetrics[i].rssireverse;
+      }
+
+      if(iproute_rplmetrics[i].has_lqiforward) {
+        IPRouteRPLMetricsMsg.lqi_forward_present_case = IPROUTE_RPLMETRICS__LQI_FORWARD_PRESENT_LQI_FORWARD;
+        IPRouteRPLMetricsMsg.lqiforward = iproute_rplmetrics[i].lqiforward;
+      }
+
+      if(iproute_rplmetrics[i].has_lqireverse) {
+        IPRouteRPLMetricsMsg.lqi_reverse_present_case = IPROUTE_RPLMETRICS__LQI_REVERSE_PRESENT_LQI_REVERSE;
+        IPRouteRPLMetricsMsg.lqireverse = iproute_rplmetrics[i].lqireverse;
+      }
+
+      if(iproute_rplmetrics[i].has_dagsize) {
+        IPRouteRPLMetricsMsg.dag_size_present_case = IPROUTE_RPLMETRICS__DAG_SIZE_PRESENT_DAG_SIZE;
+        IPRouteRPLMetricsMsg.dagsize = iproute_rplmetrics[i].dagsize;
+      }
+
+      rv = csmptlv_write(pbuf, len-used, tlvid, (ProtobufCMessage *)&IPRouteRPLMetricsMsg);
+      if (rv == 0) {
+        if (rows && (cnt > 0))
+          break;  // The page ends at the last row that fits
+        EPRINTF("csmpagent_ipRouteRplMetrics: csmptlv_write error!\n");
+        return -1;
+      }
+      pbuf += rv; used += rv;
+      cnt++;
     }
-
-    if(iproute_rplmetrics->has_rssireverse) {
-      IPRouteRPLMetricsMsg.rssi_reverse_present_case = IPROUTE_RPLMETRICS__RSSI_REVERSE_PRESENT_RSSI_REVERSE;
-      IPRouteRPLMetricsMsg.rssireverse = iproute_rplmetrics->rssireverse;
-    }
-
-    if(iproute_rplmetrics->has_lqiforward) {
-      IPRouteRPLMetricsMsg.lqi_forward_present_case = IPROUTE_RPLMETRICS__LQI_FORWARD_PRESENT_LQI_FORWARD;
-      IPRouteRPLMetricsMsg.lqiforward = iproute_rplmetrics->lqiforward;
-    }
-
-    if(iproute_rplmetrics->has_lqireverse) {
-      IPRouteRPLMetricsMsg.lqi_reverse_present_case = IPROUTE_RPLMETRICS__LQI_REVERSE_PRESENT_LQI_REVERSE;
-      IPRouteRPLMetricsMsg.lqireverse = iproute_rplmetrics->lqireverse;
-    }
-
-    if(iproute_rplmetrics->has_dagsize) {
-      IPRouteRPLMetricsMsg.dag_size_present_case = IPROUTE_RPLMETRICS__DAG_SIZE_PRESENT_DAG_SIZE;
-      IPRouteRPLMetricsMsg.dagsize = iproute_rplmetrics->dagsize;
-    }
-
-    rv = csmptlv_write(pbuf, len-used, tlvid, (ProtobufCMessage *)&IPRouteRPLMetricsMsg);
-    if (rv == 0) {
-      DPRINTF("csmpagent_ipRouteRplMetrics: csmptlv_write error!\n");
-      return -1;
-    }
-    pbuf += rv; used += rv;
   }
+  if (rows)
+    *rows = cnt;
   DPRINTF("csmpagent_ipRouteRplMetrics: csmptlv_write [%u] bytes to buffer!\n", used);
   return used;
 }
+
+int csmp_get_ipRouteRplMetrics(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex)
+{
+  if (tlvindex < 0)
+    return csmp_get_ipRouteRplMetrics_rows(tlvid, buf, len, 0, CSMP_ROWS_ALL, NULL, NULL);
+  return csmp_get_ipRouteRplMetrics_rows(tlvid, buf, len, tlvindex, 1, NULL, NULL);
+}
@@ -0,0 +1,93 @@
+/*
+ *  Copyright 2021 Cisco Systems, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#include "csmp.h"
+#include "csmpinfo.h"
+#include "csmptlv.h"
+#include "csmpagent.h"
+#include "csmpfunction.h"
+#include "CsmpTlvs.pb-c.h"
+
+int csmp_get_neighbor802154G_rows(tlvid_t tlvid, uint8_t *buf, size_t len,
+                                  uint32_t first, uint32_t count, uint32_t *rows)
+{
+  size_t rv = 0;
+  uint32_t i = 0, num;
+  uint8_t *pbuf = buf;
+  uint32_t used = 0;
+
+  DPRINTF("csmpagent_neighbor802154G: start working.\n");
+
+  Neighbor_802154G *neighbor = NULL;
+  neighbor = csmp_provider_get_rows(tlvid, first, count, &num);
+
+  if(neighbor) {
+    for(i = 0; i < num; i++) {
+      Neighbor802154G NeighborMsg = NEIGHBOR802154_G__INIT;
+
+      if(neighbor[i].has_nbrindex) {
+        NeighborMsg.nbr_index_present_case = NEIGHBOR802154_G__NBR_INDEX_PRESENT_NBR_INDEX;
+        NeighborMsg.nbrindex = neighbor[i].nbrindex;
+      }
+      if(neighbor[i].has_physaddress) {
+        NeighborMsg.phys_address_present_case = NEIGHBOR802154_G__PHYS_ADDRESS_PRESENT_PHYS_ADDRESS;
+        NeighborMsg.physaddress.len = neighbor[i].physaddress.len;
+        NeighborMsg.physaddress.data = neighbor[i].physaddress.data;
+      }
+      if(neighbor[i].has_lastchanged) {
+        NeighborMsg.last_changed_present_case = NEIGHBOR802154_G__LAST_CHANGED_PRESENT_LAST_CHANGED;
+        NeighborMsg.lastchanged = neighbor[i].lastchanged;
+      }
+      if(neighbor[i].has_rssiforward) {
+        NeighborMsg.rssi_forward_present_case = NEIGHBOR802154_G__RSSI_FORWARD_PRESENT_RSSI_FORWARD;
+        NeighborMsg.rssiforward = neighbor[i].rssiforward;
+      }
+      if(neighbor[i].has_rssireverse) {
+        NeighborMsg.rssi_reverse_present_case = NEIGHBOR802154_G__RSSI_REVERSE_PRESENT_RSSI_REVERSE;
+        NeighborMsg.rssireverse = neighbor[i].rssireverse;
+      }
+      if(neighbor[i].has_lqiforward) {
+        NeighborMsg.lqi_forward_present_case = NEIGHBOR802154_G__LQI_FORWARD_PRESENT_LQI_FORWARD;
+        NeighborMsg.lqiforward = neighbor[i].lqiforward;
+      }
+      if(neighbor[i].has_lqireverse) {
+        NeighborMsg.lqi_reverse_present_case = NEIGHBOR802154_G__LQI_REVERSE_PRESENT_LQI_REVERSE;
+        NeighborMsg.lqireverse = neighbor[i].lqireverse;
+      }
+
+      rv = csmptlv_write(pbuf, len-used, tlvid, (ProtobufCMessage *)&NeighborMsg);
+      if (rv == 0) {
+        if (rows && (i > 0))
+          break;  // The page ends at the last row that fits
+        EPRINTF("csmpagent_neighbor802154G: csmptlv_write error!\n");
+        return -1;
+      }
+      pbuf += rv; used += rv;
+    }
+  }
+  if (rows)
+    *rows = i;
+  DPRINTF("csmpagent_neighbor802154G: csmptlv_write [%ld] bytes to buffer!\n", rv);
+  return used;
+}
+
+int csmp_get_neighbor802154G(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex)
+{
+  if (tlvindex < 0)
+    return csmp_get_neighbor802154G_rows(tlvid, buf, len, 0, CSMP_ROWS_ALL, NULL);
+  return csmp_get_neighbor802154G_rows(tlvid, buf, len, tlvindex, 1, NULL);
+}
@@ -0,0 +1,124 @@
+/*
+ *  Copyright 2021 Cisco Systems, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include "csmp.h"
+#include "cgmsagent.h"
+#include "csmptlv.h"
+#include "csmpagent.h"
+#include "csmpfunction.h"
+#include "CsmpTlvs.pb-c.h"
+
+/*
+ * Accepts "[addr]:port", "[addr]" or a bare IPv6 address, optionally
+ * prefixed by "coap://" and followed by a path, which is ignored.
+ */
+static bool parse_nms_url(const char *url, struct sockaddr_in6 *addr)
+{
+  char host[INET6_ADDRSTRLEN];
+  const char *p = url, *end;
+  unsigned long port = CSMP_DEFAULT_PORT;
+  char *endptr;
+  size_t len;
+
+  if (strncmp(p, "coap://", 7) == 0)
+    p += 7;
+
+  if (*p == '[') {
+    end = strchr(++p, ']');
+    if (!end)
+      return false;
+    len = end++ - p;
+    if (*end == ':') {
+      port = strtoul(end + 1, &endptr, 10);
+      if ((endptr == end + 1) || (port == 0) || (port > 65535) ||
+          ((*endptr != '\0') && (*endptr != '/')))
+        return false;
+    }
+    else if ((*end != '\0') && (*end != '/'))
+      return false;
+  }
+  else {
+    end = strchr(p, '/');
+    len = end ? (size_t)(end - p) : strlen(p);
+  }
+
+  if ((len == 0) || (len >= sizeof(host)))
+    return false;
+  memcpy(host, p, len);
+  host[len] = '\0';
+
+  memset(addr, 0, sizeof(*addr));
+  addr->sin6_family = AF_INET6;
+  addr->sin6_port = htons(port);
+  return inet_pton(AF_INET6, host, &addr->sin6_addr) == 1;
+}
+
+/*
+ * Moves the agent to another NMS. Registration with the new NMS starts
+ * at once, or spread over holdTime seconds when one is given.
+ */
+int csmp_put_nmsRedirect(tlvid_t tlvid, const uint8_t *buf, size_t len, uint8_t *out_buf, size_t out_size, size_t *out_len, int32_t tlvindex)
+{
+  NMSRedirectRequest *NMSRedirectMsg = NULL;
+  struct sockaddr_in6 addr;
+  tlvid_t tlvid0;
+  uint32_t tlvlen;
+  uint32_t holdtime = 0;
+  const uint8_t *pbuf = buf;
+  size_t rv;
+  int used = 0;
+
+  (void) tlvid; // Suppress unused param compiler warning.
+  (void) out_buf; // Suppress unused param compiler warning.
+  (void) out_size; // Suppress unused param compiler warning.
+  (void) out_len; // Suppress unused param compiler warning.
+  (void) tlvindex; // Suppress unused param compiler warning.
+
+  DPRINTF("Received POST nmsRedirect TLV\n");
+
+  rv = csmptlv_readTL(pbuf, len, &tlvid0, &tlvlen);
+  if ((rv == 0) || (tlvid0.type != NMSREDIRECT_REQUEST_TLVID)) {
+    return -1;
+  }
+  pbuf += rv; used += rv;
+
+  rv = csmptlv_readV(pbuf, tlvlen, (ProtobufCMessage **)&NMSRedirectMsg, &nmsredirect_request__descriptor);
+  if (rv == 0) {
+    return -1;
+  }
+  pbuf += rv; used += rv;
+
+  if ((NMSRedirectMsg->url_present_case != NMSREDIRECT_REQUEST__URL_PRESENT_URL) ||
+      !parse_nms_url(NMSRedirectMsg->url, &addr)) {
+    WPRINTF("NMSRedirectMsg: invalid url\n");
+    csmptlv_free((ProtobufCMessage *)NMSRedirectMsg);
+    return -1;
+  }
+  if (NMSRedirectMsg->hold_time_present_case == NMSREDIRECT_REQUEST__HOLD_TIME_PRESENT_HOLD_TIME)
+    holdtime = NMSRedirectMsg->holdtime;
+
+  DPRINTF("NMSRedirectMsg: url=%s holdTime=%u\n", NMSRedirectMsg->url, holdtime);
+  cgmsagent_redirect(&addr, holdtime);
+
+  DPRINTF("Processed POST %s TLV with size=%d\n", NMSRedirectMsg->base.descriptor->name, (int)used);
+
+  csmptlv_free((ProtobufCMessage *)NMSRedirectMsg);
+  return used;
+}
@@ -14,7 +14,6 @@
  *  limitations under the License.
  */
 
-#include <stdlib.h>
 #include <string.h>
 #include "csmp.h"
 #include "cgmsagent.h"
@@ -26,54 +25,105 @@
 #define MAX_CNT 15
 #define MAX_LEN 8
 
-csmp_subscription_list_t g_csmplib_report_list;
+csmp_subscription_list_t g_csmplib_report_list[MAX_SUBSCRIPTION_CNT];
 
-int csmp_get_reportSubscribe(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex)
+static int write_subscription(tlvid_t tlvid, uint8_t *buf, size_t len, uint32_t index,
+                              const csmp_subscription_list_t *sub)
 {
   ReportSubscribe ReportSubscribeMsg = REPORT_SUBSCRIBE__INIT;
-  uint32_t i;
-  uint8_t *pbuf = buf;
-  size_t rv, used = 0;
-  char **tlvlist = NULL;
-
-  (void)tlvindex; // Suppress unused param compiler warning.
-  
-  tlvlist = malloc(MAX_CNT * sizeof(void *));
+  uint32_t i, cnt = (sub->cnt < MAX_CNT) ? sub->cnt : MAX_CNT;
+  size_t rv;
+  char tlvstr[MAX_CNT][MAX_LEN];
+  char *tlvlist[MAX_CNT];
 
-  DPRINTF("csmpagent_reportSubscribe: start working.\n");
   ReportSubscribeMsg.interval_present_case = REPORT_SUBSCRIBE__INTERVAL_PRESENT_INTERVAL;
-  ReportSubscribeMsg.interval = g_csmplib_report_list.period;
+  ReportSubscribeMsg.interval = sub->period;
 
-  for (i = 0;i < g_csmplib_report_list.cnt;i++) {
-    tlvlist[i] = malloc(MAX_LEN);
-    csmptlv_id2str(tlvlist[i],MAX_LEN,&g_csmplib_report_list.list[i]);
+  for (i = 0;i < cnt;i++) {
+    csmptlv_id2str(tlvstr[i],MAX_LEN,&sub->list[i]);
+    tlvlist[i] = tlvstr[i];
   }
-  ReportSubscribeMsg.n_tlvid = g_csmplib_report_list.cnt;
+  ReportSubscribeMsg.n_tlvid = cnt;
   ReportSubscribeMsg.tlvid = tlvlist;
+  if (sub->phase_set) {
+    ReportSubscribeMsg.phase_present_case = REPORT_SUBSCRIBE__PHASE_PRESENT_PHASE;
+    ReportSubscribeMsg.phase = sub->phase;
+  }
+  if (index) {
+    ReportSubscribeMsg.index_present_case = REPORT_SUBSCRIBE__INDEX_PRESENT_INDEX;
+    ReportSubscribeMsg.index = index;
+  }
+
+  rv = csmptlv_write(buf,len,tlvid,(ProtobufCMessage *)&ReportSubscribeMsg);
 
-  rv = csmptlv_write(pbuf,len - used,tlvid,(ProtobufCMessage *)&ReportSubscribeMsg);
   if (rv == 0) {
-    DPRINTF("csmpagent_reportSubscribe: csmptlv_write error!\n");
+    EPRINTF("csmpagent_reportSubscribe: csmptlv_write error!\n");
     return -1;
-  } else {
-    DPRINTF("csmpagent_reportSubscribe: csmptlv_write [%ld] bytes to buffer!\n", rv);
   }
+  DPRINTF("csmpagent_reportSubscribe: csmptlv_write [%ld] bytes to buffer!\n", rv);
+  return rv;
+}
 
-  pbuf += rv; used += rv;
+/*
+ * Without an index the default subscription (0) and every other active
+ * subscription are returned, c/13/<index> returns a single subscription.
+ * Each one but the default carries its slot in the index field, so the
+ * default subscription reads back as the standard TLV.
+ */
+int csmp_get_reportSubscribe(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex)
+{
+  uint32_t i, first = 0, last = MAX_SUBSCRIPTION_CNT - 1;
+  uint8_t *pbuf = buf;
+  int rv, used = 0;
+
+  DPRINTF("csmpagent_reportSubscribe: start working.\n");
+
+  if (tlvindex >= MAX_SUBSCRIPTION_CNT)
+    return -1;
+  if (tlvindex >= 0)
+    first = last = tlvindex;
+
+  for (i = first; i <= last; i++) {
+    if ((tlvindex < 0) && (i > 0) && (g_csmplib_report_list[i].period == 0))
+      continue;
 
-  for (i = 0;i < g_csmplib_report_list.cnt;i++)
-    free(tlvlist[i]);
-  free(tlvlist);
+    rv = write_subscription(tlvid, pbuf, len - used, i, &g_csmplib_report_list[i]);
+    if (rv < 0)
+      return -1;
+    pbuf += rv; used += rv;
+  }
 
   return used;
 }
 
+static bool same_list(const csmp_subscription_list_t *sub, const tlvid_t *list, uint32_t cnt)
+{
+  uint32_t i;
+
+  if (sub->cnt != cnt)
+    return false;
+  for (i = 0; i < cnt; i++) {
+    if ((sub->list[i].vendor != list[i].vendor) || (sub->list[i].type != list[i].type))
+      return false;
+  }
+  return true;
+}
+
+/*
+ * The subscription slot is selected by the index of c/13/<index>, or
+ * else by the index field of the TLV. A POST without either updates
+ * the default subscription (0).
+ */
 int csmp_put_reportSubscribe(tlvid_t tlvid, const uint8_t *buf, size_t len, uint8_t *out_buf, size_t out_size, size_t *out_len, int32_t tlvindex)
 {
   ReportSubscribe *ReportSubscribeMsg = NULL;
+  csmp_subscription_list_t *sub;
   tlvid_t tlvid0;
+  tlvid_t newlist[MAX_SUBSCRIBE_LIST_CNT];
   uint32_t tlvlen;
   uint32_t newcnt = 0;
+  uint32_t slot = 0;
+  bool reschedule = false;
   const uint8_t *pbuf = buf;
   size_t rv;
   int used = 0;
@@ -83,7 +133,6 @@ int csmp_put_reportSubscribe(tlvid_t tlvid, const uint8_t *buf, size_t len, uint
   (void) out_buf; // Suppress unused param compiler warning.
   (void) out_size; // Suppress unused param compiler warning.
   (void) out_len; // Suppress unused param compiler warning.
-  (void) tlvindex; // Suppress unused param compiler warning.
 
   DPRINTF("Received POST reportSubscribe TLV\n");
 
@@ -99,18 +148,19 @@ int csmp_put_reportSubscribe(tlvid_t tlvid, const uint8_t *buf, size_t len, uint
   }
   pbuf += rv; used += rv;
 
-  if ((ReportSubscribeMsg->interval_present_case == REPORT_SUBSCRIBE__INTERVAL_PRESENT_INTERVAL) &&
-      (g_csmplib_report_list.period != ReportSubscribeMsg->interval)) {
-    g_csmplib_report_list.period = ReportSubscribeMsg->interval;
-    if (g_csmplib_report_list.period != 0)
-      reset_rpttimer();
-
-    DPRINTF("ReportSubscribeMsg: interval=%u\n",g_csmplib_report_list.period);
+  if (tlvindex >= 0)
+    slot = tlvindex;
+  else if (ReportSubscribeMsg->index_present_case == REPORT_SUBSCRIBE__INDEX_PRESENT_INDEX)
+    slot = ReportSubscribeMsg->index;
+  if (slot >= MAX_SUBSCRIPTION_CNT) {
+    csmptlv_free((ProtobufCMessage *)ReportSubscribeMsg);
+    return -1;
   }
+  sub = &g_csmplib_report_list[slot];
 
-  DPRINTF("ReportSubscribeMsg: n_tlvids=%u tlvid[] = [ ",
-           (uint32_t)ReportSubscribeMsg->n_tlvid);
-  for (i = 0;(i < ReportSubscribeMsg->n_tlvid) && (i < MAX_CNT);i++) {
+  DPRINTF("ReportSubscribeMsg[%u]: n_tlvids=%u tlvid[] = [ ",
+           slot, (uint32_t)ReportSubscribeMsg->n_tlvid);
+  for (i = 0;(i < ReportSubscribeMsg->n_tlvid) && (i < MAX_CNT) && (newcnt < MAX_SUBSCRIBE_LIST_CNT);i++) {
     tlvid_t newid;
     int result;
     result = csmptlv_str2id(ReportSubscribeMsg->tlvid[i],&newid);
@@ -118,16 +168,42 @@ int csmp_put_reportSubscribe(tlvid_t tlvid, const uint8_t *buf, size_t len, uint
     if (result == 0)
       continue;
 
-    if ((g_csmplib_report_list.list[i].vendor != newid.vendor) || (g_csmplib_report_list.list[i].type != newid.type)) {
-      g_csmplib_report_list.list[i] = newid;
-    }
-    newcnt++;
+    newlist[newcnt++] = newid;
   }
   DPRINTF(" ]\n");
-  if (g_csmplib_report_list.cnt != newcnt) {
-    g_csmplib_report_list.cnt = newcnt;
+
+  // A changed list restarts with a full report, the NMS may not know the new TLVs
+  if (!same_list(sub, newlist, newcnt)) {
+    memcpy(sub->list, newlist, newcnt * sizeof(tlvid_t));
+    sub->cnt = newcnt;
+    reschedule = true;
+  }
+
+  if ((ReportSubscribeMsg->interval_present_case == REPORT_SUBSCRIBE__INTERVAL_PRESENT_INTERVAL) &&
+      (sub->period != ReportSubscribeMsg->interval)) {
+    sub->period = ReportSubscribeMsg->interval;
+    reschedule = true;
+
+    DPRINTF("ReportSubscribeMsg[%u]: interval=%u\n",slot,sub->period);
   }
 
+  // Without a phase from the NMS the reports are staggered by EUI-64
+  if (ReportSubscribeMsg->phase_present_case == REPORT_SUBSCRIBE__PHASE_PRESENT_PHASE) {
+    if (!sub->phase_set || (sub->phase != ReportSubscribeMsg->phase))
+      reschedule = true;
+    sub->phase_set = true;
+    sub->phase = ReportSubscribeMsg->phase;
+
+    DPRINTF("ReportSubscribeMsg[%u]: phase=%u\n",slot,sub->phase);
+  }
+  else if (sub->phase_set) {
+    sub->phase_set = false;
+    reschedule = true;
+  }
+
+  if (reschedule)
+    reset_rpttimer(slot);
+
   DPRINTF("Processed POST %s TLV with size=%d\n", ReportSubscribeMsg->base.descriptor->name, (int)used);
 
   csmptlv_free((ProtobufCMessage *)ReportSubscribeMsg);
@@ -33,7 +33,7 @@ int csmp_get_rplInstance(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvind
 
 
   RPL_Instance *rpl_instance = NULL;
-  rpl_instance = g_csmptlvs_get(tlvid, &num);
+  rpl_instance = csmp_provider_get(tlvid, &num);
 
   if(rpl_instance) {
     for(i = 0; i < num; i++) {
@@ -70,7 +70,7 @@ int csmp_get_rplInstance(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvind
       }
       rv = csmptlv_write(pbuf, len-used, tlvid, (ProtobufCMessage *)&RPLInstanceMsg);
       if (rv == 0) {
-        DPRINTF("csmpagent_rplInstance: csmptlv_write error!\n");
+        EPRINTF("csmpagent_rplInstance: csmptlv_write error!\n");
         return -1;
       }
       pbuf += rv; used += rv;
@@ -36,7 +36,7 @@ int csmp_get_sessionID(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex
 
   rv = csmptlv_write(buf, len, tlvid, (ProtobufCMessage *)&gSessionIDVal);
   if (rv == 0) {
-    DPRINTF("csmpagent_sessionID: csmptlv_write error!\n");
+    EPRINTF("csmpagent_sessionID: csmptlv_write error!\n");
     return -1;
   } else {
     DPRINTF("csmpagent_sessionID: csmptlv_write [%ld] bytes to buffer!\n", rv);
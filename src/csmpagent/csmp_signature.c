@@ -21,13 +21,15 @@
 #include "csmpagent.h"
 #include "csmpfunction.h"
 #include "CsmpTlvs.pb-c.h"
+#include "csmplatency.h"
+#include "csmpstats.h"
 
 static Signature g_SigMsg = SIGNATURE__INIT;
 static SignatureValidity g_SigValidityMsg = SIGNATURE_VALIDITY__INIT;
 static uint8_t signature_data[88] = {0};
 
 
-int checkSignature(const uint8_t *buf, uint32_t len) {
+static int verify_signature(const uint8_t *buf, uint32_t len) {
 
 #if 0
   const uint8_t *ptlv;
@@ -72,20 +74,20 @@ int checkSignature(const uint8_t *buf, uint32_t len) {
     sig = g_SigMsg.value.data;
     sigend = g_SigMsg.value.data + g_SigMsg.value.len;
     if (*sig++ != 0x30) {//(ASN1_UNIVERSAL | ASN1_CONSTRUCTED | ASN1_SEQUENCE)
-      g_csmplib_stats.sig_bad_auth++;
+      CSMP_STAT_INC(sig_bad_auth);
       return -1;
     }
     sig++; //total len
 
     if (*sig++ != 0x06) {//(ASN1_UNIVERSAL | ASN1_PRIMITIVE | ASN1_OBJECT_IDENTIFIER)
-      g_csmplib_stats.sig_bad_auth++;
+      CSMP_STAT_INC(sig_bad_auth);
       return -1;
     }
     size_t id_len = *sig++;
     sig += id_len; //object identifier
 
     if (*sig++ != 0x03) {//(ASN1_UNIVERSAL | ASN1_PRIMITIVE | ASN1_BIT_STRING)
-      g_csmplib_stats.sig_bad_auth++;
+      CSMP_STAT_INC(sig_bad_auth);
       return -1;
     }
     sig++; sig++; //len, num of unused bits
@@ -97,16 +99,16 @@ int checkSignature(const uint8_t *buf, uint32_t len) {
       g_SigValidityMsg.has_notafter && (g_SigValidityMsg.notafter >= tv.tv_sec)) {
     if (g_SigMsg.has_value &&
         g_csmplib_signature_verify((uint8_t *)buf,seclen,sig,siglen)) {
-      g_csmplib_stats.sig_ok++;
+      CSMP_STAT_INC(sig_ok);
       return 1;
     }
     else {
-      g_csmplib_stats.sig_bad_auth++;
+      CSMP_STAT_INC(sig_bad_auth);
       return -1;
     }
   }
   else {
-    g_csmplib_stats.sig_bad_validity++;
+    CSMP_STAT_INC(sig_bad_validity);
     DPRINTF("CsmpServer: invalid time \n");
     return -1;
   }
@@ -119,6 +121,14 @@ int checkSignature(const uint8_t *buf, uint32_t len) {
 #endif
 }
 
+int checkSignature(const uint8_t *buf, uint32_t len) {
+  uint64_t start = csmplatency_start();
+  int rv = verify_signature(buf, len);
+
+  csmplatency_record(CSMP_LATENCY_SIGNATURE, 0, start);
+  return rv;
+}
+
 int csmp_put_signature(tlvid_t tlvid, const uint8_t *buf, size_t len, uint8_t *out_buf, size_t out_size, size_t *out_len, int32_t tlvindex)
 {
   Signature *SignatureMsg = NULL;
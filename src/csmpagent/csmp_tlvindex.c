@@ -22,7 +22,7 @@
 #include "csmptlv.h"
 #include "CsmpTlvs.pb-c.h"
 
-#define NUM_TLVS 17
+#define NUM_TLVS 21
 static char *ptlvs[NUM_TLVS] = {
   TLV_INDEX_ID_STRING,
   DEVICE_ID_ID_STRING,
@@ -40,8 +40,12 @@ static char *ptlvs[NUM_TLVS] = {
   INTERFACE_METRICS_ID_STRING,
   IPROUTE_RPLMETRICS_ID_STRING,
   WPANSTATUS_ID_STRING,
+  NEIGHBOR802154_G_ID_STRING,
   RPLINSTANCE_ID_STRING,
-  FIRMWARE_IMAGE_INFO_ID_STRING
+  FIRMWARE_IMAGE_INFO_ID_STRING,
+  CGMSSETTINGS_ID_STRING,
+  CGMSSTATUS_ID_STRING,
+  CGMSSTATS_ID_STRING
 };
 
 int csmp_get_tlvindex(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex)
@@ -56,7 +60,7 @@ int csmp_get_tlvindex(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex)
 
   rv = csmptlv_write(buf, len, tlvid, (ProtobufCMessage *)&TlvIndexMsg);
   if (rv == 0) {
-    DPRINTF("csmpagent_tlvindex: csmptlv_write error!\n");
+    EPRINTF("csmpagent_tlvindex: csmptlv_write error!\n");
     return -1;
   } else {
     DPRINTF("csmpagent_tlvindex: csmptlv_write [%ld] bytes to buffer!\n", rv);
@@ -0,0 +1,330 @@
+/*
+ *  Copyright 2021 Cisco Systems, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "csmp.h"
+#include "csmpinfo.h"
+#include "csmptlv.h"
+#include "csmpagent.h"
+#include "csmpfunction.h"
+#include "imageslot.h"
+#include "CsmpTlvs.pb-c.h"
+
+/*
+ * Firmware transfer. The NMS starts a transfer with a TransferRequest,
+ * then sends the ImageBlocks, usually multicast to a firmware group, and
+ * asks each device for the blocks it is missing by repeating the
+ * TransferRequest with only the fileHash. The TransferResponse lists the
+ * missing blocks as runs (see imageslot_missing()), so the NMS resends
+ * the union of the runs in the next round. Load, cancel and backup
+ * requests are handed to the application, load and backup only once
+ * the image is complete and its SHA-256 hash matched.
+ */
+
+/* read the request TLV, returns the bytes it takes or 0 */
+static size_t read_request(const uint8_t *buf, size_t len, uint32_t type,
+                           ProtobufCMessage **msg, const ProtobufCMessageDescriptor *desc)
+{
+  tlvid_t tlvid0;
+  uint32_t tlvlen;
+  size_t rv;
+
+  rv = csmptlv_readTL(buf, len, &tlvid0, &tlvlen);
+  if ((rv == 0) || (tlvid0.type != type) || (tlvlen > len - rv))
+    return 0;
+  if (csmptlv_readV(buf + rv, tlvlen, msg, desc) == 0)
+    return 0;
+  return rv + tlvlen;
+}
+
+static bool valid_hash(const ProtobufCBinaryData *hash)
+{
+  return (hash->len > 0) && (hash->len <= sizeof(((imageslot_info_t *)0)->filehash));
+}
+
+/* write the response TLV, when the caller wants one */
+static int write_response(uint32_t type, const ProtobufCMessage *msg,
+                          uint8_t *out_buf, size_t out_size, size_t *out_len)
+{
+  tlvid_t tlvid = {0, type};
+  size_t rv;
+
+  if (!out_buf || !out_len)
+    return 0;
+  rv = csmptlv_write(out_buf, out_size, tlvid, msg);
+  if (rv == 0) {
+    EPRINTF("csmp_transfer: csmptlv_write error!\n");
+    return -1;
+  }
+  *out_len = rv;
+  return 0;
+}
+
+int csmp_put_transferRequest(tlvid_t tlvid, const uint8_t *buf, size_t len, uint8_t *out_buf, size_t out_size, size_t *out_len, int32_t tlvindex)
+{
+  TransferRequest *TransferRequestMsg = NULL;
+  TransferResponse TransferResponseMsg = TRANSFER_RESPONSE__INIT;
+  imageslot_info_t info;
+  uint8_t missing[IMAGE_MISSING_SIZE];
+  uint32_t response = CSMP_IMAGE_OK;
+  int used;
+
+  (void) tlvid; // Suppress unused param compiler warning.
+  (void) tlvindex; // Suppress unused param compiler warning.
+
+  DPRINTF("Received POST transferRequest TLV\n");
+
+  used = read_request(buf, len, TRANSFER_REQUEST_TLVID, (ProtobufCMessage **)&TransferRequestMsg,
+                      &transfer_request__descriptor);
+  if (used == 0) {
+    return -1;
+  }
+
+  if (!TransferRequestMsg->file_hash_present_case || !valid_hash(&TransferRequestMsg->filehash))
+    response = CSMP_IMAGE_BAD_REQUEST;
+  else if (!imageslot_isopen())
+    response = CSMP_IMAGE_NO_SLOT;
+  else if (TransferRequestMsg->file_size_present_case || TransferRequestMsg->block_size_present_case) {
+    // A new transfer, or the same one resumed
+    memset(&info, 0, sizeof(info));
+    info.hashlen = TransferRequestMsg->filehash.len;
+    memcpy(info.filehash, TransferRequestMsg->filehash.data, info.hashlen);
+    info.filesize = TransferRequestMsg->file_size_present_case ? TransferRequestMsg->filesize : 0;
+    info.blocksize = TransferRequestMsg->block_size_present_case ? TransferRequestMsg->blocksize : 0;
+    if (TransferRequestMsg->file_name_present_case)
+      snprintf(info.filename, sizeof(info.filename), "%s", TransferRequestMsg->filename);
+    if (TransferRequestMsg->version_present_case)
+      snprintf(info.version, sizeof(info.version), "%s", TransferRequestMsg->version);
+    if (TransferRequestMsg->hwinfo) {
+      if (TransferRequestMsg->hwinfo->hw_id_present_case)
+        snprintf(info.hwid, sizeof(info.hwid), "%s", TransferRequestMsg->hwinfo->hwid);
+      if (TransferRequestMsg->hwinfo->vendor_hw_id_present_case)
+        snprintf(info.vendorhwid, sizeof(info.vendorhwid), "%s", TransferRequestMsg->hwinfo->vendorhwid);
+    }
+    if ((info.filesize == 0) || (info.blocksize == 0))
+      response = CSMP_IMAGE_BAD_REQUEST;
+    else if (imageslot_start(&info) < 0)
+      response = CSMP_IMAGE_TOO_LARGE;
+  }
+  else if (!imageslot_match(TransferRequestMsg->filehash.data, TransferRequestMsg->filehash.len))
+    response = CSMP_IMAGE_UNKNOWN;
+
+  if (TransferRequestMsg->file_hash_present_case) {
+    TransferResponseMsg.file_hash_present_case = TRANSFER_RESPONSE__FILE_HASH_PRESENT_FILE_HASH;
+    TransferResponseMsg.filehash = TransferRequestMsg->filehash;
+  }
+  TransferResponseMsg.response_present_case = TRANSFER_RESPONSE__RESPONSE_PRESENT_RESPONSE;
+  TransferResponseMsg.response = response;
+  if (response == CSMP_IMAGE_OK) {
+    TransferResponseMsg.missingblocks.len = imageslot_missing(missing, sizeof(missing));
+    if (TransferResponseMsg.missingblocks.len) {
+      TransferResponseMsg.missing_blocks_present_case = TRANSFER_RESPONSE__MISSING_BLOCKS_PRESENT_MISSING_BLOCKS;
+      TransferResponseMsg.missingblocks.data = missing;
+    }
+  }
+  DPRINTF("Processed POST transferRequest TLV, response=%u\n", response);
+
+  if (write_response(TRANSFER_RESPONSE_TLVID, (ProtobufCMessage *)&TransferResponseMsg,
+                     out_buf, out_size, out_len) < 0)
+    used = -1;
+  csmptlv_free((ProtobufCMessage *)TransferRequestMsg);
+  return used;
+}
+
+/*
+ * Blocks of another image, or that do not fit the image, are dropped
+ * without failing the request, so a multicast block reaching a device
+ * with another transfer does not draw an error response.
+ */
+int csmp_put_imageBlock(tlvid_t tlvid, const uint8_t *buf, size_t len, uint8_t *out_buf, size_t out_size, size_t *out_len, int32_t tlvindex)
+{
+  ImageBlock *ImageBlockMsg = NULL;
+  int used, rv;
+
+  (void) tlvid; // Suppress unused param compiler warning.
+  (void) out_buf; // Suppress unused param compiler warning.
+  (void) out_size; // Suppress unused param compiler warning.
+  (void) out_len; // Suppress unused param compiler warning.
+  (void) tlvindex; // Suppress unused param compiler warning.
+
+  used = read_request(buf, len, IMAGE_BLOCK_TLVID, (ProtobufCMessage **)&ImageBlockMsg,
+                      &image_block__descriptor);
+  if (used == 0) {
+    return -1;
+  }
+
+  if (!ImageBlockMsg->file_hash_present_case || !ImageBlockMsg->block_num_present_case ||
+      !ImageBlockMsg->block_data_present_case ||
+      !imageslot_match(ImageBlockMsg->filehash.data, ImageBlockMsg->filehash.len)) {
+    DPRINTF("csmp_put_imageBlock: block of another image dropped\n");
+  }
+  else {
+    rv = imageslot_write(ImageBlockMsg->blocknum, ImageBlockMsg->blockdata.data,
+                         ImageBlockMsg->blockdata.len);
+    if (rv < 0) {
+      DPRINTF("csmp_put_imageBlock: invalid block %u of %u bytes dropped\n",
+              ImageBlockMsg->blocknum, (unsigned)ImageBlockMsg->blockdata.len);
+    }
+  }
+
+  csmptlv_free((ProtobufCMessage *)ImageBlockMsg);
+  return used;
+}
+
+int csmp_put_loadRequest(tlvid_t tlvid, const uint8_t *buf, size_t len, uint8_t *out_buf, size_t out_size, size_t *out_len, int32_t tlvindex)
+{
+  LoadRequest *LoadRequestMsg = NULL;
+  LoadResponse LoadResponseMsg = LOAD_RESPONSE__INIT;
+  Load_Request load_request = LOAD_REQUEST_INIT;
+  uint32_t response = CSMP_IMAGE_OK;
+  int used;
+
+  (void) tlvindex; // Suppress unused param compiler warning.
+
+  DPRINTF("Received POST loadRequest TLV\n");
+
+  used = read_request(buf, len, LOAD_REQUEST_TLVID, (ProtobufCMessage **)&LoadRequestMsg,
+                      &load_request__descriptor);
+  if (used == 0) {
+    return -1;
+  }
+
+  if (!LoadRequestMsg->file_hash_present_case || !valid_hash(&LoadRequestMsg->filehash))
+    response = CSMP_IMAGE_BAD_REQUEST;
+  else if (imageslot_match(LoadRequestMsg->filehash.data, LoadRequestMsg->filehash.len) &&
+           !imageslot_complete())
+    response = CSMP_IMAGE_INCOMPLETE;
+  else if (imageslot_match(LoadRequestMsg->filehash.data, LoadRequestMsg->filehash.len) &&
+           (imageslot_verify() < 0))
+    response = CSMP_IMAGE_BAD_HASH;
+  else {
+    load_request.has_filehash = true;
+    load_request.filehash.len = LoadRequestMsg->filehash.len;
+    memcpy(load_request.filehash.data, LoadRequestMsg->filehash.data, load_request.filehash.len);
+    if (LoadRequestMsg->load_time_present_case) {
+      load_request.has_loadtime = true;
+      load_request.loadtime = LoadRequestMsg->loadtime;
+    }
+    csmp_provider_post(tlvid, &load_request);
+  }
+
+  if (LoadRequestMsg->file_hash_present_case) {
+    LoadResponseMsg.file_hash_present_case = LOAD_RESPONSE__FILE_HASH_PRESENT_FILE_HASH;
+    LoadResponseMsg.filehash = LoadRequestMsg->filehash;
+  }
+  LoadResponseMsg.response_present_case = LOAD_RESPONSE__RESPONSE_PRESENT_RESPONSE;
+  LoadResponseMsg.response = response;
+  DPRINTF("Processed POST loadRequest TLV, response=%u\n", response);
+
+  if (write_response(LOAD_RESPONSE_TLVID, (ProtobufCMessage *)&LoadResponseMsg,
+                     out_buf, out_size, out_len) < 0)
+    used = -1;
+  csmptlv_free((ProtobufCMessage *)LoadRequestMsg);
+  return used;
+}
+
+int csmp_put_cancelLoadRequest(tlvid_t tlvid, const uint8_t *buf, size_t len, uint8_t *out_buf, size_t out_size, size_t *out_len, int32_t tlvindex)
+{
+  CancelLoadRequest *CancelLoadRequestMsg = NULL;
+  CancelLoadResponse CancelLoadResponseMsg = CANCEL_LOAD_RESPONSE__INIT;
+  Cancel_Load_Request cancel_load_request = CANCEL_LOAD_REQUEST_INIT;
+  uint32_t response = CSMP_IMAGE_OK;
+  int used;
+
+  (void) tlvindex; // Suppress unused param compiler warning.
+
+  DPRINTF("Received POST cancelLoadRequest TLV\n");
+
+  used = read_request(buf, len, CANCEL_LOAD_REQUEST_TLVID, (ProtobufCMessage **)&CancelLoadRequestMsg,
+                      &cancel_load_request__descriptor);
+  if (used == 0) {
+    return -1;
+  }
+
+  if (!CancelLoadRequestMsg->file_hash_present_case || !valid_hash(&CancelLoadRequestMsg->filehash))
+    response = CSMP_IMAGE_BAD_REQUEST;
+  else {
+    cancel_load_request.has_filehash = true;
+    cancel_load_request.filehash.len = CancelLoadRequestMsg->filehash.len;
+    memcpy(cancel_load_request.filehash.data, CancelLoadRequestMsg->filehash.data,
+           cancel_load_request.filehash.len);
+    csmp_provider_post(tlvid, &cancel_load_request);
+  }
+
+  if (CancelLoadRequestMsg->file_hash_present_case) {
+    CancelLoadResponseMsg.file_hash_present_case = CANCEL_LOAD_RESPONSE__FILE_HASH_PRESENT_FILE_HASH;
+    CancelLoadResponseMsg.filehash = CancelLoadRequestMsg->filehash;
+  }
+  CancelLoadResponseMsg.response_present_case = CANCEL_LOAD_RESPONSE__RESPONSE_PRESENT_RESPONSE;
+  CancelLoadResponseMsg.response = response;
+  DPRINTF("Processed POST cancelLoadRequest TLV, response=%u\n", response);
+
+  if (write_response(CANCEL_LOAD_RESPONSE_TLVID, (ProtobufCMessage *)&CancelLoadResponseMsg,
+                     out_buf, out_size, out_len) < 0)
+    used = -1;
+  csmptlv_free((ProtobufCMessage *)CancelLoadRequestMsg);
+  return used;
+}
+
+int csmp_put_setBackupRequest(tlvid_t tlvid, const uint8_t *buf, size_t len, uint8_t *out_buf, size_t out_size, size_t *out_len, int32_t tlvindex)
+{
+  SetBackupRequest *SetBackupRequestMsg = NULL;
+  SetBackupResponse SetBackupResponseMsg = SET_BACKUP_RESPONSE__INIT;
+  Set_Backup_Request set_backup_request = SET_BACKUP_REQUEST_INIT;
+  uint32_t response = CSMP_IMAGE_OK;
+  int used;
+
+  (void) tlvindex; // Suppress unused param compiler warning.
+
+  DPRINTF("Received POST setBackupRequest TLV\n");
+
+  used = read_request(buf, len, SET_BACKUP_REQUEST_TLVID, (ProtobufCMessage **)&SetBackupRequestMsg,
+                      &set_backup_request__descriptor);
+  if (used == 0) {
+    return -1;
+  }
+
+  if (!SetBackupRequestMsg->file_hash_present_case || !valid_hash(&SetBackupRequestMsg->filehash))
+    response = CSMP_IMAGE_BAD_REQUEST;
+  else if (imageslot_match(SetBackupRequestMsg->filehash.data, SetBackupRequestMsg->filehash.len) &&
+           !imageslot_complete())
+    response = CSMP_IMAGE_INCOMPLETE;
+  else if (imageslot_match(SetBackupRequestMsg->filehash.data, SetBackupRequestMsg->filehash.len) &&
+           (imageslot_verify() < 0))
+    response = CSMP_IMAGE_BAD_HASH;
+  else {
+    set_backup_request.has_filehash = true;
+    set_backup_request.filehash.len = SetBackupRequestMsg->filehash.len;
+    memcpy(set_backup_request.filehash.data, SetBackupRequestMsg->filehash.data,
+           set_backup_request.filehash.len);
+    csmp_provider_post(tlvid, &set_backup_request);
+  }
+
+  if (SetBackupRequestMsg->file_hash_present_case) {
+    SetBackupResponseMsg.file_hash_present_case = SET_BACKUP_RESPONSE__FILE_HASH_PRESENT_FILE_HASH;
+    SetBackupResponseMsg.filehash = SetBackupRequestMsg->filehash;
+  }
+  SetBackupResponseMsg.response_present_case = SET_BACKUP_RESPONSE__RESPONSE_PRESENT_RESPONSE;
+  SetBackupResponseMsg.response = response;
+  DPRINTF("Processed POST setBackupRequest TLV, response=%u\n", response);
+
+  if (write_response(SET_BACKUP_RESPONSE_TLVID, (ProtobufCMessage *)&SetBackupResponseMsg,
+                     out_buf, out_size, out_len) < 0)
+    used = -1;
+  csmptlv_free((ProtobufCMessage *)SetBackupRequestMsg);
+  return used;
+}
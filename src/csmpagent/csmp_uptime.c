@@ -17,6 +17,7 @@
 #include "csmp.h"
 #include "csmpinfo.h"
 #include "csmpservice.h"
+#include "csmpagent.h"
 #include "csmpfunction.h"
 #include "csmptlv.h"
 #include "CsmpTlvs.pb-c.h"
@@ -32,7 +33,7 @@ int csmp_get_uptime(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex)
   Uptime UptimeMsg = UPTIME__INIT;
 
   Up_Time *up_time = NULL;
-  up_time = g_csmptlvs_get(tlvid, &num);
+  up_time = csmp_provider_get(tlvid, &num);
 
   if(up_time) {
     if(up_time->has_sysuptime) {
@@ -43,7 +44,7 @@ int csmp_get_uptime(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex)
 
   rv = csmptlv_write(buf, len, tlvid,(ProtobufCMessage *)&UptimeMsg);
   if (rv == 0) {
-    DPRINTF("csmpagent_uptime: csmptlv_write error!\n");
+    EPRINTF("csmpagent_uptime: csmptlv_write error!\n");
     return -1;
   } else {
     DPRINTF("csmpagent_uptime: csmptlv_write [%ld] bytes to buffer!\n", rv);
@@ -33,7 +33,7 @@ int csmp_get_wpanStatus(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvinde
 
 
   WPAN_Status *wpan_status = NULL;
-  wpan_status = g_csmptlvs_get(tlvid, &num);
+  wpan_status = csmp_provider_get(tlvid, &num);
 
   if(wpan_status) {
     for(i = 0; i < num; i++) {
@@ -107,7 +107,7 @@ int csmp_get_wpanStatus(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvinde
 
       rv = csmptlv_write(pbuf, len-used, tlvid, (ProtobufCMessage *)&WPANStatusMsg);
       if (rv == 0) {
-        DPRINTF("csmpagent_wpanStatus: csmptlv_write error!\n");
+        EPRINTF("csmpagent_wpanStatus: csmptlv_write error!\n");
         return -1;
       }
       pbuf += rv; used += rv;
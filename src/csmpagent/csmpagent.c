@@ -14,11 +14,25 @@
  *  limitations under the License.
  */
 
+#include <string.h>
 #include "csmp.h"
+#include "csmpinfo.h"
+#include "csmptlv.h"
 #include "csmpagent.h"
 #include "csmpfunction.h"
+#include "csmplatency.h"
 
-int csmpagent_get(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex)
+/* TLVs of the request being answered, copied from the application at once */
+typedef struct {
+  uint32_t depth;  // nested csmp_provider_begin() calls
+  uint32_t cnt;
+  csmp_tlv_slot_t slot[PROVIDER_BATCH_MAX];
+  uint64_t buf[PROVIDER_SNAPSHOT_SIZE / sizeof(uint64_t)];
+} provider_snapshot_t;
+
+static __thread provider_snapshot_t m_snapshot;
+
+static int agent_get(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex)
 {
   switch (tlvid.type) {
     case TLV_INDEX_TLVID:
@@ -66,19 +80,31 @@ int csmpagent_get(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex)
     case WPANSTATUS_TLVID:
       return csmp_get_wpanStatus(tlvid, buf, len, tlvindex);
       break;
+    case NEIGHBOR802154_G_TLVID:
+      return csmp_get_neighbor802154G(tlvid, buf, len, tlvindex);
+      break;
     case RPLINSTANCE_TLVID:
       return csmp_get_rplInstance(tlvid, buf, len, tlvindex);
       break;
     case FIRMWARE_IMAGE_INFO_TLVID:
       return csmp_get_firmwareImageInfo(tlvid, buf, len, tlvindex);
       break;
+    case CGMSSETTINGS_TLVID:
+      return csmp_get_cgmsSettings(tlvid, buf, len, tlvindex);
+      break;
+    case CGMSSTATUS_TLVID:
+      return csmp_get_cgmsStatus(tlvid, buf, len, tlvindex);
+      break;
+    case CGMSSTATS_TLVID:
+      return csmp_get_cgmsStats(tlvid, buf, len, tlvindex);
+      break;
     default:
       DPRINTF("csmpagent_get: doesn't support get option of tlv:%u.%u\n",tlvid.vendor,tlvid.type);
       return 0;
   }
 }
 
-int csmpagent_post(tlvid_t tlvid, const uint8_t *buf, size_t len, uint8_t *out_buf, size_t out_size, size_t *out_len, int32_t tlvindex)
+static int agent_post(tlvid_t tlvid, const uint8_t *buf, size_t len, uint8_t *out_buf, size_t out_size, size_t *out_len, int32_t tlvindex)
 {
   switch (tlvid.type) {
     case CURRENT_TIME_TLVID:
@@ -102,8 +128,315 @@ int csmpagent_post(tlvid_t tlvid, const uint8_t *buf, size_t len, uint8_t *out_b
     case REPORT_SUBSCRIBE_TLVID:
       return csmp_put_reportSubscribe(tlvid, buf, len, out_buf, out_size, out_len, tlvindex);
       break;
+    case CGMSSETTINGS_TLVID:
+      return csmp_put_cgmsSettings(tlvid, buf, len, out_buf, out_size, out_len, tlvindex);
+      break;
+    case NMSREDIRECT_REQUEST_TLVID:
+      return csmp_put_nmsRedirect(tlvid, buf, len, out_buf, out_size, out_len, tlvindex);
+      break;
+    case TRANSFER_REQUEST_TLVID:
+      return csmp_put_transferRequest(tlvid, buf, len, out_buf, out_size, out_len, tlvindex);
+      break;
+    case IMAGE_BLOCK_TLVID:
+      return csmp_put_imageBlock(tlvid, buf, len, out_buf, out_size, out_len, tlvindex);
+      break;
+    case LOAD_REQUEST_TLVID:
+      return csmp_put_loadRequest(tlvid, buf, len, out_buf, out_size, out_len, tlvindex);
+      break;
+    case CANCEL_LOAD_REQUEST_TLVID:
+      return csmp_put_cancelLoadRequest(tlvid, buf, len, out_buf, out_size, out_len, tlvindex);
+      break;
+    case SET_BACKUP_REQUEST_TLVID:
+      return csmp_put_setBackupRequest(tlvid, buf, len, out_buf, out_size, out_len, tlvindex);
+      break;
     default:
       DPRINTF("csmpagent_get: doesn't support post option of tlv:%u.%u\n",tlvid.vendor,tlvid.type);
       return 0;
   }
 }
+
+int csmpagent_get(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex)
+{
+  uint64_t start = csmplatency_start();
+  int rv = agent_get(tlvid, buf, len, tlvindex);
+
+  csmplatency_record(CSMP_LATENCY_HANDLER_GET, tlvid.type, start);
+  return rv;
+}
+
+bool csmpagent_has_rows(tlvid_t tlvid)
+{
+  if (tlvid.vendor != 0)
+    return false;
+  switch (tlvid.type) {
+    case INTERFACE_DESC_TLVID:
+    case IPADDRESS_TLVID:
+    case IPROUTE_TLVID:
+    case INTERFACE_METRICS_TLVID:
+    case IPROUTE_RPLMETRICS_TLVID:
+    case NEIGHBOR802154_G_TLVID:
+      return true;
+  }
+  return false;
+}
+
+int csmpagent_get_rows(tlvid_t tlvid, uint8_t *buf, size_t len, uint32_t first, uint32_t count,
+                       const csmp_filter_t *filter, uint32_t *rows)
+{
+  uint64_t start = csmplatency_start();
+  int rv;
+
+  *rows = 0;
+  switch (tlvid.type) {
+    case INTERFACE_DESC_TLVID:
+      rv = csmp_get_interfaceDesc_rows(tlvid, buf, len, first, count, rows);
+      break;
+    case IPADDRESS_TLVID:
+      rv = csmp_get_ipAddress_rows(tlvid, buf, len, first, count, rows);
+      break;
+    case IPROUTE_TLVID:
+      rv = csmp_get_ipRoute_rows(tlvid, buf, len, first, count, rows);
+      break;
+    case INTERFACE_METRICS_TLVID:
+      rv = csmp_get_interfaceMetrics_rows(tlvid, buf, len, first, count, filter, rows);
+      break;
+    case IPROUTE_RPLMETRICS_TLVID:
+      rv = csmp_get_ipRouteRplMetrics_rows(tlvid, buf, len, first, count, filter, rows);
+      break;
+    case NEIGHBOR802154_G_TLVID:
+      rv = csmp_get_neighbor802154G_rows(tlvid, buf, len, first, count, rows);
+      break;
+    default:
+      // Not served by row, only the whole TLV can be asked for
+      if ((first != 0) || (count != CSMP_ROWS_ALL) || filter)
+        return -1;
+      rv = agent_get(tlvid, buf, len, -1);
+      break;
+  }
+  csmplatency_record(CSMP_LATENCY_HANDLER_GET, tlvid.type, start);
+  return rv;
+}
+
+int csmpagent_get_block(tlvid_t tlvid, uint8_t *buf, size_t size, csmp_cursor_t *cursor, bool *more)
+{
+  static __thread uint8_t rowbuf[BLOCK_ROWS_SIZE];
+  uint32_t rows, num, tlvlen, off = 0, row = 0, end;
+  size_t hdr;
+  tlvid_t id;
+  int rv;
+
+  *more = false;
+
+  // Only the rows overlapping the block are read and encoded, a TLV not
+  // served by row is encoded whole and skip is its offset
+  rv = csmpagent_get_rows(tlvid, rowbuf, sizeof(rowbuf), cursor->row, CSMP_ROWS_ALL, NULL, &rows);
+  if ((rv < 0) || ((uint32_t)rv < cursor->skip))
+    return -1;
+  end = ((uint32_t)rv - cursor->skip > size) ? cursor->skip + size : (uint32_t)rv;
+  memcpy(buf, rowbuf + cursor->skip, end - cursor->skip);
+
+  if ((uint32_t)rv > end)
+    *more = true;
+  else if (rows && csmp_provider_get_rows(tlvid, cursor->row + rows, 1, &num)) {
+    DPRINTF("csmpagent: %u.%u row %u does not fit a block\n", tlvid.vendor, tlvid.type,
+            cursor->row + rows);
+    return -1;
+  }
+  if (!csmpagent_has_rows(tlvid)) {
+    rv = end - cursor->skip;
+    cursor->skip = end;
+    return rv;
+  }
+
+  // The next block starts in the row holding its first byte
+  while (off < end) {
+    hdr = csmptlv_readTL(rowbuf + off, rv - off, &id, &tlvlen);
+    if ((hdr == 0) || (off + hdr + tlvlen > end))
+      break;
+    off += hdr + tlvlen;
+    row++;
+  }
+  rv = end - cursor->skip;
+  cursor->row += row;
+  cursor->skip = end - off;
+  return rv;
+}
+
+int csmpagent_post(tlvid_t tlvid, const uint8_t *buf, size_t len, uint8_t *out_buf, size_t out_size, size_t *out_len, int32_t tlvindex)
+{
+  uint64_t start = csmplatency_start();
+  int rv = agent_post(tlvid, buf, len, out_buf, out_size, out_len, tlvindex);
+
+  csmplatency_record(CSMP_LATENCY_HANDLER_POST, tlvid.type, start);
+  return rv;
+}
+
+/* size of the application data of a TLV, 0 if the library answers it itself */
+static size_t provider_size(uint32_t type, bool *table)
+{
+  *table = true;
+  switch (type) {
+    case INTERFACE_DESC_TLVID:
+      return sizeof(Interface_Desc);
+    case IPADDRESS_TLVID:
+      return sizeof(IP_Address);
+    case IPROUTE_TLVID:
+      return sizeof(IP_Route);
+    case INTERFACE_METRICS_TLVID:
+      return sizeof(Interface_Metrics);
+    case IPROUTE_RPLMETRICS_TLVID:
+      return sizeof(IPRoute_RPLMetrics);
+    case NEIGHBOR802154_G_TLVID:
+      return sizeof(Neighbor_802154G);
+    case RPLINSTANCE_TLVID:
+      return sizeof(RPL_Instance);
+    case FIRMWARE_IMAGE_INFO_TLVID:
+      return sizeof(Firmware_Image_Info);
+  }
+  *table = false;
+  switch (type) {
+    case HARDWARE_DESC_TLVID:
+      return sizeof(Hardware_Desc);
+    case CURRENT_TIME_TLVID:
+      return sizeof(Current_Time);
+    case UPTIME_TLVID:
+      return sizeof(Up_Time);
+    case WPANSTATUS_TLVID:
+      return sizeof(WPAN_Status);
+  }
+  return 0;
+}
+
+static size_t align8(size_t len)
+{
+  return (len + 7) & ~(size_t)7;
+}
+
+uint32_t csmp_provider_begin(const tlvid_t *list, uint32_t cnt)
+{
+  provider_snapshot_t *snap = &m_snapshot;
+  csmp_tlv_slot_t *slot;
+  size_t size[PROVIDER_BATCH_MAX], used = 0, share;
+  bool table[PROVIDER_BATCH_MAX];
+  uint32_t i, j, tables = 0, gen;
+  uint64_t start;
+
+  if (snap->depth++ || (g_csmptlvs_get_batch == NULL))
+    return 0;
+
+  // Every TLV gets one instance, tables share what is left
+  snap->cnt = 0;
+  for (i = 0; (i < cnt) && (snap->cnt < PROVIDER_BATCH_MAX); i++) {
+    j = snap->cnt;
+    if (list[i].vendor != 0)
+      continue;
+    size[j] = provider_size(list[i].type, &table[j]);
+    if ((size[j] == 0) || (used + align8(size[j]) > sizeof(snap->buf)))
+      continue;
+    snap->slot[j].tlvid = list[i];
+    snap->slot[j].max = 1;
+    used += align8(size[j]);
+    tables += table[j];
+    snap->cnt++;
+  }
+  // A single TLV is consistent with itself, it is read the usual way
+  if (snap->cnt < 2) {
+    snap->cnt = 0;
+    return 0;
+  }
+
+  share = tables ? ((sizeof(snap->buf) - used) / tables) & ~(size_t)7 : 0;
+  used = 0;
+  for (j = 0; j < snap->cnt; j++) {
+    slot = &snap->slot[j];
+    if (table[j])
+      slot->max += share / size[j];
+    slot->data = (uint8_t *)snap->buf + used;
+    slot->num = 0;
+    used += align8(slot->max * size[j]);
+  }
+
+  start = csmplatency_start();
+  gen = g_csmptlvs_get_batch(snap->slot, snap->cnt);
+  csmplatency_record(CSMP_LATENCY_PROVIDER_BATCH, 0, start);
+  DPRINTF("csmpagent: Read %u TLVs at generation %u\n", snap->cnt, gen);
+  return gen;
+}
+
+void csmp_provider_end()
+{
+  if (m_snapshot.depth && (--m_snapshot.depth == 0))
+    m_snapshot.cnt = 0;
+}
+
+/* slot of the current snapshot holding tlvid, NULL if it is not held */
+static csmp_tlv_slot_t *snapshot_slot(tlvid_t tlvid)
+{
+  csmp_tlv_slot_t *slot;
+  uint32_t i;
+
+  for (i = 0; i < m_snapshot.cnt; i++) {
+    slot = &m_snapshot.slot[i];
+    if ((slot->tlvid.vendor == tlvid.vendor) && (slot->tlvid.type == tlvid.type) &&
+        (slot->num <= slot->max))
+      return slot;
+  }
+  return NULL;
+}
+
+void *csmp_provider_get(tlvid_t tlvid, uint32_t *num)
+{
+  csmp_tlv_slot_t *slot = snapshot_slot(tlvid);
+  uint64_t start;
+  void *tlv;
+
+  if (slot) {
+    *num = slot->num;
+    return slot->num ? slot->data : NULL;
+  }
+
+  start = csmplatency_start();
+  tlv = g_csmptlvs_get(tlvid, num);
+
+  csmplatency_record(CSMP_LATENCY_PROVIDER_GET, tlvid.type, start);
+  return tlv;
+}
+
+void *csmp_provider_get_rows(tlvid_t tlvid, uint32_t first, uint32_t max, uint32_t *num)
+{
+  uint8_t *tlv;
+  uint64_t start;
+  size_t size;
+  bool table;
+
+  if (g_csmptlvs_get_rows && !snapshot_slot(tlvid)) {
+    start = csmplatency_start();
+    tlv = g_csmptlvs_get_rows(tlvid, first, max, num);
+    csmplatency_record(CSMP_LATENCY_PROVIDER_GET, tlvid.type, start);
+  }
+  else {
+    // Without the table callback the whole table is read and cut here
+    tlv = csmp_provider_get(tlvid, num);
+    size = provider_size(tlvid.type, &table);
+    if (tlv && (first < *num) && table) {
+      tlv += first * size;
+      *num -= first;
+    }
+    else if (first > 0)
+      tlv = NULL;
+  }
+
+  if (tlv == NULL)
+    *num = 0;
+  else if (*num > max)
+    *num = max;
+  return *num ? tlv : NULL;
+}
+
+void csmp_provider_post(tlvid_t tlvid, void *tlv)
+{
+  uint64_t start = csmplatency_start();
+
+  g_csmptlvs_post(tlvid, tlv);
+  csmplatency_record(CSMP_LATENCY_PROVIDER_POST, tlvid.type, start);
+}
@@ -20,6 +20,7 @@
 #include <sys/types.h>
 #include <netinet/in.h>
 #include "csmpservice.h"
+#include "csmpfilter.h"
 
 /*! \file
  *
@@ -39,6 +40,64 @@
  */
 int csmpagent_get(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex);
 
+/** \brief every row from the first on, as the count of csmpagent_get_rows() */
+#define CSMP_ROWS_ALL (0xFFFFFFFF)
+
+/**
+ * @brief check whether a TLV is served by row
+ *
+ * @param tlvid the TLV
+ * @return true if csmpagent_get_rows() serves pages of it
+ */
+bool csmpagent_has_rows(tlvid_t tlvid);
+
+/**
+ * @brief CoAP GET handler for a page of a table TLV
+ *
+ * The page ends early at the last row that fits in buf, a request for
+ * the next page then starts at first plus the rows written. With a
+ * filter, only matching rows are written and counted. TLVs not served
+ * by row, see csmpagent_has_rows(), are only written whole, with rows
+ * set to 0.
+ *
+ * @param tlvid tlvid to be retrieved
+ * @param buf response buffer
+ * @param len response buffer length
+ * @param first first row, counted from 0
+ * @param count most rows to write, CSMP_ROWS_ALL for the rest of the table
+ * @param filter rows to write, NULL for all
+ * @param rows set to the rows written
+ * @return int bytes written, -1 if the first row does not fit or a page
+ *         of a TLV not served by row is asked for
+ */
+int csmpagent_get_rows(tlvid_t tlvid, uint8_t *buf, size_t len, uint32_t first, uint32_t count,
+                       const csmp_filter_t *filter, uint32_t *rows);
+
+/** \brief where a block of a TLV starts, see csmpagent_get_block() */
+typedef struct {
+  uint32_t row;   // row holding the first byte of the block
+  uint32_t skip;  // bytes of that row sent in earlier blocks, of the
+                  // whole TLV when it is not served by row
+} csmp_cursor_t;
+
+/**
+ * @brief CoAP GET handler for a block of a TLV, RFC 7959 Block2
+ *
+ * Rows are encoded from the cursor on, at most BLOCK_ROWS_SIZE bytes
+ * of them, so a table is never encoded whole. A TLV not served by row
+ * is encoded whole for every block and must fit BLOCK_ROWS_SIZE. Every block but the last
+ * is size bytes long and may end inside a row. The cursor is moved to
+ * the start of the next block, a zeroed cursor starts at the first.
+ *
+ * @param tlvid tlvid to be retrieved
+ * @param buf block buffer, size bytes
+ * @param size block size
+ * @param cursor start of the block, moved to the start of the next one
+ * @param more set when another block follows
+ * @return int bytes written, -1 if a row does not fit BLOCK_ROWS_SIZE
+ */
+int csmpagent_get_block(tlvid_t tlvid, uint8_t *buf, size_t size, csmp_cursor_t *cursor, bool *more);
+
 /**
  * @brief coap POST handler, based on tlvid as URL
  *
@@ -53,6 +112,62 @@ int csmpagent_get(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex);
  */
 int csmpagent_post(tlvid_t tlvid, const uint8_t *buf, size_t len, uint8_t *out_buf, size_t out_size, size_t *out_len, int32_t tlvindex);
 
+/**
+ * @brief read the TLVs of a request from the application at once
+ *
+ * With a csmptlvs_get_batch callback, the TLVs in list are copied into
+ * a per thread snapshot that csmp_provider_get() answers from until
+ * csmp_provider_end(), so the values of one request are consistent.
+ * Nested calls share the outermost snapshot.
+ *
+ * @param list the TLVs the request reads
+ * @param cnt number of TLVs in list
+ * @return uint32_t generation reported by the application, 0 without a snapshot
+ */
+uint32_t csmp_provider_begin(const tlvid_t *list, uint32_t cnt);
+
+/**
+ * @brief release the snapshot taken by csmp_provider_begin()
+ */
+void csmp_provider_end();
+
+/**
+ * @brief read a TLV from the application
+ *
+ * Answers from the current snapshot when it holds the TLV, otherwise
+ * calls the csmptlvs_get callback and records its latency.
+ *
+ * @param tlvid the TLV
+ * @param num set to the number of instances returned
+ * @return void* the application's TLV data, NULL if not available
+ */
+void *csmp_provider_get(tlvid_t tlvid, uint32_t *num);
+
+/**
+ * @brief read rows of a table TLV from the application
+ *
+ * Calls the csmptlvs_get_rows callback when the application has one and
+ * the current snapshot does not hold the TLV, otherwise cuts the rows
+ * out of the whole table.
+ *
+ * @param tlvid the TLV
+ * @param first the first row, counted from 0
+ * @param max the most rows wanted
+ * @param num set to the number of rows returned, at most max
+ * @return void* the first row, NULL if there is none
+ */
+void *csmp_provider_get_rows(tlvid_t tlvid, uint32_t first, uint32_t max, uint32_t *num);
+
+/**
+ * @brief hand a TLV to the application
+ *
+ * Calls the csmptlvs_post callback and records its latency.
+ *
+ * @param tlvid the TLV
+ * @param tlv the TLV data
+ */
+void csmp_provider_post(tlvid_t tlvid, void *tlv);
+
 /**
  * @brief check signature
  *
@@ -0,0 +1,168 @@
+/*
+ *  Copyright 2021 Cisco Systems, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <string.h>
+#include "csmp.h"
+#include "csmpinfo.h"
+#include "csmptlv.h"
+#include "csmpfilter.h"
+
+/* a filterable field of a row structure */
+typedef struct {
+  const char *name;
+  uint16_t has;
+  uint16_t offset;
+  bool is_signed;
+} filter_field_t;
+
+#define FIELD(T, f, s) {#f, offsetof(T, has_##f), offsetof(T, f), s}
+
+static const filter_field_t m_interface_metrics[] = {
+  FIELD(Interface_Metrics, ifindex, true),
+  FIELD(Interface_Metrics, ifinspeed, false),
+  FIELD(Interface_Metrics, ifoutspeed, false),
+  FIELD(Interface_Metrics, ifadminstatus, false),
+  FIELD(Interface_Metrics, ifoperstatus, false),
+  FIELD(Interface_Metrics, iflastchange, false),
+  FIELD(Interface_Metrics, ifinoctets, false),
+  FIELD(Interface_Metrics, ifoutoctets, false),
+  FIELD(Interface_Metrics, ifindiscards, false),
+  FIELD(Interface_Metrics, ifinerrors, false),
+  FIELD(Interface_Metrics, ifoutdiscards, false),
+  FIELD(Interface_Metrics, ifouterrors, false),
+  {NULL, 0, 0, false}
+};
+
+static const filter_field_t m_iproute_rplmetrics[] = {
+  FIELD(IPRoute_RPLMetrics, inetcidrrouteindex, true),
+  FIELD(IPRoute_RPLMetrics, instanceindex, true),
+  FIELD(IPRoute_RPLMetrics, rank, true),
+  FIELD(IPRoute_RPLMetrics, hops, true),
+  FIELD(IPRoute_RPLMetrics, pathetx, true),
+  FIELD(IPRoute_RPLMetrics, linketx, true),
+  FIELD(IPRoute_RPLMetrics, rssiforward, true),
+  FIELD(IPRoute_RPLMetrics, rssireverse, true),
+  FIELD(IPRoute_RPLMetrics, lqiforward, true),
+  FIELD(IPRoute_RPLMetrics, lqireverse, true),
+  FIELD(IPRoute_RPLMetrics, dagsize, false),
+  {NULL, 0, 0, false}
+};
+
+static const filter_field_t *filter_fields(uint32_t type) {
+  switch (type) {
+    case INTERFACE_METRICS_TLVID:
+      return m_interface_metrics;
+    case IPROUTE_RPLMETRICS_TLVID:
+      return m_iproute_rplmetrics;
+    default:
+      return NULL;
+  }
+}
+
+/* comparison at the start of str, returns its length, 0 if there is none */
+static size_t filter_op(const char *str, size_t len, csmp_filter_op_t *op) {
+  bool eq = (len > 1) && (str[1] == '=');
+
+  if (len == 0)
+    return 0;
+  switch (str[0]) {
+    case '=':
+      *op = FILTER_EQ;
+      return 1;
+    case '!':
+      *op = FILTER_NE;
+      return eq ? 2 : 0;
+    case '<':
+      *op = eq ? FILTER_LE : FILTER_LT;
+      return eq ? 2 : 1;
+    case '>':
+      *op = eq ? FILTER_GE : FILTER_GT;
+      return eq ? 2 : 1;
+    default:
+      return 0;
+  }
+}
+
+bool csmpfilter_add(csmp_filter_t *filter, uint32_t type, const char *str, size_t len) {
+  const filter_field_t *field = filter_fields(type);
+  csmp_filter_pred_t *pred;
+  size_t name_len = 0, used;
+  uint32_t mag;
+  bool neg;
+
+  if ((field == NULL) || (filter->cnt >= FILTER_PRED_MAX))
+    return false;
+  pred = &filter->pred[filter->cnt];
+
+  while ((name_len < len) && (((str[name_len] >= 'a') && (str[name_len] <= 'z')) ||
+                              ((str[name_len] >= 'A') && (str[name_len] <= 'Z'))))
+    name_len++;
+  for (; field->name; field++) {
+    if ((strlen(field->name) == name_len) && (strncmp(field->name, str, name_len) == 0))
+      break;
+  }
+  if (field->name == NULL)
+    return false;
+
+  used = filter_op(str + name_len, len - name_len, &pred->op);
+  if (used == 0)
+    return false;
+  used += name_len;
+  neg = (used < len) && (str[used] == '-');
+  used += neg;
+  // The whole value must be a number
+  if ((used == len) || (csmptlv_strn2u32(str + used, len - used, &mag) != len - used))
+    return false;
+
+  pred->has = field->has;
+  pred->offset = field->offset;
+  pred->is_signed = field->is_signed;
+  pred->val = neg ? -(int64_t)mag : (int64_t)mag;
+  filter->cnt++;
+  return true;
+}
+
+bool csmpfilter_match(const csmp_filter_t *filter, const void *row) {
+  const csmp_filter_pred_t *pred;
+  const uint8_t *base = row;
+  int64_t v;
+  uint32_t i;
+  bool ok = false;
+
+  if (filter == NULL)
+    return true;
+  for (i = 0; i < filter->cnt; i++) {
+    pred = &filter->pred[i];
+    if (!*(const bool *)(base + pred->has))
+      return false;
+    if (pred->is_signed)
+      v = *(const int32_t *)(base + pred->offset);
+    else
+      v = *(const uint32_t *)(base + pred->offset);
+
+    switch (pred->op) {
+      case FILTER_EQ: ok = (v == pred->val); break;
+      case FILTER_NE: ok = (v != pred->val); break;
+      case FILTER_LT: ok = (v < pred->val); break;
+      case FILTER_LE: ok = (v <= pred->val); break;
+      case FILTER_GT: ok = (v > pred->val); break;
+      case FILTER_GE: ok = (v >= pred->val); break;
+    }
+    if (!ok)
+      return false;
+  }
+  return true;
+}
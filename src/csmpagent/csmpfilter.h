@@ -0,0 +1,83 @@
+/*
+ *  Copyright 2021 Cisco Systems, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef __CSMPFILTER_H
+#define __CSMPFILTER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "csmp.h"
+
+/*! \file
+ *
+ * CSMP row filter
+ *
+ * Predicates of the form <field><op><value>, where op is one of =, !=,
+ * <, <=, > and >=, evaluated over the rows of a table TLV before they
+ * are encoded. All predicates of a filter must hold for a row to match,
+ * and a row without the field never matches.
+ */
+
+/** \brief comparison of a predicate */
+typedef enum {
+  FILTER_EQ,
+  FILTER_NE,
+  FILTER_LT,
+  FILTER_LE,
+  FILTER_GT,
+  FILTER_GE
+} csmp_filter_op_t;
+
+/** \brief one predicate, bound to a field of the row structure */
+typedef struct {
+  uint16_t has;         /**< offset of the has_ flag of the field */
+  uint16_t offset;      /**< offset of the 32-bit field */
+  bool is_signed;       /**< the field is an int32_t */
+  csmp_filter_op_t op;  /**< comparison */
+  int64_t val;          /**< value compared with */
+} csmp_filter_pred_t;
+
+/** \brief predicates that must all hold */
+typedef struct {
+  uint32_t cnt;  /**< predicates in use */
+  csmp_filter_pred_t pred[FILTER_PRED_MAX];  /**< the predicates */
+} csmp_filter_t;
+
+/**
+ * @brief parse a predicate and add it to a filter
+ *
+ * @param filter the filter
+ * @param type the table TLV the filter applies to
+ * @param str the predicate, need not be NUL terminated
+ * @param len length of str
+ * @return true the predicate was added
+ * @return false the TLV has no such field, the predicate does not parse
+ * or the filter is full
+ */
+bool csmpfilter_add(csmp_filter_t *filter, uint32_t type, const char *str, size_t len);
+
+/**
+ * @brief evaluate a filter over a row
+ *
+ * @param filter the filter, NULL matches every row
+ * @param row the row, of the structure of the TLV the filter was built for
+ * @return true every predicate holds
+ * @return false otherwise
+ */
+bool csmpfilter_match(const csmp_filter_t *filter, const void *row);
+
+#endif
@@ -19,6 +19,7 @@
 
 #include <sys/types.h>
 #include <netinet/in.h>
+#include "csmpfilter.h"
 
 int csmp_get_tlvindex(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex);
 int csmp_get_deviceid(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex);
@@ -28,15 +29,33 @@ int csmp_get_groupInfo(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex
 int csmp_get_reportSubscribe(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex);
 int csmp_get_hardwareDesc(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex);
 int csmp_get_interfaceDesc(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex);
+int csmp_get_interfaceDesc_rows(tlvid_t tlvid, uint8_t *buf, size_t len,
+                         uint32_t first, uint32_t count, uint32_t *rows);
 int csmp_get_ipAddress(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex);
+int csmp_get_ipAddress_rows(tlvid_t tlvid, uint8_t *buf, size_t len,
+                         uint32_t first, uint32_t count, uint32_t *rows);
 int csmp_get_ipRoute(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex);
+int csmp_get_ipRoute_rows(tlvid_t tlvid, uint8_t *buf, size_t len,
+                         uint32_t first, uint32_t count, uint32_t *rows);
 int csmp_get_currenttime(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex);
 int csmp_get_uptime(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex);
 int csmp_get_interfaceMetrics(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex);
+int csmp_get_interfaceMetrics_rows(tlvid_t tlvid, uint8_t *buf, size_t len,
+                         uint32_t first, uint32_t count, const csmp_filter_t *filter,
+                         uint32_t *rows);
 int csmp_get_ipRouteRplMetrics(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex);
+int csmp_get_ipRouteRplMetrics_rows(tlvid_t tlvid, uint8_t *buf, size_t len,
+                         uint32_t first, uint32_t count, const csmp_filter_t *filter,
+                         uint32_t *rows);
 int csmp_get_wpanStatus(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex);
+int csmp_get_neighbor802154G(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex);
+int csmp_get_neighbor802154G_rows(tlvid_t tlvid, uint8_t *buf, size_t len,
+                         uint32_t first, uint32_t count, uint32_t *rows);
 int csmp_get_rplInstance(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex);
 int csmp_get_firmwareImageInfo(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex);
+int csmp_get_cgmsSettings(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex);
+int csmp_get_cgmsStatus(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex);
+int csmp_get_cgmsStats(tlvid_t tlvid, uint8_t *buf, size_t len, int32_t tlvindex);
 
 int csmp_put_currenttime(tlvid_t tlvid, const uint8_t *buf, size_t len,
                          uint8_t *out_buf, size_t out_size, size_t *out_len,
@@ -59,5 +78,26 @@ int csmp_put_groupMatch(tlvid_t tlvid, const uint8_t *buf, size_t len,
 int csmp_put_reportSubscribe(tlvid_t tlvid, const uint8_t *buf, size_t len,
                          uint8_t *out_buf, size_t out_size, size_t *out_len,
                          int32_t tlvindex);
+int csmp_put_cgmsSettings(tlvid_t tlvid, const uint8_t *buf, size_t len,
+                         uint8_t *out_buf, size_t out_size, size_t *out_len,
+                         int32_t tlvindex);
+int csmp_put_nmsRedirect(tlvid_t tlvid, const uint8_t *buf, size_t len,
+                         uint8_t *out_buf, size_t out_size, size_t *out_len,
+                         int32_t tlvindex);
+int csmp_put_transferRequest(tlvid_t tlvid, const uint8_t *buf, size_t len,
+                         uint8_t *out_buf, size_t out_size, size_t *out_len,
+                         int32_t tlvindex);
+int csmp_put_imageBlock(tlvid_t tlvid, const uint8_t *buf, size_t len,
+                         uint8_t *out_buf, size_t out_size, size_t *out_len,
+                         int32_t tlvindex);
+int csmp_put_loadRequest(tlvid_t tlvid, const uint8_t *buf, size_t len,
+                         uint8_t *out_buf, size_t out_size, size_t *out_len,
+                         int32_t tlvindex);
+int csmp_put_cancelLoadRequest(tlvid_t tlvid, const uint8_t *buf, size_t len,
+                         uint8_t *out_buf, size_t out_size, size_t *out_len,
+                         int32_t tlvindex);
+int csmp_put_setBackupRequest(tlvid_t tlvid, const uint8_t *buf, size_t len,
+                         uint8_t *out_buf, size_t out_size, size_t *out_len,
+                         int32_t tlvindex);
 
 #endif
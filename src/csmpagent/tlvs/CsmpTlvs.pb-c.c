@@ -997,6 +997,51 @@ void   wpanstatus__free_unpacked
   assert(message->base.descriptor == &wpanstatus__descriptor);
   protobuf_c_message_free_unpacked ((ProtobufCMessage*)message, allocator);
 }
+void   neighbor802154_g__init
+                     (Neighbor802154G         *message)
+{
+  static const Neighbor802154G init_value = NEIGHBOR802154_G__INIT;
+  *message = init_value;
+}
+size_t neighbor802154_g__get_packed_size
+                     (const Neighbor802154G *message)
+{
+  assert(message->base.descriptor == &neighbor802154_g__descriptor);
+  return protobuf_c_message_get_packed_size ((const ProtobufCMessage*)(message));
+}
+size_t neighbor802154_g__pack
+                     (const Neighbor802154G *message,
+                      uint8_t       *out)
+{
+  assert(message->base.descriptor == &neighbor802154_g__descriptor);
+  return protobuf_c_message_pack ((const ProtobufCMessage*)message, out);
+}
+size_t neighbor802154_g__pack_to_buffer
+                     (const Neighbor802154G *message,
+                      ProtobufCBuffer *buffer)
+{
+  assert(message->base.descriptor == &neighbor802154_g__descriptor);
+  return protobuf_c_message_pack_to_buffer ((const ProtobufCMessage*)message, buffer);
+}
+Neighbor802154G *
+       neighbor802154_g__unpack
+                     (ProtobufCAllocator  *allocator,
+                      size_t               len,
+                      const uint8_t       *data)
+{
+  return (Neighbor802154G *)
+     protobuf_c_message_unpack (&neighbor802154_g__descriptor,
+                                allocator, len, data);
+}
+void   neighbor802154_g__free_unpacked
+                     (Neighbor802154G *message,
+                      ProtobufCAllocator *allocator)
+{
+  if(!message)
+    return;
+  assert(message->base.descriptor == &neighbor802154_g__descriptor);
+  protobuf_c_message_free_unpacked ((ProtobufCMessage*)message, allocator);
+}
 void   rplinstance__init
                      (RPLInstance         *message)
 {
@@ -1087,1890 +1132,2958 @@ void   hardware_info__free_unpacked
   assert(message->base.descriptor == &hardware_info__descriptor);
   protobuf_c_message_free_unpacked ((ProtobufCMessage*)message, allocator);
 }
-void   firmware_image_info__init
-                     (FirmwareImageInfo         *message)
+void   transfer_request__init
+                     (TransferRequest         *message)
 {
-  static const FirmwareImageInfo init_value = FIRMWARE_IMAGE_INFO__INIT;
+  static const TransferRequest init_value = TRANSFER_REQUEST__INIT;
   *message = init_value;
 }
-size_t firmware_image_info__get_packed_size
-                     (const FirmwareImageInfo *message)
+size_t transfer_request__get_packed_size
+                     (const TransferRequest *message)
 {
-  assert(message->base.descriptor == &firmware_image_info__descriptor);
+  assert(message->base.descriptor == &transfer_request__descriptor);
   return protobuf_c_message_get_packed_size ((const ProtobufCMessage*)(message));
 }
-size_t firmware_image_info__pack
-                     (const FirmwareImageInfo *message,
+size_t transfer_request__pack
+                     (const TransferRequest *message,
                       uint8_t       *out)
 {
-  assert(message->base.descriptor == &firmware_image_info__descriptor);
+  assert(message->base.descriptor == &transfer_request__descriptor);
   return protobuf_c_message_pack ((const ProtobufCMessage*)message, out);
 }
-size_t firmware_image_info__pack_to_buffer
-                     (const FirmwareImageInfo *message,
+size_t transfer_request__pack_to_buffer
+                     (const TransferRequest *message,
                       ProtobufCBuffer *buffer)
 {
-  assert(message->base.descriptor == &firmware_image_info__descriptor);
+  assert(message->base.descriptor == &transfer_request__descriptor);
   return protobuf_c_message_pack_to_buffer ((const ProtobufCMessage*)message, buffer);
 }
-FirmwareImageInfo *
-       firmware_image_info__unpack
+TransferRequest *
+       transfer_request__unpack
                      (ProtobufCAllocator  *allocator,
                       size_t               len,
                       const uint8_t       *data)
 {
-  return (FirmwareImageInfo *)
-     protobuf_c_message_unpack (&firmware_image_info__descriptor,
+  return (TransferRequest *)
+     protobuf_c_message_unpack (&transfer_request__descriptor,
                                 allocator, len, data);
 }
-void   firmware_image_info__free_unpacked
-                     (FirmwareImageInfo *message,
+void   transfer_request__free_unpacked
+                     (TransferRequest *message,
                       ProtobufCAllocator *allocator)
 {
   if(!message)
     return;
-  assert(message->base.descriptor == &firmware_image_info__descriptor);
+  assert(message->base.descriptor == &transfer_request__descriptor);
   protobuf_c_message_free_unpacked ((ProtobufCMessage*)message, allocator);
 }
-static const ProtobufCFieldDescriptor tlv_index__field_descriptors[1] =
+void   image_block__init
+                     (ImageBlock         *message)
 {
-  {
-    "tlvid",
-    1,
-    PROTOBUF_C_LABEL_REPEATED,
-    PROTOBUF_C_TYPE_STRING,
-    offsetof(TlvIndex, n_tlvid),
-    offsetof(TlvIndex, tlvid),
-    NULL,
-    &protobuf_c_empty_string,
-    0,             /* flags */
-    0,NULL,NULL    /* reserved1,reserved2, etc */
-  },
-};
-static const unsigned tlv_index__field_indices_by_name[] = {
-  0,   /* field[0] = tlvid */
-};
-static const ProtobufCIntRange tlv_index__number_ranges[1 + 1] =
+  static const ImageBlock init_value = IMAGE_BLOCK__INIT;
+  *message = init_value;
+}
+size_t image_block__get_packed_size
+                     (const ImageBlock *message)
 {
-  { 1, 0 },
-  { 0, 1 }
-};
-const ProtobufCMessageDescriptor tlv_index__descriptor =
+  assert(message->base.descriptor == &image_block__descriptor);
+  return protobuf_c_message_get_packed_size ((const ProtobufCMessage*)(message));
+}
+size_t image_block__pack
+                     (const ImageBlock *message,
+                      uint8_t       *out)
 {
-  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
-  "TlvIndex",
-  "TlvIndex",
-  "TlvIndex",
-  "",
-  sizeof(TlvIndex),
-  1,
-  tlv_index__field_descriptors,
-  tlv_index__field_indices_by_name,
-  1,  tlv_index__number_ranges,
-  (ProtobufCMessageInit) tlv_index__init,
-  NULL,NULL,NULL    /* reserved[123] */
-};
-static const ProtobufCFieldDescriptor device_id__field_descriptors[2] =
+  assert(message->base.descriptor == &image_block__descriptor);
+  return protobuf_c_message_pack ((const ProtobufCMessage*)message, out);
+}
+size_t image_block__pack_to_buffer
+                     (const ImageBlock *message,
+                      ProtobufCBuffer *buffer)
 {
-  {
-    "type",
-    1,
-    PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_UINT32,
-    offsetof(DeviceID, type_present_case),
-    offsetof(DeviceID, type),
-    NULL,
-    NULL,
-    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
-    0,NULL,NULL    /* reserved1,reserved2, etc */
-  },
-  {
-    "id",
-    2,
-    PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_STRING,
-    offsetof(DeviceID, id_present_case),
-    offsetof(DeviceID, id),
-    NULL,
-    &protobuf_c_empty_string,
-    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
-    0,NULL,NULL    /* reserved1,reserved2, etc */
-  },
-};
-static const unsigned device_id__field_indices_by_name[] = {
-  1,   /* field[1] = id */
-  0,   /* field[0] = type */
-};
-static const ProtobufCIntRange device_id__number_ranges[1 + 1] =
+  assert(message->base.descriptor == &image_block__descriptor);
+  return protobuf_c_message_pack_to_buffer ((const ProtobufCMessage*)message, buffer);
+}
+ImageBlock *
+       image_block__unpack
+                     (ProtobufCAllocator  *allocator,
+                      size_t               len,
+                      const uint8_t       *data)
 {
-  { 1, 0 },
-  { 0, 2 }
-};
-const ProtobufCMessageDescriptor device_id__descriptor =
+  return (ImageBlock *)
+     protobuf_c_message_unpack (&image_block__descriptor,
+                                allocator, len, data);
+}
+void   image_block__free_unpacked
+                     (ImageBlock *message,
+                      ProtobufCAllocator *allocator)
 {
-  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
-  "DeviceID",
-  "DeviceID",
-  "DeviceID",
-  "",
-  sizeof(DeviceID),
-  2,
-  device_id__field_descriptors,
-  device_id__field_indices_by_name,
-  1,  device_id__number_ranges,
-  (ProtobufCMessageInit) device_id__init,
-  NULL,NULL,NULL    /* reserved[123] */
-};
-static const ProtobufCFieldDescriptor session_id__field_descriptors[1] =
+  if(!message)
+    return;
+  assert(message->base.descriptor == &image_block__descriptor);
+  protobuf_c_message_free_unpacked ((ProtobufCMessage*)message, allocator);
+}
+void   load_request__init
+                     (LoadRequest         *message)
 {
-  {
-    "id",
-    1,
-    PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_STRING,
-    offsetof(SessionID, id_present_case),
-    offsetof(SessionID, id),
-    NULL,
-    &protobuf_c_empty_string,
-    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
-    0,NULL,NULL    /* reserved1,reserved2, etc */
-  },
-};
-static const unsigned session_id__field_indices_by_name[] = {
-  0,   /* field[0] = id */
-};
-static const ProtobufCIntRange session_id__number_ranges[1 + 1] =
+  static const LoadRequest init_value = LOAD_REQUEST__INIT;
+  *message = init_value;
+}
+size_t load_request__get_packed_size
+                     (const LoadRequest *message)
 {
-  { 1, 0 },
-  { 0, 1 }
-};
-const ProtobufCMessageDescriptor session_id__descriptor =
+  assert(message->base.descriptor == &load_request__descriptor);
+  return protobuf_c_message_get_packed_size ((const ProtobufCMessage*)(message));
+}
+size_t load_request__pack
+                     (const LoadRequest *message,
+                      uint8_t       *out)
 {
-  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
-  "SessionID",
-  "SessionID",
-  "SessionID",
-  "",
-  sizeof(SessionID),
-  1,
-  session_id__field_descriptors,
-  session_id__field_indices_by_name,
-  1,  session_id__number_ranges,
-  (ProtobufCMessageInit) session_id__init,
-  NULL,NULL,NULL    /* reserved[123] */
-};
-static const ProtobufCFieldDescriptor description_request__field_descriptors[1] =
+  assert(message->base.descriptor == &load_request__descriptor);
+  return protobuf_c_message_pack ((const ProtobufCMessage*)message, out);
+}
+size_t load_request__pack_to_buffer
+                     (const LoadRequest *message,
+                      ProtobufCBuffer *buffer)
 {
-  {
-    "tlvid",
-    1,
-    PROTOBUF_C_LABEL_REPEATED,
-    PROTOBUF_C_TYPE_STRING,
-    offsetof(DescriptionRequest, n_tlvid),
-    offsetof(DescriptionRequest, tlvid),
-    NULL,
-    &protobuf_c_empty_string,
-    0,             /* flags */
-    0,NULL,NULL    /* reserved1,reserved2, etc */
-  },
-};
-static const unsigned description_request__field_indices_by_name[] = {
-  0,   /* field[0] = tlvid */
-};
-static const ProtobufCIntRange description_request__number_ranges[1 + 1] =
+  assert(message->base.descriptor == &load_request__descriptor);
+  return protobuf_c_message_pack_to_buffer ((const ProtobufCMessage*)message, buffer);
+}
+LoadRequest *
+       load_request__unpack
+                     (ProtobufCAllocator  *allocator,
+                      size_t               len,
+                      const uint8_t       *data)
 {
-  { 1, 0 },
-  { 0, 1 }
-};
-const ProtobufCMessageDescriptor description_request__descriptor =
+  return (LoadRequest *)
+     protobuf_c_message_unpack (&load_request__descriptor,
+                                allocator, len, data);
+}
+void   load_request__free_unpacked
+                     (LoadRequest *message,
+                      ProtobufCAllocator *allocator)
 {
-  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
-  "DescriptionRequest",
-  "DescriptionRequest",
-  "DescriptionRequest",
-  "",
-  sizeof(DescriptionRequest),
-  1,
-  description_request__field_descriptors,
-  description_request__field_indices_by_name,
-  1,  description_request__number_ranges,
-  (ProtobufCMessageInit) description_request__init,
-  NULL,NULL,NULL    /* reserved[123] */
-};
-static const ProtobufCFieldDescriptor report_subscribe__field_descriptors[2] =
+  if(!message)
+    return;
+  assert(message->base.descriptor == &load_request__descriptor);
+  protobuf_c_message_free_unpacked ((ProtobufCMessage*)message, allocator);
+}
+void   cancel_load_request__init
+                     (CancelLoadRequest         *message)
 {
-  {
-    "interval",
-    1,
-    PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_UINT32,
-    offsetof(ReportSubscribe, interval_present_case),
-    offsetof(ReportSubscribe, interval),
-    NULL,
-    NULL,
-    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
-    0,NULL,NULL    /* reserved1,reserved2, etc */
-  },
-  {
-    "tlvid",
-    2,
-    PROTOBUF_C_LABEL_REPEATED,
-    PROTOBUF_C_TYPE_STRING,
-    offsetof(ReportSubscribe, n_tlvid),
+  static const CancelLoadRequest init_value = CANCEL_LOAD_REQUEST__INIT;
+  *message = init_value;
+}
+size_t cancel_load_request__get_packed_size
+                     (const CancelLoadRequest *message)
+{
+  assert(message->base.descriptor == &cancel_load_request__descriptor);
+  return protobuf_c_message_get_packed_size ((const ProtobufCMessage*)(message));
+}
+size_t cancel_load_request__pack
+                     (const CancelLoadRequest *message,
+                      uint8_t       *out)
+{
+  assert(message->base.descriptor == &cancel_load_request__descriptor);
+  return protobuf_c_message_pack ((const ProtobufCMessage*)message, out);
+}
+size_t cancel_load_request__pack_to_buffer
+                     (const CancelLoadRequest *message,
+                      ProtobufCBuffer *buffer)
+{
+  assert(message->base.descriptor == &cancel_load_request__descriptor);
+  return protobuf_c_message_pack_to_buffer ((const ProtobufCMessage*)message, buffer);
+}
+CancelLoadRequest *
+       cancel_load_request__unpack
+                     (ProtobufCAllocator  *allocator,
+                      size_t               len,
+                      const uint8_t       *data)
+{
+  return (CancelLoadRequest *)
+     protobuf_c_message_unpack (&cancel_load_request__descriptor,
+                                allocator, len, data);
+}
+void   cancel_load_request__free_unpacked
+                     (CancelLoadRequest *message,
+                      ProtobufCAllocator *allocator)
+{
+  if(!message)
+    return;
+  assert(message->base.descriptor == &cancel_load_request__descriptor);
+  protobuf_c_message_free_unpacked ((ProtobufCMessage*)message, allocator);
+}
+void   set_backup_request__init
+                     (SetBackupRequest         *message)
+{
+  static const SetBackupRequest init_value = SET_BACKUP_REQUEST__INIT;
+  *message = init_value;
+}
+size_t set_backup_request__get_packed_size
+                     (const SetBackupRequest *message)
+{
+  assert(message->base.descriptor == &set_backup_request__descriptor);
+  return protobuf_c_message_get_packed_size ((const ProtobufCMessage*)(message));
+}
+size_t set_backup_request__pack
+                     (const SetBackupRequest *message,
+                      uint8_t       *out)
+{
+  assert(message->base.descriptor == &set_backup_request__descriptor);
+  return protobuf_c_message_pack ((const ProtobufCMessage*)message, out);
+}
+size_t set_backup_request__pack_to_buffer
+                     (const SetBackupRequest *message,
+                      ProtobufCBuffer *buffer)
+{
+  assert(message->base.descriptor == &set_backup_request__descriptor);
+  return protobuf_c_message_pack_to_buffer ((const ProtobufCMessage*)message, buffer);
+}
+SetBackupRequest *
+       set_backup_request__unpack
+                     (ProtobufCAllocator  *allocator,
+                      size_t               len,
+                      const uint8_t       *data)
+{
+  return (SetBackupRequest *)
+     protobuf_c_message_unpack (&set_backup_request__descriptor,
+                                allocator, len, data);
+}
+void   set_backup_request__free_unpacked
+                     (SetBackupRequest *message,
+                      ProtobufCAllocator *allocator)
+{
+  if(!message)
+    return;
+  assert(message->base.descriptor == &set_backup_request__descriptor);
+  protobuf_c_message_free_unpacked ((ProtobufCMessage*)message, allocator);
+}
+void   transfer_response__init
+                     (TransferResponse         *message)
+{
+  static const TransferResponse init_value = TRANSFER_RESPONSE__INIT;
+  *message = init_value;
+}
+size_t transfer_response__get_packed_size
+                     (const TransferResponse *message)
+{
+  assert(message->base.descriptor == &transfer_response__descriptor);
+  return protobuf_c_message_get_packed_size ((const ProtobufCMessage*)(message));
+}
+size_t transfer_response__pack
+                     (const TransferResponse *message,
+                      uint8_t       *out)
+{
+  assert(message->base.descriptor == &transfer_response__descriptor);
+  return protobuf_c_message_pack ((const ProtobufCMessage*)message, out);
+}
+size_t transfer_response__pack_to_buffer
+                     (const TransferResponse *message,
+                      ProtobufCBuffer *buffer)
+{
+  assert(message->base.descriptor == &transfer_response__descriptor);
+  return protobuf_c_message_pack_to_buffer ((const ProtobufCMessage*)message, buffer);
+}
+TransferResponse *
+       transfer_response__unpack
+                     (ProtobufCAllocator  *allocator,
+                      size_t               len,
+                      const uint8_t       *data)
+{
+  return (TransferResponse *)
+     protobuf_c_message_unpack (&transfer_response__descriptor,
+                                allocator, len, data);
+}
+void   transfer_response__free_unpacked
+                     (TransferResponse *message,
+                      ProtobufCAllocator *allocator)
+{
+  if(!message)
+    return;
+  assert(message->base.descriptor == &transfer_response__descriptor);
+  protobuf_c_message_free_unpacked ((ProtobufCMessage*)message, allocator);
+}
+void   load_response__init
+                     (LoadResponse         *message)
+{
+  static const LoadResponse init_value = LOAD_RESPONSE__INIT;
+  *message = init_value;
+}
+size_t load_response__get_packed_size
+                     (const LoadResponse *message)
+{
+  assert(message->base.descriptor == &load_response__descriptor);
+  return protobuf_c_message_get_packed_size ((const ProtobufCMessage*)(message));
+}
+size_t load_response__pack
+                     (const LoadResponse *message,
+                      uint8_t       *out)
+{
+  assert(message->base.descriptor == &load_response__descriptor);
+  return protobuf_c_message_pack ((const ProtobufCMessage*)message, out);
+}
+size_t load_response__pack_to_buffer
+                     (const LoadResponse *message,
+                      ProtobufCBuffer *buffer)
+{
+  assert(message->base.descriptor == &load_response__descriptor);
+  return protobuf_c_message_pack_to_buffer ((const ProtobufCMessage*)message, buffer);
+}
+LoadResponse *
+       load_response__unpack
+                     (ProtobufCAllocator  *allocator,
+                      size_t               len,
+                      const uint8_t       *data)
+{
+  return (LoadResponse *)
+     protobuf_c_message_unpack (&load_response__descriptor,
+                                allocator, len, data);
+}
+void   load_response__free_unpacked
+                     (LoadResponse *message,
+                      ProtobufCAllocator *allocator)
+{
+  if(!message)
+    return;
+  assert(message->base.descriptor == &load_response__descriptor);
+  protobuf_c_message_free_unpacked ((ProtobufCMessage*)message, allocator);
+}
+void   cancel_load_response__init
+                     (CancelLoadResponse         *message)
+{
+  static const CancelLoadResponse init_value = CANCEL_LOAD_RESPONSE__INIT;
+  *message = init_value;
+}
+size_t cancel_load_response__get_packed_size
+                     (const CancelLoadResponse *message)
+{
+  assert(message->base.descriptor == &cancel_load_response__descriptor);
+  return protobuf_c_message_get_packed_size ((const ProtobufCMessage*)(message));
+}
+size_t cancel_load_response__pack
+                     (const CancelLoadResponse *message,
+                      uint8_t       *out)
+{
+  assert(message->base.descriptor == &cancel_load_response__descriptor);
+  return protobuf_c_message_pack ((const ProtobufCMessage*)message, out);
+}
+size_t cancel_load_response__pack_to_buffer
+                     (const CancelLoadResponse *message,
+                      ProtobufCBuffer *buffer)
+{
+  assert(message->base.descriptor == &cancel_load_response__descriptor);
+  return protobuf_c_message_pack_to_buffer ((const ProtobufCMessage*)message, buffer);
+}
+CancelLoadResponse *
+       cancel_load_response__unpack
+                     (ProtobufCAllocator  *allocator,
+                      size_t               len,
+                      const uint8_t       *data)
+{
+  return (CancelLoadResponse *)
+     protobuf_c_message_unpack (&cancel_load_response__descriptor,
+                                allocator, len, data);
+}
+void   cancel_load_response__free_unpacked
+                     (CancelLoadResponse *message,
+                      ProtobufCAllocator *allocator)
+{
+  if(!message)
+    return;
+  assert(message->base.descriptor == &cancel_load_response__descriptor);
+  protobuf_c_message_free_unpacked ((ProtobufCMessage*)message, allocator);
+}
+void   set_backup_response__init
+                     (SetBackupResponse         *message)
+{
+  static const SetBackupResponse init_value = SET_BACKUP_RESPONSE__INIT;
+  *message = init_value;
+}
+size_t set_backup_response__get_packed_size
+                     (const SetBackupResponse *message)
+{
+  assert(message->base.descriptor == &set_backup_response__descriptor);
+  return protobuf_c_message_get_packed_size ((const ProtobufCMessage*)(message));
+}
+size_t set_backup_response__pack
+                     (const SetBackupResponse *message,
+                      uint8_t       *out)
+{
+  assert(message->base.descriptor == &set_backup_response__descriptor);
+  return protobuf_c_message_pack ((const ProtobufCMessage*)message, out);
+}
+size_t set_backup_response__pack_to_buffer
+                     (const SetBackupResponse *message,
+                      ProtobufCBuffer *buffer)
+{
+  assert(message->base.descriptor == &set_backup_response__descriptor);
+  return protobuf_c_message_pack_to_buffer ((const ProtobufCMessage*)message, buffer);
+}
+SetBackupResponse *
+       set_backup_response__unpack
+                     (ProtobufCAllocator  *allocator,
+                      size_t               len,
+                      const uint8_t       *data)
+{
+  return (SetBackupResponse *)
+     protobuf_c_message_unpack (&set_backup_response__descriptor,
+                                allocator, len, data);
+}
+void   set_backup_response__free_unpacked
+                     (SetBackupResponse *message,
+                      ProtobufCAllocator *allocator)
+{
+  if(!message)
+    return;
+  assert(message->base.descriptor == &set_backup_response__descriptor);
+  protobuf_c_message_free_unpacked ((ProtobufCMessage*)message, allocator);
+}
+void   firmware_image_info__init
+                     (FirmwareImageInfo         *message)
+{
+  static const FirmwareImageInfo init_value = FIRMWARE_IMAGE_INFO__INIT;
+  *message = init_value;
+}
+size_t firmware_image_info__get_packed_size
+                     (const FirmwareImageInfo *message)
+{
+  assert(message->base.descriptor == &firmware_image_info__descriptor);
+  return protobuf_c_message_get_packed_size ((const ProtobufCMessage*)(message));
+}
+size_t firmware_image_info__pack
+                     (const FirmwareImageInfo *message,
+                      uint8_t       *out)
+{
+  assert(message->base.descriptor == &firmware_image_info__descriptor);
+  return protobuf_c_message_pack ((const ProtobufCMessage*)message, out);
+}
+size_t firmware_image_info__pack_to_buffer
+                     (const FirmwareImageInfo *message,
+                      ProtobufCBuffer *buffer)
+{
+  assert(message->base.descriptor == &firmware_image_info__descriptor);
+  return protobuf_c_message_pack_to_buffer ((const ProtobufCMessage*)message, buffer);
+}
+FirmwareImageInfo *
+       firmware_image_info__unpack
+                     (ProtobufCAllocator  *allocator,
+                      size_t               len,
+                      const uint8_t       *data)
+{
+  return (FirmwareImageInfo *)
+     protobuf_c_message_unpack (&firmware_image_info__descriptor,
+                                allocator, len, data);
+}
+void   firmware_image_info__free_unpacked
+                     (FirmwareImageInfo *message,
+                      ProtobufCAllocator *allocator)
+{
+  if(!message)
+    return;
+  assert(message->base.descriptor == &firmware_image_info__descriptor);
+  protobuf_c_message_free_unpacked ((ProtobufCMessage*)message, allocator);
+}
+void   event_report__init
+                     (EventReport         *message)
+{
+  static const EventReport init_value = EVENT_REPORT__INIT;
+  *message = init_value;
+}
+size_t event_report__get_packed_size
+                     (const EventReport *message)
+{
+  assert(message->base.descriptor == &event_report__descriptor);
+  return protobuf_c_message_get_packed_size ((const ProtobufCMessage*)(message));
+}
+size_t event_report__pack
+                     (const EventReport *message,
+                      uint8_t       *out)
+{
+  assert(message->base.descriptor == &event_report__descriptor);
+  return protobuf_c_message_pack ((const ProtobufCMessage*)message, out);
+}
+size_t event_report__pack_to_buffer
+                     (const EventReport *message,
+                      ProtobufCBuffer *buffer)
+{
+  assert(message->base.descriptor == &event_report__descriptor);
+  return protobuf_c_message_pack_to_buffer ((const ProtobufCMessage*)message, buffer);
+}
+EventReport *
+       event_report__unpack
+                     (ProtobufCAllocator  *allocator,
+                      size_t               len,
+                      const uint8_t       *data)
+{
+  return (EventReport *)
+     protobuf_c_message_unpack (&event_report__descriptor,
+                                allocator, len, data);
+}
+void   event_report__free_unpacked
+                     (EventReport *message,
+                      ProtobufCAllocator *allocator)
+{
+  if(!message)
+    return;
+  assert(message->base.descriptor == &event_report__descriptor);
+  protobuf_c_message_free_unpacked ((ProtobufCMessage*)message, allocator);
+}
+void   nmsredirect_request__init
+                     (NMSRedirectRequest         *message)
+{
+  static const NMSRedirectRequest init_value = NMSREDIRECT_REQUEST__INIT;
+  *message = init_value;
+}
+size_t nmsredirect_request__get_packed_size
+                     (const NMSRedirectRequest *message)
+{
+  assert(message->base.descriptor == &nmsredirect_request__descriptor);
+  return protobuf_c_message_get_packed_size ((const ProtobufCMessage*)(message));
+}
+size_t nmsredirect_request__pack
+                     (const NMSRedirectRequest *message,
+                      uint8_t       *out)
+{
+  assert(message->base.descriptor == &nmsredirect_request__descriptor);
+  return protobuf_c_message_pack ((const ProtobufCMessage*)message, out);
+}
+size_t nmsredirect_request__pack_to_buffer
+                     (const NMSRedirectRequest *message,
+                      ProtobufCBuffer *buffer)
+{
+  assert(message->base.descriptor == &nmsredirect_request__descriptor);
+  return protobuf_c_message_pack_to_buffer ((const ProtobufCMessage*)message, buffer);
+}
+NMSRedirectRequest *
+       nmsredirect_request__unpack
+                     (ProtobufCAllocator  *allocator,
+                      size_t               len,
+                      const uint8_t       *data)
+{
+  return (NMSRedirectRequest *)
+     protobuf_c_message_unpack (&nmsredirect_request__descriptor,
+                                allocator, len, data);
+}
+void   nmsredirect_request__free_unpacked
+                     (NMSRedirectRequest *message,
+                      ProtobufCAllocator *allocator)
+{
+  if(!message)
+    return;
+  assert(message->base.descriptor == &nmsredirect_request__descriptor);
+  protobuf_c_message_free_unpacked ((ProtobufCMessage*)message, allocator);
+}
+static const ProtobufCFieldDescriptor tlv_index__field_descriptors[1] =
+{
+  {
+    "tlvid",
+    1,
+    PROTOBUF_C_LABEL_REPEATED,
+    PROTOBUF_C_TYPE_STRING,
+    offsetof(TlvIndex, n_tlvid),
+    offsetof(TlvIndex, tlvid),
+    NULL,
+    &protobuf_c_empty_string,
+    0,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+};
+static const unsigned tlv_index__field_indices_by_name[] = {
+  0,   /* field[0] = tlvid */
+};
+static const ProtobufCIntRange tlv_index__number_ranges[1 + 1] =
+{
+  { 1, 0 },
+  { 0, 1 }
+};
+const ProtobufCMessageDescriptor tlv_index__descriptor =
+{
+  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
+  "TlvIndex",
+  "TlvIndex",
+  "TlvIndex",
+  "",
+  sizeof(TlvIndex),
+  1,
+  tlv_index__field_descriptors,
+  tlv_index__field_indices_by_name,
+  1,  tlv_index__number_ranges,
+  (ProtobufCMessageInit) tlv_index__init,
+  NULL,NULL,NULL    /* reserved[123] */
+};
+static const ProtobufCFieldDescriptor device_id__field_descriptors[2] =
+{
+  {
+    "type",
+    1,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(DeviceID, type_present_case),
+    offsetof(DeviceID, type),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "id",
+    2,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_STRING,
+    offsetof(DeviceID, id_present_case),
+    offsetof(DeviceID, id),
+    NULL,
+    &protobuf_c_empty_string,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+};
+static const unsigned device_id__field_indices_by_name[] = {
+  1,   /* field[1] = id */
+  0,   /* field[0] = type */
+};
+static const ProtobufCIntRange device_id__number_ranges[1 + 1] =
+{
+  { 1, 0 },
+  { 0, 2 }
+};
+const ProtobufCMessageDescriptor device_id__descriptor =
+{
+  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
+  "DeviceID",
+  "DeviceID",
+  "DeviceID",
+  "",
+  sizeof(DeviceID),
+  2,
+  device_id__field_descriptors,
+  device_id__field_indices_by_name,
+  1,  device_id__number_ranges,
+  (ProtobufCMessageInit) device_id__init,
+  NULL,NULL,NULL    /* reserved[123] */
+};
+static const ProtobufCFieldDescriptor session_id__field_descriptors[1] =
+{
+  {
+    "id",
+    1,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_STRING,
+    offsetof(SessionID, id_present_case),
+    offsetof(SessionID, id),
+    NULL,
+    &protobuf_c_empty_string,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+};
+static const unsigned session_id__field_indices_by_name[] = {
+  0,   /* field[0] = id */
+};
+static const ProtobufCIntRange session_id__number_ranges[1 + 1] =
+{
+  { 1, 0 },
+  { 0, 1 }
+};
+const ProtobufCMessageDescriptor session_id__descriptor =
+{
+  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
+  "SessionID",
+  "SessionID",
+  "SessionID",
+  "",
+  sizeof(SessionID),
+  1,
+  session_id__field_descriptors,
+  session_id__field_indices_by_name,
+  1,  session_id__number_ranges,
+  (ProtobufCMessageInit) session_id__init,
+  NULL,NULL,NULL    /* reserved[123] */
+};
+static const ProtobufCFieldDescriptor description_request__field_descriptors[1] =
+{
+  {
+    "tlvid",
+    1,
+    PROTOBUF_C_LABEL_REPEATED,
+    PROTOBUF_C_TYPE_STRING,
+    offsetof(DescriptionRequest, n_tlvid),
+    offsetof(DescriptionRequest, tlvid),
+    NULL,
+    &protobuf_c_empty_string,
+    0,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+};
+static const unsigned description_request__field_indices_by_name[] = {
+  0,   /* field[0] = tlvid */
+};
+static const ProtobufCIntRange description_request__number_ranges[1 + 1] =
+{
+  { 1, 0 },
+  { 0, 1 }
+};
+const ProtobufCMessageDescriptor description_request__descriptor =
+{
+  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
+  "DescriptionRequest",
+  "DescriptionRequest",
+  "DescriptionRequest",
+  "",
+  sizeof(DescriptionRequest),
+  1,
+  description_request__field_descriptors,
+  description_request__field_indices_by_name,
+  1,  description_request__number_ranges,
+  (ProtobufCMessageInit) description_request__init,
+  NULL,NULL,NULL    /* reserved[123] */
+};
+static const ProtobufCFieldDescriptor report_subscribe__field_descriptors[4] =
+{
+  {
+    "interval",
+    1,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(ReportSubscribe, interval_present_case),
+    offsetof(ReportSubscribe, interval),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "tlvid",
+    2,
+    PROTOBUF_C_LABEL_REPEATED,
+    PROTOBUF_C_TYPE_STRING,
+    offsetof(ReportSubscribe, n_tlvid),
     offsetof(ReportSubscribe, tlvid),
     NULL,
-    &protobuf_c_empty_string,
-    0,             /* flags */
+    &protobuf_c_empty_string,
+    0,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "phase",
+    3,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(ReportSubscribe, phase_present_case),
+    offsetof(ReportSubscribe, phase),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "index",
+    4,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(ReportSubscribe, index_present_case),
+    offsetof(ReportSubscribe, index),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+};
+static const unsigned report_subscribe__field_indices_by_name[] = {
+  3,   /* field[3] = index */
+  0,   /* field[0] = interval */
+  2,   /* field[2] = phase */
+  1,   /* field[1] = tlvid */
+};
+static const ProtobufCIntRange report_subscribe__number_ranges[1 + 1] =
+{
+  { 1, 0 },
+  { 0, 4 }
+};
+const ProtobufCMessageDescriptor report_subscribe__descriptor =
+{
+  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
+  "ReportSubscribe",
+  "ReportSubscribe",
+  "ReportSubscribe",
+  "",
+  sizeof(ReportSubscribe),
+  4,
+  report_subscribe__field_descriptors,
+  report_subscribe__field_indices_by_name,
+  1,  report_subscribe__number_ranges,
+  (ProtobufCMessageInit) report_subscribe__init,
+  NULL,NULL,NULL    /* reserved[123] */
+};
+static const ProtobufCFieldDescriptor cgmssettings__field_descriptors[3] =
+{
+  {
+    "regIntervalMin",
+    1,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(CGMSSettings, reg_interval_min_present_case),
+    offsetof(CGMSSettings, regintervalmin),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "regIntervalMax",
+    2,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(CGMSSettings, reg_interval_max_present_case),
+    offsetof(CGMSSettings, regintervalmax),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "regBackoff",
+    3,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(CGMSSettings, reg_backoff_present_case),
+    offsetof(CGMSSettings, regbackoff),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+};
+static const unsigned cgmssettings__field_indices_by_name[] = {
+  2,   /* field[2] = regBackoff */
+  1,   /* field[1] = regIntervalMax */
+  0,   /* field[0] = regIntervalMin */
+};
+static const ProtobufCIntRange cgmssettings__number_ranges[1 + 1] =
+{
+  { 1, 0 },
+  { 0, 3 }
+};
+const ProtobufCMessageDescriptor cgmssettings__descriptor =
+{
+  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
+  "CGMSSettings",
+  "CGMSSettings",
+  "CGMSSettings",
+  "",
+  sizeof(CGMSSettings),
+  3,
+  cgmssettings__field_descriptors,
+  cgmssettings__field_indices_by_name,
+  1,  cgmssettings__number_ranges,
+  (ProtobufCMessageInit) cgmssettings__init,
+  NULL,NULL,NULL    /* reserved[123] */
+};
+static const ProtobufCFieldDescriptor cgmsstatus__field_descriptors[7] =
+{
+  {
+    "registered",
+    1,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_BOOL,
+    offsetof(CGMSStatus, registered_present_case),
+    offsetof(CGMSStatus, registered),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "NMSAddr",
+    2,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_BYTES,
+    offsetof(CGMSStatus, nmsaddr_present_case),
+    offsetof(CGMSStatus, nmsaddr),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "NMSAddrOrigin",
+    3,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(CGMSStatus, nmsaddr_origin_present_case),
+    offsetof(CGMSStatus, nmsaddrorigin),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "lastReg",
+    4,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(CGMSStatus, last_reg_present_case),
+    offsetof(CGMSStatus, lastreg),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "lastRegReason",
+    5,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(CGMSStatus, last_reg_reason_present_case),
+    offsetof(CGMSStatus, lastregreason),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "nextReg",
+    6,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(CGMSStatus, next_reg_present_case),
+    offsetof(CGMSStatus, nextreg),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "NMSCertValid",
+    7,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_BOOL,
+    offsetof(CGMSStatus, nmscert_valid_present_case),
+    offsetof(CGMSStatus, nmscertvalid),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+};
+static const unsigned cgmsstatus__field_indices_by_name[] = {
+  1,   /* field[1] = NMSAddr */
+  2,   /* field[2] = NMSAddrOrigin */
+  6,   /* field[6] = NMSCertValid */
+  3,   /* field[3] = lastReg */
+  4,   /* field[4] = lastRegReason */
+  5,   /* field[5] = nextReg */
+  0,   /* field[0] = registered */
+};
+static const ProtobufCIntRange cgmsstatus__number_ranges[1 + 1] =
+{
+  { 1, 0 },
+  { 0, 7 }
+};
+const ProtobufCMessageDescriptor cgmsstatus__descriptor =
+{
+  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
+  "CGMSStatus",
+  "CGMSStatus",
+  "CGMSStatus",
+  "",
+  sizeof(CGMSStatus),
+  7,
+  cgmsstatus__field_descriptors,
+  cgmsstatus__field_indices_by_name,
+  1,  cgmsstatus__number_ranges,
+  (ProtobufCMessageInit) cgmsstatus__init,
+  NULL,NULL,NULL    /* reserved[123] */
+};
+static const ProtobufCFieldDescriptor cgmsstats__field_descriptors[14] =
+{
+  {
+    "sigOk",
+    1,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(CGMSStats, sig_ok_present_case),
+    offsetof(CGMSStats, sigok),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "sigBadAuth",
+    2,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(CGMSStats, sig_bad_auth_present_case),
+    offsetof(CGMSStats, sigbadauth),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "sigBadValidity",
+    3,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(CGMSStats, sig_bad_validity_present_case),
+    offsetof(CGMSStats, sigbadvalidity),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "sigNoSync",
+    4,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(CGMSStats, sig_no_sync_present_case),
+    offsetof(CGMSStats, signosync),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "regSucceed",
+    5,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(CGMSStats, reg_succeed_present_case),
+    offsetof(CGMSStats, regsucceed),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "regAttempts",
+    6,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(CGMSStats, reg_attempts_present_case),
+    offsetof(CGMSStats, regattempts),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "regHolds",
+    7,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(CGMSStats, reg_holds_present_case),
+    offsetof(CGMSStats, regholds),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "regFails",
+    8,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(CGMSStats, reg_fails_present_case),
+    offsetof(CGMSStats, regfails),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "nmsErrors",
+    9,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(CGMSStats, nms_errors_present_case),
+    offsetof(CGMSStats, nmserrors),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "regRtt",
+    10,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(CGMSStats, reg_rtt_present_case),
+    offsetof(CGMSStats, regrtt),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "regRttMax",
+    11,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(CGMSStats, reg_rtt_max_present_case),
+    offsetof(CGMSStats, regrttmax),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "regRetransmits",
+    12,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(CGMSStats, reg_retransmits_present_case),
+    offsetof(CGMSStats, regretransmits),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "reportLatency",
+    13,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(CGMSStats, report_latency_present_case),
+    offsetof(CGMSStats, reportlatency),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "reportLatencyMax",
+    14,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(CGMSStats, report_latency_max_present_case),
+    offsetof(CGMSStats, reportlatencymax),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
 };
-static const unsigned report_subscribe__field_indices_by_name[] = {
-  0,   /* field[0] = interval */
-  1,   /* field[1] = tlvid */
+static const unsigned cgmsstats__field_indices_by_name[] = {
+  8,   /* field[8] = nmsErrors */
+  5,   /* field[5] = regAttempts */
+  7,   /* field[7] = regFails */
+  6,   /* field[6] = regHolds */
+  11,   /* field[11] = regRetransmits */
+  9,   /* field[9] = regRtt */
+  10,   /* field[10] = regRttMax */
+  4,   /* field[4] = regSucceed */
+  12,   /* field[12] = reportLatency */
+  13,   /* field[13] = reportLatencyMax */
+  1,   /* field[1] = sigBadAuth */
+  2,   /* field[2] = sigBadValidity */
+  3,   /* field[3] = sigNoSync */
+  0,   /* field[0] = sigOk */
 };
-static const ProtobufCIntRange report_subscribe__number_ranges[1 + 1] =
+static const ProtobufCIntRange cgmsstats__number_ranges[1 + 1] =
 {
   { 1, 0 },
-  { 0, 2 }
+  { 0, 14 }
 };
-const ProtobufCMessageDescriptor report_subscribe__descriptor =
+const ProtobufCMessageDescriptor cgmsstats__descriptor =
 {
   PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
-  "ReportSubscribe",
-  "ReportSubscribe",
-  "ReportSubscribe",
+  "CGMSStats",
+  "CGMSStats",
+  "CGMSStats",
   "",
-  sizeof(ReportSubscribe),
-  2,
-  report_subscribe__field_descriptors,
-  report_subscribe__field_indices_by_name,
-  1,  report_subscribe__number_ranges,
-  (ProtobufCMessageInit) report_subscribe__init,
+  sizeof(CGMSStats),
+  14,
+  cgmsstats__field_descriptors,
+  cgmsstats__field_indices_by_name,
+  1,  cgmsstats__number_ranges,
+  (ProtobufCMessageInit) cgmsstats__init,
   NULL,NULL,NULL    /* reserved[123] */
 };
-static const ProtobufCFieldDescriptor cgmssettings__field_descriptors[2] =
+static const ProtobufCFieldDescriptor group_assign__field_descriptors[2] =
 {
   {
-    "regIntervalMin",
+    "type",
     1,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_UINT32,
-    offsetof(CGMSSettings, reg_interval_min_present_case),
-    offsetof(CGMSSettings, regintervalmin),
+    offsetof(GroupAssign, type_present_case),
+    offsetof(GroupAssign, type),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "regIntervalMax",
+    "id",
     2,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_UINT32,
-    offsetof(CGMSSettings, reg_interval_max_present_case),
-    offsetof(CGMSSettings, regintervalmax),
+    offsetof(GroupAssign, id_present_case),
+    offsetof(GroupAssign, id),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
 };
-static const unsigned cgmssettings__field_indices_by_name[] = {
-  1,   /* field[1] = regIntervalMax */
-  0,   /* field[0] = regIntervalMin */
+static const unsigned group_assign__field_indices_by_name[] = {
+  1,   /* field[1] = id */
+  0,   /* field[0] = type */
 };
-static const ProtobufCIntRange cgmssettings__number_ranges[1 + 1] =
+static const ProtobufCIntRange group_assign__number_ranges[1 + 1] =
 {
   { 1, 0 },
   { 0, 2 }
 };
-const ProtobufCMessageDescriptor cgmssettings__descriptor =
+const ProtobufCMessageDescriptor group_assign__descriptor =
 {
   PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
-  "CGMSSettings",
-  "CGMSSettings",
-  "CGMSSettings",
+  "GroupAssign",
+  "GroupAssign",
+  "GroupAssign",
   "",
-  sizeof(CGMSSettings),
+  sizeof(GroupAssign),
   2,
-  cgmssettings__field_descriptors,
-  cgmssettings__field_indices_by_name,
-  1,  cgmssettings__number_ranges,
-  (ProtobufCMessageInit) cgmssettings__init,
+  group_assign__field_descriptors,
+  group_assign__field_indices_by_name,
+  1,  group_assign__number_ranges,
+  (ProtobufCMessageInit) group_assign__init,
   NULL,NULL,NULL    /* reserved[123] */
 };
-static const ProtobufCFieldDescriptor cgmsstatus__field_descriptors[7] =
+static const ProtobufCFieldDescriptor group_match__field_descriptors[2] =
 {
   {
-    "registered",
+    "type",
     1,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_BOOL,
-    offsetof(CGMSStatus, registered_present_case),
-    offsetof(CGMSStatus, registered),
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(GroupMatch, type_present_case),
+    offsetof(GroupMatch, type),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "NMSAddr",
+    "id",
     2,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_BYTES,
-    offsetof(CGMSStatus, nmsaddr_present_case),
-    offsetof(CGMSStatus, nmsaddr),
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(GroupMatch, id_present_case),
+    offsetof(GroupMatch, id),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
+};
+static const unsigned group_match__field_indices_by_name[] = {
+  1,   /* field[1] = id */
+  0,   /* field[0] = type */
+};
+static const ProtobufCIntRange group_match__number_ranges[1 + 1] =
+{
+  { 1, 0 },
+  { 0, 2 }
+};
+const ProtobufCMessageDescriptor group_match__descriptor =
+{
+  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
+  "GroupMatch",
+  "GroupMatch",
+  "GroupMatch",
+  "",
+  sizeof(GroupMatch),
+  2,
+  group_match__field_descriptors,
+  group_match__field_indices_by_name,
+  1,  group_match__number_ranges,
+  (ProtobufCMessageInit) group_match__init,
+  NULL,NULL,NULL    /* reserved[123] */
+};
+static const ProtobufCFieldDescriptor group_info__field_descriptors[2] =
+{
   {
-    "NMSAddrOrigin",
-    3,
+    "type",
+    1,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_UINT32,
-    offsetof(CGMSStatus, nmsaddr_origin_present_case),
-    offsetof(CGMSStatus, nmsaddrorigin),
+    offsetof(GroupInfo, type_present_case),
+    offsetof(GroupInfo, type),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "lastReg",
-    4,
+    "id",
+    2,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_UINT32,
-    offsetof(CGMSStatus, last_reg_present_case),
-    offsetof(CGMSStatus, lastreg),
+    offsetof(GroupInfo, id_present_case),
+    offsetof(GroupInfo, id),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
+};
+static const unsigned group_info__field_indices_by_name[] = {
+  1,   /* field[1] = id */
+  0,   /* field[0] = type */
+};
+static const ProtobufCIntRange group_info__number_ranges[1 + 1] =
+{
+  { 1, 0 },
+  { 0, 2 }
+};
+const ProtobufCMessageDescriptor group_info__descriptor =
+{
+  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
+  "GroupInfo",
+  "GroupInfo",
+  "GroupInfo",
+  "",
+  sizeof(GroupInfo),
+  2,
+  group_info__field_descriptors,
+  group_info__field_indices_by_name,
+  1,  group_info__number_ranges,
+  (ProtobufCMessageInit) group_info__init,
+  NULL,NULL,NULL    /* reserved[123] */
+};
+static const ProtobufCFieldDescriptor signature_validity__field_descriptors[2] =
+{
   {
-    "lastRegReason",
-    5,
+    "notBefore",
+    1,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_UINT32,
-    offsetof(CGMSStatus, last_reg_reason_present_case),
-    offsetof(CGMSStatus, lastregreason),
+    offsetof(SignatureValidity, not_before_present_case),
+    offsetof(SignatureValidity, notbefore),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
-  {
-    "nextReg",
-    6,
+  {
+    "notAfter",
+    2,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_UINT32,
-    offsetof(CGMSStatus, next_reg_present_case),
-    offsetof(CGMSStatus, nextreg),
+    offsetof(SignatureValidity, not_after_present_case),
+    offsetof(SignatureValidity, notafter),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
+};
+static const unsigned signature_validity__field_indices_by_name[] = {
+  1,   /* field[1] = notAfter */
+  0,   /* field[0] = notBefore */
+};
+static const ProtobufCIntRange signature_validity__number_ranges[1 + 1] =
+{
+  { 1, 0 },
+  { 0, 2 }
+};
+const ProtobufCMessageDescriptor signature_validity__descriptor =
+{
+  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
+  "SignatureValidity",
+  "SignatureValidity",
+  "SignatureValidity",
+  "",
+  sizeof(SignatureValidity),
+  2,
+  signature_validity__field_descriptors,
+  signature_validity__field_indices_by_name,
+  1,  signature_validity__number_ranges,
+  (ProtobufCMessageInit) signature_validity__init,
+  NULL,NULL,NULL    /* reserved[123] */
+};
+static const ProtobufCFieldDescriptor signature__field_descriptors[1] =
+{
   {
-    "NMSCertValid",
-    7,
+    "value",
+    1,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_BOOL,
-    offsetof(CGMSStatus, nmscert_valid_present_case),
-    offsetof(CGMSStatus, nmscertvalid),
+    PROTOBUF_C_TYPE_BYTES,
+    offsetof(Signature, value_present_case),
+    offsetof(Signature, value),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
 };
-static const unsigned cgmsstatus__field_indices_by_name[] = {
-  1,   /* field[1] = NMSAddr */
-  2,   /* field[2] = NMSAddrOrigin */
-  6,   /* field[6] = NMSCertValid */
-  3,   /* field[3] = lastReg */
-  4,   /* field[4] = lastRegReason */
-  5,   /* field[5] = nextReg */
-  0,   /* field[0] = registered */
+static const unsigned signature__field_indices_by_name[] = {
+  0,   /* field[0] = value */
 };
-static const ProtobufCIntRange cgmsstatus__number_ranges[1 + 1] =
+static const ProtobufCIntRange signature__number_ranges[1 + 1] =
 {
   { 1, 0 },
-  { 0, 7 }
+  { 0, 1 }
 };
-const ProtobufCMessageDescriptor cgmsstatus__descriptor =
+const ProtobufCMessageDescriptor signature__descriptor =
 {
   PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
-  "CGMSStatus",
-  "CGMSStatus",
-  "CGMSStatus",
+  "Signature",
+  "Signature",
+  "Signature",
   "",
-  sizeof(CGMSStatus),
-  7,
-  cgmsstatus__field_descriptors,
-  cgmsstatus__field_indices_by_name,
-  1,  cgmsstatus__number_ranges,
-  (ProtobufCMessageInit) cgmsstatus__init,
+  sizeof(Signature),
+  1,
+  signature__field_descriptors,
+  signature__field_indices_by_name,
+  1,  signature__number_ranges,
+  (ProtobufCMessageInit) signature__init,
   NULL,NULL,NULL    /* reserved[123] */
 };
-static const ProtobufCFieldDescriptor cgmsstats__field_descriptors[9] =
+static const ProtobufCFieldDescriptor hardware_desc__field_descriptors[18] =
 {
   {
-    "sigOk",
+    "entPhysicalIndex",
     1,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_UINT32,
-    offsetof(CGMSStats, sig_ok_present_case),
-    offsetof(CGMSStats, sigok),
+    PROTOBUF_C_TYPE_INT32,
+    offsetof(HardwareDesc, ent_physical_index_present_case),
+    offsetof(HardwareDesc, entphysicalindex),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "sigBadAuth",
+    "entPhysicalDescr",
     2,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_UINT32,
-    offsetof(CGMSStats, sig_bad_auth_present_case),
-    offsetof(CGMSStats, sigbadauth),
-    NULL,
+    PROTOBUF_C_TYPE_STRING,
+    offsetof(HardwareDesc, ent_physical_descr_present_case),
+    offsetof(HardwareDesc, entphysicaldescr),
     NULL,
+    &protobuf_c_empty_string,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "sigBadValidity",
+    "entPhysicalVendorType",
     3,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_UINT32,
-    offsetof(CGMSStats, sig_bad_validity_present_case),
-    offsetof(CGMSStats, sigbadvalidity),
+    PROTOBUF_C_TYPE_BYTES,
+    offsetof(HardwareDesc, ent_physical_vendor_type_present_case),
+    offsetof(HardwareDesc, entphysicalvendortype),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "sigNoSync",
+    "entPhysicalContainedIn",
     4,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_UINT32,
-    offsetof(CGMSStats, sig_no_sync_present_case),
-    offsetof(CGMSStats, signosync),
+    PROTOBUF_C_TYPE_INT32,
+    offsetof(HardwareDesc, ent_physical_contained_in_present_case),
+    offsetof(HardwareDesc, entphysicalcontainedin),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "regSucceed",
+    "entPhysicalClass",
     5,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_UINT32,
-    offsetof(CGMSStats, reg_succeed_present_case),
-    offsetof(CGMSStats, regsucceed),
+    PROTOBUF_C_TYPE_INT32,
+    offsetof(HardwareDesc, ent_physical_class_present_case),
+    offsetof(HardwareDesc, entphysicalclass),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "regAttempts",
+    "entPhysicalParentRelPos",
     6,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_UINT32,
-    offsetof(CGMSStats, reg_attempts_present_case),
-    offsetof(CGMSStats, regattempts),
+    PROTOBUF_C_TYPE_INT32,
+    offsetof(HardwareDesc, ent_physical_parent_rel_pos_present_case),
+    offsetof(HardwareDesc, entphysicalparentrelpos),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "regHolds",
+    "entPhysicalName",
     7,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_UINT32,
-    offsetof(CGMSStats, reg_holds_present_case),
-    offsetof(CGMSStats, regholds),
-    NULL,
+    PROTOBUF_C_TYPE_STRING,
+    offsetof(HardwareDesc, ent_physical_name_present_case),
+    offsetof(HardwareDesc, entphysicalname),
     NULL,
+    &protobuf_c_empty_string,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "regFails",
+    "entPhysicalHardwareRev",
     8,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_UINT32,
-    offsetof(CGMSStats, reg_fails_present_case),
-    offsetof(CGMSStats, regfails),
-    NULL,
+    PROTOBUF_C_TYPE_STRING,
+    offsetof(HardwareDesc, ent_physical_hardware_rev_present_case),
+    offsetof(HardwareDesc, entphysicalhardwarerev),
     NULL,
+    &protobuf_c_empty_string,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "nmsErrors",
+    "entPhysicalFirmwareRev",
     9,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_UINT32,
-    offsetof(CGMSStats, nms_errors_present_case),
-    offsetof(CGMSStats, nmserrors),
+    PROTOBUF_C_TYPE_STRING,
+    offsetof(HardwareDesc, ent_physical_firmware_rev_present_case),
+    offsetof(HardwareDesc, entphysicalfirmwarerev),
     NULL,
+    &protobuf_c_empty_string,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "entPhysicalSoftwareRev",
+    10,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_STRING,
+    offsetof(HardwareDesc, ent_physical_software_rev_present_case),
+    offsetof(HardwareDesc, entphysicalsoftwarerev),
     NULL,
+    &protobuf_c_empty_string,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
-};
-static const unsigned cgmsstats__field_indices_by_name[] = {
-  8,   /* field[8] = nmsErrors */
-  5,   /* field[5] = regAttempts */
-  7,   /* field[7] = regFails */
-  6,   /* field[6] = regHolds */
-  4,   /* field[4] = regSucceed */
-  1,   /* field[1] = sigBadAuth */
-  2,   /* field[2] = sigBadValidity */
-  3,   /* field[3] = sigNoSync */
-  0,   /* field[0] = sigOk */
-};
-static const ProtobufCIntRange cgmsstats__number_ranges[1 + 1] =
-{
-  { 1, 0 },
-  { 0, 9 }
-};
-const ProtobufCMessageDescriptor cgmsstats__descriptor =
-{
-  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
-  "CGMSStats",
-  "CGMSStats",
-  "CGMSStats",
-  "",
-  sizeof(CGMSStats),
-  9,
-  cgmsstats__field_descriptors,
-  cgmsstats__field_indices_by_name,
-  1,  cgmsstats__number_ranges,
-  (ProtobufCMessageInit) cgmsstats__init,
-  NULL,NULL,NULL    /* reserved[123] */
-};
-static const ProtobufCFieldDescriptor group_assign__field_descriptors[2] =
-{
   {
-    "type",
-    1,
+    "entPhysicalSerialNum",
+    11,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_UINT32,
-    offsetof(GroupAssign, type_present_case),
-    offsetof(GroupAssign, type),
+    PROTOBUF_C_TYPE_STRING,
+    offsetof(HardwareDesc, ent_physical_serial_num_present_case),
+    offsetof(HardwareDesc, entphysicalserialnum),
     NULL,
+    &protobuf_c_empty_string,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "entPhysicalMfgName",
+    12,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_STRING,
+    offsetof(HardwareDesc, ent_physical_mfg_name_present_case),
+    offsetof(HardwareDesc, entphysicalmfgname),
     NULL,
+    &protobuf_c_empty_string,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "id",
-    2,
+    "entPhysicalModelName",
+    13,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_STRING,
+    offsetof(HardwareDesc, ent_physical_model_name_present_case),
+    offsetof(HardwareDesc, entphysicalmodelname),
+    NULL,
+    &protobuf_c_empty_string,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "entPhysicalAssetID",
+    14,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_STRING,
+    offsetof(HardwareDesc, ent_physical_asset_id_present_case),
+    offsetof(HardwareDesc, entphysicalassetid),
+    NULL,
+    &protobuf_c_empty_string,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "entPhysicalMfgDate",
+    15,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_UINT32,
-    offsetof(GroupAssign, id_present_case),
-    offsetof(GroupAssign, id),
+    offsetof(HardwareDesc, ent_physical_mfg_date_present_case),
+    offsetof(HardwareDesc, entphysicalmfgdate),
+    NULL,
     NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "entPhysicalURIs",
+    16,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_STRING,
+    offsetof(HardwareDesc, ent_physical_uris_present_case),
+    offsetof(HardwareDesc, entphysicaluris),
     NULL,
+    &protobuf_c_empty_string,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
-};
-static const unsigned group_assign__field_indices_by_name[] = {
-  1,   /* field[1] = id */
-  0,   /* field[0] = type */
-};
-static const ProtobufCIntRange group_assign__number_ranges[1 + 1] =
-{
-  { 1, 0 },
-  { 0, 2 }
-};
-const ProtobufCMessageDescriptor group_assign__descriptor =
-{
-  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
-  "GroupAssign",
-  "GroupAssign",
-  "GroupAssign",
-  "",
-  sizeof(GroupAssign),
-  2,
-  group_assign__field_descriptors,
-  group_assign__field_indices_by_name,
-  1,  group_assign__number_ranges,
-  (ProtobufCMessageInit) group_assign__init,
-  NULL,NULL,NULL    /* reserved[123] */
-};
-static const ProtobufCFieldDescriptor group_match__field_descriptors[2] =
-{
   {
-    "type",
-    1,
+    "entPhysicalFunction",
+    17,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_UINT32,
-    offsetof(GroupMatch, type_present_case),
-    offsetof(GroupMatch, type),
+    offsetof(HardwareDesc, ent_physical_function_present_case),
+    offsetof(HardwareDesc, entphysicalfunction),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "id",
-    2,
+    "entPhysicalOUI",
+    18,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_UINT32,
-    offsetof(GroupMatch, id_present_case),
-    offsetof(GroupMatch, id),
-    NULL,
+    PROTOBUF_C_TYPE_STRING,
+    offsetof(HardwareDesc, ent_physical_oui_present_case),
+    offsetof(HardwareDesc, entphysicaloui),
     NULL,
+    &protobuf_c_empty_string,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
 };
-static const unsigned group_match__field_indices_by_name[] = {
-  1,   /* field[1] = id */
-  0,   /* field[0] = type */
+static const unsigned hardware_desc__field_indices_by_name[] = {
+  13,   /* field[13] = entPhysicalAssetID */
+  4,   /* field[4] = entPhysicalClass */
+  3,   /* field[3] = entPhysicalContainedIn */
+  1,   /* field[1] = entPhysicalDescr */
+  8,   /* field[8] = entPhysicalFirmwareRev */
+  16,   /* field[16] = entPhysicalFunction */
+  7,   /* field[7] = entPhysicalHardwareRev */
+  0,   /* field[0] = entPhysicalIndex */
+  14,   /* field[14] = entPhysicalMfgDate */
+  11,   /* field[11] = entPhysicalMfgName */
+  12,   /* field[12] = entPhysicalModelName */
+  6,   /* field[6] = entPhysicalName */
+  17,   /* field[17] = entPhysicalOUI */
+  5,   /* field[5] = entPhysicalParentRelPos */
+  10,   /* field[10] = entPhysicalSerialNum */
+  9,   /* field[9] = entPhysicalSoftwareRev */
+  15,   /* field[15] = entPhysicalURIs */
+  2,   /* field[2] = entPhysicalVendorType */
 };
-static const ProtobufCIntRange group_match__number_ranges[1 + 1] =
+static const ProtobufCIntRange hardware_desc__number_ranges[1 + 1] =
 {
   { 1, 0 },
-  { 0, 2 }
+  { 0, 18 }
 };
-const ProtobufCMessageDescriptor group_match__descriptor =
+const ProtobufCMessageDescriptor hardware_desc__descriptor =
 {
   PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
-  "GroupMatch",
-  "GroupMatch",
-  "GroupMatch",
+  "HardwareDesc",
+  "HardwareDesc",
+  "HardwareDesc",
   "",
-  sizeof(GroupMatch),
-  2,
-  group_match__field_descriptors,
-  group_match__field_indices_by_name,
-  1,  group_match__number_ranges,
-  (ProtobufCMessageInit) group_match__init,
+  sizeof(HardwareDesc),
+  18,
+  hardware_desc__field_descriptors,
+  hardware_desc__field_indices_by_name,
+  1,  hardware_desc__number_ranges,
+  (ProtobufCMessageInit) hardware_desc__init,
   NULL,NULL,NULL    /* reserved[123] */
 };
-static const ProtobufCFieldDescriptor group_info__field_descriptors[2] =
+static const ProtobufCFieldDescriptor interface_desc__field_descriptors[6] =
 {
   {
-    "type",
+    "ifIndex",
     1,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_UINT32,
-    offsetof(GroupInfo, type_present_case),
-    offsetof(GroupInfo, type),
+    PROTOBUF_C_TYPE_INT32,
+    offsetof(InterfaceDesc, if_index_present_case),
+    offsetof(InterfaceDesc, ifindex),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "id",
+    "ifName",
     2,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_UINT32,
-    offsetof(GroupInfo, id_present_case),
-    offsetof(GroupInfo, id),
+    PROTOBUF_C_TYPE_STRING,
+    offsetof(InterfaceDesc, if_name_present_case),
+    offsetof(InterfaceDesc, ifname),
     NULL,
+    &protobuf_c_empty_string,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "ifDescr",
+    3,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_STRING,
+    offsetof(InterfaceDesc, if_descr_present_case),
+    offsetof(InterfaceDesc, ifdescr),
     NULL,
+    &protobuf_c_empty_string,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
-};
-static const unsigned group_info__field_indices_by_name[] = {
-  1,   /* field[1] = id */
-  0,   /* field[0] = type */
-};
-static const ProtobufCIntRange group_info__number_ranges[1 + 1] =
-{
-  { 1, 0 },
-  { 0, 2 }
-};
-const ProtobufCMessageDescriptor group_info__descriptor =
-{
-  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
-  "GroupInfo",
-  "GroupInfo",
-  "GroupInfo",
-  "",
-  sizeof(GroupInfo),
-  2,
-  group_info__field_descriptors,
-  group_info__field_indices_by_name,
-  1,  group_info__number_ranges,
-  (ProtobufCMessageInit) group_info__init,
-  NULL,NULL,NULL    /* reserved[123] */
-};
-static const ProtobufCFieldDescriptor signature_validity__field_descriptors[2] =
-{
   {
-    "notBefore",
-    1,
+    "ifType",
+    4,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_UINT32,
-    offsetof(SignatureValidity, not_before_present_case),
-    offsetof(SignatureValidity, notbefore),
+    PROTOBUF_C_TYPE_INT32,
+    offsetof(InterfaceDesc, if_type_present_case),
+    offsetof(InterfaceDesc, iftype),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "notAfter",
-    2,
+    "ifMtu",
+    5,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_UINT32,
-    offsetof(SignatureValidity, not_after_present_case),
-    offsetof(SignatureValidity, notafter),
+    PROTOBUF_C_TYPE_INT32,
+    offsetof(InterfaceDesc, if_mtu_present_case),
+    offsetof(InterfaceDesc, ifmtu),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
-};
-static const unsigned signature_validity__field_indices_by_name[] = {
-  1,   /* field[1] = notAfter */
-  0,   /* field[0] = notBefore */
-};
-static const ProtobufCIntRange signature_validity__number_ranges[1 + 1] =
-{
-  { 1, 0 },
-  { 0, 2 }
-};
-const ProtobufCMessageDescriptor signature_validity__descriptor =
-{
-  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
-  "SignatureValidity",
-  "SignatureValidity",
-  "SignatureValidity",
-  "",
-  sizeof(SignatureValidity),
-  2,
-  signature_validity__field_descriptors,
-  signature_validity__field_indices_by_name,
-  1,  signature_validity__number_ranges,
-  (ProtobufCMessageInit) signature_validity__init,
-  NULL,NULL,NULL    /* reserved[123] */
-};
-static const ProtobufCFieldDescriptor signature__field_descriptors[1] =
-{
   {
-    "value",
-    1,
+    "ifPhysAddress",
+    6,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_BYTES,
-    offsetof(Signature, value_present_case),
-    offsetof(Signature, value),
+    offsetof(InterfaceDesc, if_phys_address_present_case),
+    offsetof(InterfaceDesc, ifphysaddress),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
 };
-static const unsigned signature__field_indices_by_name[] = {
-  0,   /* field[0] = value */
+static const unsigned interface_desc__field_indices_by_name[] = {
+  2,   /* field[2] = ifDescr */
+  0,   /* field[0] = ifIndex */
+  4,   /* field[4] = ifMtu */
+  1,   /* field[1] = ifName */
+  5,   /* field[5] = ifPhysAddress */
+  3,   /* field[3] = ifType */
 };
-static const ProtobufCIntRange signature__number_ranges[1 + 1] =
+static const ProtobufCIntRange interface_desc__number_ranges[1 + 1] =
 {
   { 1, 0 },
-  { 0, 1 }
+  { 0, 6 }
 };
-const ProtobufCMessageDescriptor signature__descriptor =
+const ProtobufCMessageDescriptor interface_desc__descriptor =
 {
   PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
-  "Signature",
-  "Signature",
-  "Signature",
+  "InterfaceDesc",
+  "InterfaceDesc",
+  "InterfaceDesc",
   "",
-  sizeof(Signature),
-  1,
-  signature__field_descriptors,
-  signature__field_indices_by_name,
-  1,  signature__number_ranges,
-  (ProtobufCMessageInit) signature__init,
+  sizeof(InterfaceDesc),
+  6,
+  interface_desc__field_descriptors,
+  interface_desc__field_indices_by_name,
+  1,  interface_desc__number_ranges,
+  (ProtobufCMessageInit) interface_desc__init,
   NULL,NULL,NULL    /* reserved[123] */
 };
-static const ProtobufCFieldDescriptor hardware_desc__field_descriptors[18] =
+static const ProtobufCFieldDescriptor ipaddress__field_descriptors[10] =
 {
   {
-    "entPhysicalIndex",
+    "ipAddressIndex",
     1,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_INT32,
-    offsetof(HardwareDesc, ent_physical_index_present_case),
-    offsetof(HardwareDesc, entphysicalindex),
+    offsetof(IPAddress, ip_address_index_present_case),
+    offsetof(IPAddress, ipaddressindex),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "entPhysicalDescr",
+    "ipAddressAddrType",
     2,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_STRING,
-    offsetof(HardwareDesc, ent_physical_descr_present_case),
-    offsetof(HardwareDesc, entphysicaldescr),
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(IPAddress, ip_address_addr_type_present_case),
+    offsetof(IPAddress, ipaddressaddrtype),
+    NULL,
     NULL,
-    &protobuf_c_empty_string,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "entPhysicalVendorType",
+    "ipAddressAddr",
     3,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_BYTES,
-    offsetof(HardwareDesc, ent_physical_vendor_type_present_case),
-    offsetof(HardwareDesc, entphysicalvendortype),
+    offsetof(IPAddress, ip_address_addr_present_case),
+    offsetof(IPAddress, ipaddressaddr),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "entPhysicalContainedIn",
+    "ipAddressIfIndex",
     4,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_INT32,
-    offsetof(HardwareDesc, ent_physical_contained_in_present_case),
-    offsetof(HardwareDesc, entphysicalcontainedin),
+    offsetof(IPAddress, ip_address_if_index_present_case),
+    offsetof(IPAddress, ipaddressifindex),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "entPhysicalClass",
+    "ipAddressType",
     5,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_INT32,
-    offsetof(HardwareDesc, ent_physical_class_present_case),
-    offsetof(HardwareDesc, entphysicalclass),
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(IPAddress, ip_address_type_present_case),
+    offsetof(IPAddress, ipaddresstype),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "entPhysicalParentRelPos",
+    "ipAddressOrigin",
     6,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_INT32,
-    offsetof(HardwareDesc, ent_physical_parent_rel_pos_present_case),
-    offsetof(HardwareDesc, entphysicalparentrelpos),
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(IPAddress, ip_address_origin_present_case),
+    offsetof(IPAddress, ipaddressorigin),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "entPhysicalName",
+    "ipAddressStatus",
     7,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_STRING,
-    offsetof(HardwareDesc, ent_physical_name_present_case),
-    offsetof(HardwareDesc, entphysicalname),
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(IPAddress, ip_address_status_present_case),
+    offsetof(IPAddress, ipaddressstatus),
+    NULL,
     NULL,
-    &protobuf_c_empty_string,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "entPhysicalHardwareRev",
+    "ipAddressCreated",
     8,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_STRING,
-    offsetof(HardwareDesc, ent_physical_hardware_rev_present_case),
-    offsetof(HardwareDesc, entphysicalhardwarerev),
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(IPAddress, ip_address_created_present_case),
+    offsetof(IPAddress, ipaddresscreated),
+    NULL,
     NULL,
-    &protobuf_c_empty_string,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "entPhysicalFirmwareRev",
+    "ipAddressLastChanged",
     9,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_STRING,
-    offsetof(HardwareDesc, ent_physical_firmware_rev_present_case),
-    offsetof(HardwareDesc, entphysicalfirmwarerev),
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(IPAddress, ip_address_last_changed_present_case),
+    offsetof(IPAddress, ipaddresslastchanged),
+    NULL,
     NULL,
-    &protobuf_c_empty_string,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "entPhysicalSoftwareRev",
+    "ipAddressPfxLen",
     10,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_STRING,
-    offsetof(HardwareDesc, ent_physical_software_rev_present_case),
-    offsetof(HardwareDesc, entphysicalsoftwarerev),
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(IPAddress, ip_address_pfx_len_present_case),
+    offsetof(IPAddress, ipaddresspfxlen),
+    NULL,
     NULL,
-    &protobuf_c_empty_string,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
+};
+static const unsigned ipaddress__field_indices_by_name[] = {
+  2,   /* field[2] = ipAddressAddr */
+  1,   /* field[1] = ipAddressAddrType */
+  7,   /* field[7] = ipAddressCreated */
+  3,   /* field[3] = ipAddressIfIndex */
+  0,   /* field[0] = ipAddressIndex */
+  8,   /* field[8] = ipAddressLastChanged */
+  5,   /* field[5] = ipAddressOrigin */
+  9,   /* field[9] = ipAddressPfxLen */
+  6,   /* field[6] = ipAddressStatus */
+  4,   /* field[4] = ipAddressType */
+};
+static const ProtobufCIntRange ipaddress__number_ranges[1 + 1] =
+{
+  { 1, 0 },
+  { 0, 10 }
+};
+const ProtobufCMessageDescriptor ipaddress__descriptor =
+{
+  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
+  "IPAddress",
+  "IPAddress",
+  "IPAddress",
+  "",
+  sizeof(IPAddress),
+  10,
+  ipaddress__field_descriptors,
+  ipaddress__field_indices_by_name,
+  1,  ipaddress__number_ranges,
+  (ProtobufCMessageInit) ipaddress__init,
+  NULL,NULL,NULL    /* reserved[123] */
+};
+static const ProtobufCFieldDescriptor iproute__field_descriptors[10] =
+{
   {
-    "entPhysicalSerialNum",
-    11,
+    "inetCidrRouteIndex",
+    1,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_STRING,
-    offsetof(HardwareDesc, ent_physical_serial_num_present_case),
-    offsetof(HardwareDesc, entphysicalserialnum),
+    PROTOBUF_C_TYPE_INT32,
+    offsetof(IPRoute, inet_cidr_route_index_present_case),
+    offsetof(IPRoute, inetcidrrouteindex),
+    NULL,
     NULL,
-    &protobuf_c_empty_string,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "entPhysicalMfgName",
-    12,
+    "inetCidrRouteDestType",
+    2,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_STRING,
-    offsetof(HardwareDesc, ent_physical_mfg_name_present_case),
-    offsetof(HardwareDesc, entphysicalmfgname),
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(IPRoute, inet_cidr_route_dest_type_present_case),
+    offsetof(IPRoute, inetcidrroutedesttype),
+    NULL,
     NULL,
-    &protobuf_c_empty_string,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "entPhysicalModelName",
-    13,
+    "inetCidrRouteDest",
+    3,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_STRING,
-    offsetof(HardwareDesc, ent_physical_model_name_present_case),
-    offsetof(HardwareDesc, entphysicalmodelname),
+    PROTOBUF_C_TYPE_BYTES,
+    offsetof(IPRoute, inet_cidr_route_dest_present_case),
+    offsetof(IPRoute, inetcidrroutedest),
+    NULL,
     NULL,
-    &protobuf_c_empty_string,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "entPhysicalAssetID",
-    14,
+    "inetCidrRoutePfxLen",
+    4,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_STRING,
-    offsetof(HardwareDesc, ent_physical_asset_id_present_case),
-    offsetof(HardwareDesc, entphysicalassetid),
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(IPRoute, inet_cidr_route_pfx_len_present_case),
+    offsetof(IPRoute, inetcidrroutepfxlen),
+    NULL,
     NULL,
-    &protobuf_c_empty_string,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "entPhysicalMfgDate",
-    15,
+    "inetCidrRouteNextHopType",
+    5,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_UINT32,
-    offsetof(HardwareDesc, ent_physical_mfg_date_present_case),
-    offsetof(HardwareDesc, entphysicalmfgdate),
+    offsetof(IPRoute, inet_cidr_route_next_hop_type_present_case),
+    offsetof(IPRoute, inetcidrroutenexthoptype),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "entPhysicalURIs",
-    16,
+    "inetCidrRouteNextHop",
+    6,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_STRING,
-    offsetof(HardwareDesc, ent_physical_uris_present_case),
-    offsetof(HardwareDesc, entphysicaluris),
+    PROTOBUF_C_TYPE_BYTES,
+    offsetof(IPRoute, inet_cidr_route_next_hop_present_case),
+    offsetof(IPRoute, inetcidrroutenexthop),
+    NULL,
     NULL,
-    &protobuf_c_empty_string,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "entPhysicalFunction",
-    17,
+    "inetCidrRouteIfIndex",
+    7,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_INT32,
+    offsetof(IPRoute, inet_cidr_route_if_index_present_case),
+    offsetof(IPRoute, inetcidrrouteifindex),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "inetCidrRouteType",
+    8,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_UINT32,
-    offsetof(HardwareDesc, ent_physical_function_present_case),
-    offsetof(HardwareDesc, entphysicalfunction),
+    offsetof(IPRoute, inet_cidr_route_type_present_case),
+    offsetof(IPRoute, inetcidrroutetype),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "entPhysicalOUI",
-    18,
+    "inetCidrRouteProto",
+    9,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_STRING,
-    offsetof(HardwareDesc, ent_physical_oui_present_case),
-    offsetof(HardwareDesc, entphysicaloui),
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(IPRoute, inet_cidr_route_proto_present_case),
+    offsetof(IPRoute, inetcidrrouteproto),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "inetCidrRouteAge",
+    10,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(IPRoute, inet_cidr_route_age_present_case),
+    offsetof(IPRoute, inetcidrrouteage),
+    NULL,
     NULL,
-    &protobuf_c_empty_string,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
 };
-static const unsigned hardware_desc__field_indices_by_name[] = {
-  13,   /* field[13] = entPhysicalAssetID */
-  4,   /* field[4] = entPhysicalClass */
-  3,   /* field[3] = entPhysicalContainedIn */
-  1,   /* field[1] = entPhysicalDescr */
-  8,   /* field[8] = entPhysicalFirmwareRev */
-  16,   /* field[16] = entPhysicalFunction */
-  7,   /* field[7] = entPhysicalHardwareRev */
-  0,   /* field[0] = entPhysicalIndex */
-  14,   /* field[14] = entPhysicalMfgDate */
-  11,   /* field[11] = entPhysicalMfgName */
-  12,   /* field[12] = entPhysicalModelName */
-  6,   /* field[6] = entPhysicalName */
-  17,   /* field[17] = entPhysicalOUI */
-  5,   /* field[5] = entPhysicalParentRelPos */
-  10,   /* field[10] = entPhysicalSerialNum */
-  9,   /* field[9] = entPhysicalSoftwareRev */
-  15,   /* field[15] = entPhysicalURIs */
-  2,   /* field[2] = entPhysicalVendorType */
+static const unsigned iproute__field_indices_by_name[] = {
+  9,   /* field[9] = inetCidrRouteAge */
+  2,   /* field[2] = inetCidrRouteDest */
+  1,   /* field[1] = inetCidrRouteDestType */
+  6,   /* field[6] = inetCidrRouteIfIndex */
+  0,   /* field[0] = inetCidrRouteIndex */
+  5,   /* field[5] = inetCidrRouteNextHop */
+  4,   /* field[4] = inetCidrRouteNextHopType */
+  3,   /* field[3] = inetCidrRoutePfxLen */
+  8,   /* field[8] = inetCidrRouteProto */
+  7,   /* field[7] = inetCidrRouteType */
 };
-static const ProtobufCIntRange hardware_desc__number_ranges[1 + 1] =
+static const ProtobufCIntRange iproute__number_ranges[1 + 1] =
 {
   { 1, 0 },
-  { 0, 18 }
+  { 0, 10 }
 };
-const ProtobufCMessageDescriptor hardware_desc__descriptor =
+const ProtobufCMessageDescriptor iproute__descriptor =
 {
   PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
-  "HardwareDesc",
-  "HardwareDesc",
-  "HardwareDesc",
+  "IPRoute",
+  "IPRoute",
+  "IPRoute",
   "",
-  sizeof(HardwareDesc),
-  18,
-  hardware_desc__field_descriptors,
-  hardware_desc__field_indices_by_name,
-  1,  hardware_desc__number_ranges,
-  (ProtobufCMessageInit) hardware_desc__init,
+  sizeof(IPRoute),
+  10,
+  iproute__field_descriptors,
+  iproute__field_indices_by_name,
+  1,  iproute__number_ranges,
+  (ProtobufCMessageInit) iproute__init,
   NULL,NULL,NULL    /* reserved[123] */
 };
-static const ProtobufCFieldDescriptor interface_desc__field_descriptors[6] =
+static const ProtobufCFieldDescriptor current_time__field_descriptors[3] =
 {
   {
-    "ifIndex",
+    "posix",
     1,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_INT32,
-    offsetof(InterfaceDesc, if_index_present_case),
-    offsetof(InterfaceDesc, ifindex),
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(CurrentTime, posix_present_case),
+    offsetof(CurrentTime, posix),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "ifName",
+    "iso8601",
     2,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_STRING,
-    offsetof(InterfaceDesc, if_name_present_case),
-    offsetof(InterfaceDesc, ifname),
+    offsetof(CurrentTime, iso8601_present_case),
+    offsetof(CurrentTime, iso8601),
     NULL,
     &protobuf_c_empty_string,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "ifDescr",
+    "source",
     3,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_STRING,
-    offsetof(InterfaceDesc, if_descr_present_case),
-    offsetof(InterfaceDesc, ifdescr),
-    NULL,
-    &protobuf_c_empty_string,
-    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
-    0,NULL,NULL    /* reserved1,reserved2, etc */
-  },
-  {
-    "ifType",
-    4,
-    PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_INT32,
-    offsetof(InterfaceDesc, if_type_present_case),
-    offsetof(InterfaceDesc, iftype),
-    NULL,
-    NULL,
-    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
-    0,NULL,NULL    /* reserved1,reserved2, etc */
-  },
-  {
-    "ifMtu",
-    5,
-    PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_INT32,
-    offsetof(InterfaceDesc, if_mtu_present_case),
-    offsetof(InterfaceDesc, ifmtu),
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(CurrentTime, source_present_case),
+    offsetof(CurrentTime, source),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
+};
+static const unsigned current_time__field_indices_by_name[] = {
+  1,   /* field[1] = iso8601 */
+  0,   /* field[0] = posix */
+  2,   /* field[2] = source */
+};
+static const ProtobufCIntRange current_time__number_ranges[1 + 1] =
+{
+  { 1, 0 },
+  { 0, 3 }
+};
+const ProtobufCMessageDescriptor current_time__descriptor =
+{
+  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
+  "CurrentTime",
+  "CurrentTime",
+  "CurrentTime",
+  "",
+  sizeof(CurrentTime),
+  3,
+  current_time__field_descriptors,
+  current_time__field_indices_by_name,
+  1,  current_time__number_ranges,
+  (ProtobufCMessageInit) current_time__init,
+  NULL,NULL,NULL    /* reserved[123] */
+};
+static const ProtobufCFieldDescriptor uptime__field_descriptors[1] =
+{
   {
-    "ifPhysAddress",
-    6,
+    "sysUpTime",
+    1,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_BYTES,
-    offsetof(InterfaceDesc, if_phys_address_present_case),
-    offsetof(InterfaceDesc, ifphysaddress),
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(Uptime, sys_up_time_present_case),
+    offsetof(Uptime, sysuptime),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
 };
-static const unsigned interface_desc__field_indices_by_name[] = {
-  2,   /* field[2] = ifDescr */
-  0,   /* field[0] = ifIndex */
-  4,   /* field[4] = ifMtu */
-  1,   /* field[1] = ifName */
-  5,   /* field[5] = ifPhysAddress */
-  3,   /* field[3] = ifType */
+static const unsigned uptime__field_indices_by_name[] = {
+  0,   /* field[0] = sysUpTime */
 };
-static const ProtobufCIntRange interface_desc__number_ranges[1 + 1] =
+static const ProtobufCIntRange uptime__number_ranges[1 + 1] =
 {
   { 1, 0 },
-  { 0, 6 }
+  { 0, 1 }
 };
-const ProtobufCMessageDescriptor interface_desc__descriptor =
+const ProtobufCMessageDescriptor uptime__descriptor =
 {
   PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
-  "InterfaceDesc",
-  "InterfaceDesc",
-  "InterfaceDesc",
+  "Uptime",
+  "Uptime",
+  "Uptime",
   "",
-  sizeof(InterfaceDesc),
-  6,
-  interface_desc__field_descriptors,
-  interface_desc__field_indices_by_name,
-  1,  interface_desc__number_ranges,
-  (ProtobufCMessageInit) interface_desc__init,
+  sizeof(Uptime),
+  1,
+  uptime__field_descriptors,
+  uptime__field_indices_by_name,
+  1,  uptime__number_ranges,
+  (ProtobufCMessageInit) uptime__init,
   NULL,NULL,NULL    /* reserved[123] */
 };
-static const ProtobufCFieldDescriptor ipaddress__field_descriptors[10] =
+static const ProtobufCFieldDescriptor interface_metrics__field_descriptors[12] =
 {
   {
-    "ipAddressIndex",
+    "ifIndex",
     1,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_INT32,
-    offsetof(IPAddress, ip_address_index_present_case),
-    offsetof(IPAddress, ipaddressindex),
+    offsetof(InterfaceMetrics, if_index_present_case),
+    offsetof(InterfaceMetrics, ifindex),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "ipAddressAddrType",
+    "ifInSpeed",
     2,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_UINT32,
-    offsetof(IPAddress, ip_address_addr_type_present_case),
-    offsetof(IPAddress, ipaddressaddrtype),
+    offsetof(InterfaceMetrics, if_in_speed_present_case),
+    offsetof(InterfaceMetrics, ifinspeed),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "ipAddressAddr",
+    "ifOutSpeed",
     3,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_BYTES,
-    offsetof(IPAddress, ip_address_addr_present_case),
-    offsetof(IPAddress, ipaddressaddr),
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(InterfaceMetrics, if_out_speed_present_case),
+    offsetof(InterfaceMetrics, ifoutspeed),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "ipAddressIfIndex",
+    "ifAdminStatus",
     4,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_INT32,
-    offsetof(IPAddress, ip_address_if_index_present_case),
-    offsetof(IPAddress, ipaddressifindex),
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(InterfaceMetrics, if_admin_status_present_case),
+    offsetof(InterfaceMetrics, ifadminstatus),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "ipAddressType",
+    "ifOperStatus",
     5,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_UINT32,
-    offsetof(IPAddress, ip_address_type_present_case),
-    offsetof(IPAddress, ipaddresstype),
+    offsetof(InterfaceMetrics, if_oper_status_present_case),
+    offsetof(InterfaceMetrics, ifoperstatus),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "ipAddressOrigin",
+    "ifLastChange",
     6,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_UINT32,
-    offsetof(IPAddress, ip_address_origin_present_case),
-    offsetof(IPAddress, ipaddressorigin),
+    offsetof(InterfaceMetrics, if_last_change_present_case),
+    offsetof(InterfaceMetrics, iflastchange),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "ipAddressStatus",
+    "ifInOctets",
     7,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_UINT32,
-    offsetof(IPAddress, ip_address_status_present_case),
-    offsetof(IPAddress, ipaddressstatus),
+    offsetof(InterfaceMetrics, if_in_octets_present_case),
+    offsetof(InterfaceMetrics, ifinoctets),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "ipAddressCreated",
+    "ifOutOctets",
     8,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_UINT32,
-    offsetof(IPAddress, ip_address_created_present_case),
-    offsetof(IPAddress, ipaddresscreated),
+    offsetof(InterfaceMetrics, if_out_octets_present_case),
+    offsetof(InterfaceMetrics, ifoutoctets),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "ipAddressLastChanged",
+    "ifInDiscards",
     9,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_UINT32,
-    offsetof(IPAddress, ip_address_last_changed_present_case),
-    offsetof(IPAddress, ipaddresslastchanged),
+    offsetof(InterfaceMetrics, if_in_discards_present_case),
+    offsetof(InterfaceMetrics, ifindiscards),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "ipAddressPfxLen",
+    "ifInErrors",
     10,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_UINT32,
-    offsetof(IPAddress, ip_address_pfx_len_present_case),
-    offsetof(IPAddress, ipaddresspfxlen),
+    offsetof(InterfaceMetrics, if_in_errors_present_case),
+    offsetof(InterfaceMetrics, ifinerrors),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "ifOutDiscards",
+    11,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(InterfaceMetrics, if_out_discards_present_case),
+    offsetof(InterfaceMetrics, ifoutdiscards),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "ifOutErrors",
+    12,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(InterfaceMetrics, if_out_errors_present_case),
+    offsetof(InterfaceMetrics, ifouterrors),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
 };
-static const unsigned ipaddress__field_indices_by_name[] = {
-  2,   /* field[2] = ipAddressAddr */
-  1,   /* field[1] = ipAddressAddrType */
-  7,   /* field[7] = ipAddressCreated */
-  3,   /* field[3] = ipAddressIfIndex */
-  0,   /* field[0] = ipAddressIndex */
-  8,   /* field[8] = ipAddressLastChanged */
-  5,   /* field[5] = ipAddressOrigin */
-  9,   /* field[9] = ipAddressPfxLen */
-  6,   /* field[6] = ipAddressStatus */
-  4,   /* field[4] = ipAddressType */
+static const unsigned interface_metrics__field_indices_by_name[] = {
+  3,   /* field[3] = ifAdminStatus */
+  8,   /* field[8] = ifInDiscards */
+  9,   /* field[9] = ifInErrors */
+  6,   /* field[6] = ifInOctets */
+  1,   /* field[1] = ifInSpeed */
+  0,   /* field[0] = ifIndex */
+  5,   /* field[5] = ifLastChange */
+  4,   /* field[4] = ifOperStatus */
+  10,   /* field[10] = ifOutDiscards */
+  11,   /* field[11] = ifOutErrors */
+  7,   /* field[7] = ifOutOctets */
+  2,   /* field[2] = ifOutSpeed */
 };
-static const ProtobufCIntRange ipaddress__number_ranges[1 + 1] =
+static const ProtobufCIntRange interface_metrics__number_ranges[1 + 1] =
 {
   { 1, 0 },
-  { 0, 10 }
+  { 0, 12 }
 };
-const ProtobufCMessageDescriptor ipaddress__descriptor =
+const ProtobufCMessageDescriptor interface_metrics__descriptor =
 {
   PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
-  "IPAddress",
-  "IPAddress",
-  "IPAddress",
+  "InterfaceMetrics",
+  "InterfaceMetrics",
+  "InterfaceMetrics",
   "",
-  sizeof(IPAddress),
-  10,
-  ipaddress__field_descriptors,
-  ipaddress__field_indices_by_name,
-  1,  ipaddress__number_ranges,
-  (ProtobufCMessageInit) ipaddress__init,
+  sizeof(InterfaceMetrics),
+  12,
+  interface_metrics__field_descriptors,
+  interface_metrics__field_indices_by_name,
+  1,  interface_metrics__number_ranges,
+  (ProtobufCMessageInit) interface_metrics__init,
   NULL,NULL,NULL    /* reserved[123] */
 };
-static const ProtobufCFieldDescriptor iproute__field_descriptors[10] =
+static const ProtobufCFieldDescriptor iproute_rplmetrics__field_descriptors[11] =
 {
   {
     "inetCidrRouteIndex",
     1,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_INT32,
-    offsetof(IPRoute, inet_cidr_route_index_present_case),
-    offsetof(IPRoute, inetcidrrouteindex),
+    offsetof(IPRouteRPLMetrics, inet_cidr_route_index_present_case),
+    offsetof(IPRouteRPLMetrics, inetcidrrouteindex),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "inetCidrRouteDestType",
+    "instanceIndex",
     2,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_UINT32,
-    offsetof(IPRoute, inet_cidr_route_dest_type_present_case),
-    offsetof(IPRoute, inetcidrroutedesttype),
+    PROTOBUF_C_TYPE_INT32,
+    offsetof(IPRouteRPLMetrics, instance_index_present_case),
+    offsetof(IPRouteRPLMetrics, instanceindex),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "inetCidrRouteDest",
+    "rank",
     3,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_BYTES,
-    offsetof(IPRoute, inet_cidr_route_dest_present_case),
-    offsetof(IPRoute, inetcidrroutedest),
+    PROTOBUF_C_TYPE_INT32,
+    offsetof(IPRouteRPLMetrics, rank_present_case),
+    offsetof(IPRouteRPLMetrics, rank),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "inetCidrRoutePfxLen",
+    "hops",
     4,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_UINT32,
-    offsetof(IPRoute, inet_cidr_route_pfx_len_present_case),
-    offsetof(IPRoute, inetcidrroutepfxlen),
+    PROTOBUF_C_TYPE_INT32,
+    offsetof(IPRouteRPLMetrics, hops_present_case),
+    offsetof(IPRouteRPLMetrics, hops),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "inetCidrRouteNextHopType",
+    "pathEtx",
     5,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_UINT32,
-    offsetof(IPRoute, inet_cidr_route_next_hop_type_present_case),
-    offsetof(IPRoute, inetcidrroutenexthoptype),
+    PROTOBUF_C_TYPE_INT32,
+    offsetof(IPRouteRPLMetrics, path_etx_present_case),
+    offsetof(IPRouteRPLMetrics, pathetx),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "inetCidrRouteNextHop",
+    "linkEtx",
     6,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_BYTES,
-    offsetof(IPRoute, inet_cidr_route_next_hop_present_case),
-    offsetof(IPRoute, inetcidrroutenexthop),
+    PROTOBUF_C_TYPE_INT32,
+    offsetof(IPRouteRPLMetrics, link_etx_present_case),
+    offsetof(IPRouteRPLMetrics, linketx),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "inetCidrRouteIfIndex",
+    "rssiForward",
     7,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_INT32,
-    offsetof(IPRoute, inet_cidr_route_if_index_present_case),
-    offsetof(IPRoute, inetcidrrouteifindex),
+    PROTOBUF_C_TYPE_SINT32,
+    offsetof(IPRouteRPLMetrics, rssi_forward_present_case),
+    offsetof(IPRouteRPLMetrics, rssiforward),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "inetCidrRouteType",
+    "rssiReverse",
     8,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_UINT32,
-    offsetof(IPRoute, inet_cidr_route_type_present_case),
-    offsetof(IPRoute, inetcidrroutetype),
+    PROTOBUF_C_TYPE_SINT32,
+    offsetof(IPRouteRPLMetrics, rssi_reverse_present_case),
+    offsetof(IPRouteRPLMetrics, rssireverse),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "inetCidrRouteProto",
+    "lqiForward",
     9,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_UINT32,
-    offsetof(IPRoute, inet_cidr_route_proto_present_case),
-    offsetof(IPRoute, inetcidrrouteproto),
+    PROTOBUF_C_TYPE_INT32,
+    offsetof(IPRouteRPLMetrics, lqi_forward_present_case),
+    offsetof(IPRouteRPLMetrics, lqiforward),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "inetCidrRouteAge",
+    "lqiReverse",
     10,
     PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_INT32,
+    offsetof(IPRouteRPLMetrics, lqi_reverse_present_case),
+    offsetof(IPRouteRPLMetrics, lqireverse),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "dagSize",
+    11,
+    PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_UINT32,
-    offsetof(IPRoute, inet_cidr_route_age_present_case),
-    offsetof(IPRoute, inetcidrrouteage),
+    offsetof(IPRouteRPLMetrics, dag_size_present_case),
+    offsetof(IPRouteRPLMetrics, dagsize),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
 };
-static const unsigned iproute__field_indices_by_name[] = {
-  9,   /* field[9] = inetCidrRouteAge */
-  2,   /* field[2] = inetCidrRouteDest */
-  1,   /* field[1] = inetCidrRouteDestType */
-  6,   /* field[6] = inetCidrRouteIfIndex */
+static const unsigned iproute_rplmetrics__field_indices_by_name[] = {
+  10,   /* field[10] = dagSize */
+  3,   /* field[3] = hops */
   0,   /* field[0] = inetCidrRouteIndex */
-  5,   /* field[5] = inetCidrRouteNextHop */
-  4,   /* field[4] = inetCidrRouteNextHopType */
-  3,   /* field[3] = inetCidrRoutePfxLen */
-  8,   /* field[8] = inetCidrRouteProto */
-  7,   /* field[7] = inetCidrRouteType */
+  1,   /* field[1] = instanceIndex */
+  5,   /* field[5] = linkEtx */
+  8,   /* field[8] = lqiForward */
+  9,   /* field[9] = lqiReverse */
+  4,   /* field[4] = pathEtx */
+  2,   /* field[2] = rank */
+  6,   /* field[6] = rssiForward */
+  7,   /* field[7] = rssiReverse */
 };
-static const ProtobufCIntRange iproute__number_ranges[1 + 1] =
+static const ProtobufCIntRange iproute_rplmetrics__number_ranges[1 + 1] =
 {
   { 1, 0 },
-  { 0, 10 }
+  { 0, 11 }
 };
-const ProtobufCMessageDescriptor iproute__descriptor =
+const ProtobufCMessageDescriptor iproute_rplmetrics__descriptor =
 {
   PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
-  "IPRoute",
-  "IPRoute",
-  "IPRoute",
+  "IPRouteRPLMetrics",
+  "IPRouteRPLMetrics",
+  "IPRouteRPLMetrics",
   "",
-  sizeof(IPRoute),
-  10,
-  iproute__field_descriptors,
-  iproute__field_indices_by_name,
-  1,  iproute__number_ranges,
-  (ProtobufCMessageInit) iproute__init,
+  sizeof(IPRouteRPLMetrics),
+  11,
+  iproute_rplmetrics__field_descriptors,
+  iproute_rplmetrics__field_indices_by_name,
+  1,  iproute_rplmetrics__number_ranges,
+  (ProtobufCMessageInit) iproute_rplmetrics__init,
   NULL,NULL,NULL    /* reserved[123] */
 };
-static const ProtobufCFieldDescriptor current_time__field_descriptors[3] =
+static const ProtobufCFieldDescriptor wpanstatus__field_descriptors[16] =
 {
   {
-    "posix",
+    "ifIndex",
     1,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_UINT32,
-    offsetof(CurrentTime, posix_present_case),
-    offsetof(CurrentTime, posix),
+    PROTOBUF_C_TYPE_INT32,
+    offsetof(WPANStatus, if_index_present_case),
+    offsetof(WPANStatus, ifindex),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "iso8601",
+    "SSID",
     2,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_STRING,
-    offsetof(CurrentTime, iso8601_present_case),
-    offsetof(CurrentTime, iso8601),
+    PROTOBUF_C_TYPE_BYTES,
+    offsetof(WPANStatus, ssid_present_case),
+    offsetof(WPANStatus, ssid),
+    NULL,
     NULL,
-    &protobuf_c_empty_string,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "source",
+    "panid",
     3,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_UINT32,
-    offsetof(CurrentTime, source_present_case),
-    offsetof(CurrentTime, source),
+    offsetof(WPANStatus, panid_present_case),
+    offsetof(WPANStatus, panid),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
-};
-static const unsigned current_time__field_indices_by_name[] = {
-  1,   /* field[1] = iso8601 */
-  0,   /* field[0] = posix */
-  2,   /* field[2] = source */
-};
-static const ProtobufCIntRange current_time__number_ranges[1 + 1] =
-{
-  { 1, 0 },
-  { 0, 3 }
-};
-const ProtobufCMessageDescriptor current_time__descriptor =
-{
-  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
-  "CurrentTime",
-  "CurrentTime",
-  "CurrentTime",
-  "",
-  sizeof(CurrentTime),
-  3,
-  current_time__field_descriptors,
-  current_time__field_indices_by_name,
-  1,  current_time__number_ranges,
-  (ProtobufCMessageInit) current_time__init,
-  NULL,NULL,NULL    /* reserved[123] */
-};
-static const ProtobufCFieldDescriptor uptime__field_descriptors[1] =
-{
   {
-    "sysUpTime",
-    1,
+    "master",
+    4,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_UINT32,
-    offsetof(Uptime, sys_up_time_present_case),
-    offsetof(Uptime, sysuptime),
+    PROTOBUF_C_TYPE_BOOL,
+    offsetof(WPANStatus, master_present_case),
+    offsetof(WPANStatus, master),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
-};
-static const unsigned uptime__field_indices_by_name[] = {
-  0,   /* field[0] = sysUpTime */
-};
-static const ProtobufCIntRange uptime__number_ranges[1 + 1] =
-{
-  { 1, 0 },
-  { 0, 1 }
-};
-const ProtobufCMessageDescriptor uptime__descriptor =
-{
-  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
-  "Uptime",
-  "Uptime",
-  "Uptime",
-  "",
-  sizeof(Uptime),
-  1,
-  uptime__field_descriptors,
-  uptime__field_indices_by_name,
-  1,  uptime__number_ranges,
-  (ProtobufCMessageInit) uptime__init,
-  NULL,NULL,NULL    /* reserved[123] */
-};
-static const ProtobufCFieldDescriptor interface_metrics__field_descriptors[12] =
-{
   {
-    "ifIndex",
-    1,
-    PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_INT32,
-    offsetof(InterfaceMetrics, if_index_present_case),
-    offsetof(InterfaceMetrics, ifindex),
+    "dot1xEnabled",
+    5,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_BOOL,
+    offsetof(WPANStatus, dot1x_enabled_present_case),
+    offsetof(WPANStatus, dot1xenabled),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "ifInSpeed",
-    2,
+    "securityLevel",
+    6,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_UINT32,
-    offsetof(InterfaceMetrics, if_in_speed_present_case),
-    offsetof(InterfaceMetrics, ifinspeed),
+    offsetof(WPANStatus, security_level_present_case),
+    offsetof(WPANStatus, securitylevel),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "ifOutSpeed",
-    3,
+    "rank",
+    7,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_UINT32,
-    offsetof(InterfaceMetrics, if_out_speed_present_case),
-    offsetof(InterfaceMetrics, ifoutspeed),
+    offsetof(WPANStatus, rank_present_case),
+    offsetof(WPANStatus, rank),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "ifAdminStatus",
-    4,
+    "beaconValid",
+    8,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_UINT32,
-    offsetof(InterfaceMetrics, if_admin_status_present_case),
-    offsetof(InterfaceMetrics, ifadminstatus),
+    PROTOBUF_C_TYPE_BOOL,
+    offsetof(WPANStatus, beacon_valid_present_case),
+    offsetof(WPANStatus, beaconvalid),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "ifOperStatus",
-    5,
+    "beaconVersion",
+    9,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_UINT32,
-    offsetof(InterfaceMetrics, if_oper_status_present_case),
-    offsetof(InterfaceMetrics, ifoperstatus),
+    offsetof(WPANStatus, beacon_version_present_case),
+    offsetof(WPANStatus, beaconversion),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "ifLastChange",
-    6,
+    "beaconAge",
+    10,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_UINT32,
-    offsetof(InterfaceMetrics, if_last_change_present_case),
-    offsetof(InterfaceMetrics, iflastchange),
+    offsetof(WPANStatus, beacon_age_present_case),
+    offsetof(WPANStatus, beaconage),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "ifInOctets",
-    7,
+    "txPower",
+    11,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_UINT32,
-    offsetof(InterfaceMetrics, if_in_octets_present_case),
-    offsetof(InterfaceMetrics, ifinoctets),
+    PROTOBUF_C_TYPE_INT32,
+    offsetof(WPANStatus, tx_power_present_case),
+    offsetof(WPANStatus, txpower),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "ifOutOctets",
-    8,
+    "dagSize",
+    12,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_UINT32,
-    offsetof(InterfaceMetrics, if_out_octets_present_case),
-    offsetof(InterfaceMetrics, ifoutoctets),
+    offsetof(WPANStatus, dag_size_present_case),
+    offsetof(WPANStatus, dagsize),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "ifInDiscards",
-    9,
+    "metric",
+    13,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_UINT32,
-    offsetof(InterfaceMetrics, if_in_discards_present_case),
-    offsetof(InterfaceMetrics, ifindiscards),
+    offsetof(WPANStatus, metric_present_case),
+    offsetof(WPANStatus, metric),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "ifInErrors",
-    10,
+    "lastChanged",
+    14,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_UINT32,
-    offsetof(InterfaceMetrics, if_in_errors_present_case),
-    offsetof(InterfaceMetrics, ifinerrors),
+    offsetof(WPANStatus, last_changed_present_case),
+    offsetof(WPANStatus, lastchanged),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "ifOutDiscards",
-    11,
+    "lastChangedReason",
+    15,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_UINT32,
-    offsetof(InterfaceMetrics, if_out_discards_present_case),
-    offsetof(InterfaceMetrics, ifoutdiscards),
+    offsetof(WPANStatus, last_changed_reason_present_case),
+    offsetof(WPANStatus, lastchangedreason),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "ifOutErrors",
-    12,
+    "demoModeEnabled",
+    16,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_UINT32,
-    offsetof(InterfaceMetrics, if_out_errors_present_case),
-    offsetof(InterfaceMetrics, ifouterrors),
+    PROTOBUF_C_TYPE_BOOL,
+    offsetof(WPANStatus, demo_mode_enabled_present_case),
+    offsetof(WPANStatus, demomodeenabled),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
 };
-static const unsigned interface_metrics__field_indices_by_name[] = {
-  3,   /* field[3] = ifAdminStatus */
-  8,   /* field[8] = ifInDiscards */
-  9,   /* field[9] = ifInErrors */
-  6,   /* field[6] = ifInOctets */
-  1,   /* field[1] = ifInSpeed */
+static const unsigned wpanstatus__field_indices_by_name[] = {
+  1,   /* field[1] = SSID */
+  9,   /* field[9] = beaconAge */
+  7,   /* field[7] = beaconValid */
+  8,   /* field[8] = beaconVersion */
+  11,   /* field[11] = dagSize */
+  15,   /* field[15] = demoModeEnabled */
+  4,   /* field[4] = dot1xEnabled */
   0,   /* field[0] = ifIndex */
-  5,   /* field[5] = ifLastChange */
-  4,   /* field[4] = ifOperStatus */
-  10,   /* field[10] = ifOutDiscards */
-  11,   /* field[11] = ifOutErrors */
-  7,   /* field[7] = ifOutOctets */
-  2,   /* field[2] = ifOutSpeed */
+  13,   /* field[13] = lastChanged */
+  14,   /* field[14] = lastChangedReason */
+  3,   /* field[3] = master */
+  12,   /* field[12] = metric */
+  2,   /* field[2] = panid */
+  6,   /* field[6] = rank */
+  5,   /* field[5] = securityLevel */
+  10,   /* field[10] = txPower */
 };
-static const ProtobufCIntRange interface_metrics__number_ranges[1 + 1] =
+static const ProtobufCIntRange wpanstatus__number_ranges[1 + 1] =
 {
   { 1, 0 },
-  { 0, 12 }
+  { 0, 16 }
 };
-const ProtobufCMessageDescriptor interface_metrics__descriptor =
+const ProtobufCMessageDescriptor wpanstatus__descriptor =
 {
   PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
-  "InterfaceMetrics",
-  "InterfaceMetrics",
-  "InterfaceMetrics",
+  "WPANStatus",
+  "WPANStatus",
+  "WPANStatus",
   "",
-  sizeof(InterfaceMetrics),
-  12,
-  interface_metrics__field_descriptors,
-  interface_metrics__field_indices_by_name,
-  1,  interface_metrics__number_ranges,
-  (ProtobufCMessageInit) interface_metrics__init,
+  sizeof(WPANStatus),
+  16,
+  wpanstatus__field_descriptors,
+  wpanstatus__field_indices_by_name,
+  1,  wpanstatus__number_ranges,
+  (ProtobufCMessageInit) wpanstatus__init,
   NULL,NULL,NULL    /* reserved[123] */
 };
-static const ProtobufCFieldDescriptor iproute_rplmetrics__field_descriptors[11] =
+static const ProtobufCFieldDescriptor neighbor802154_g__field_descriptors[7] =
 {
   {
-    "inetCidrRouteIndex",
+    "nbrIndex",
     1,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_INT32,
-    offsetof(IPRouteRPLMetrics, inet_cidr_route_index_present_case),
-    offsetof(IPRouteRPLMetrics, inetcidrrouteindex),
+    offsetof(Neighbor802154G, nbr_index_present_case),
+    offsetof(Neighbor802154G, nbrindex),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "instanceIndex",
+    "physAddress",
     2,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_INT32,
-    offsetof(IPRouteRPLMetrics, instance_index_present_case),
-    offsetof(IPRouteRPLMetrics, instanceindex),
+    PROTOBUF_C_TYPE_BYTES,
+    offsetof(Neighbor802154G, phys_address_present_case),
+    offsetof(Neighbor802154G, physaddress),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "rank",
+    "lastChanged",
     3,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_INT32,
-    offsetof(IPRouteRPLMetrics, rank_present_case),
-    offsetof(IPRouteRPLMetrics, rank),
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(Neighbor802154G, last_changed_present_case),
+    offsetof(Neighbor802154G, lastchanged),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "hops",
+    "rssiForward",
     4,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_INT32,
-    offsetof(IPRouteRPLMetrics, hops_present_case),
-    offsetof(IPRouteRPLMetrics, hops),
+    PROTOBUF_C_TYPE_SINT32,
+    offsetof(Neighbor802154G, rssi_forward_present_case),
+    offsetof(Neighbor802154G, rssiforward),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "pathEtx",
+    "rssiReverse",
     5,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_INT32,
-    offsetof(IPRouteRPLMetrics, path_etx_present_case),
-    offsetof(IPRouteRPLMetrics, pathetx),
+    PROTOBUF_C_TYPE_SINT32,
+    offsetof(Neighbor802154G, rssi_reverse_present_case),
+    offsetof(Neighbor802154G, rssireverse),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "linkEtx",
+    "lqiForward",
     6,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_INT32,
-    offsetof(IPRouteRPLMetrics, link_etx_present_case),
-    offsetof(IPRouteRPLMetrics, linketx),
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(Neighbor802154G, lqi_forward_present_case),
+    offsetof(Neighbor802154G, lqiforward),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "rssiForward",
+    "lqiReverse",
     7,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_SINT32,
-    offsetof(IPRouteRPLMetrics, rssi_forward_present_case),
-    offsetof(IPRouteRPLMetrics, rssiforward),
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(Neighbor802154G, lqi_reverse_present_case),
+    offsetof(Neighbor802154G, lqireverse),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+};
+static const unsigned neighbor802154_g__field_indices_by_name[] = {
+  2,   /* field[2] = lastChanged */
+  5,   /* field[5] = lqiForward */
+  6,   /* field[6] = lqiReverse */
+  0,   /* field[0] = nbrIndex */
+  1,   /* field[1] = physAddress */
+  3,   /* field[3] = rssiForward */
+  4,   /* field[4] = rssiReverse */
+};
+static const ProtobufCIntRange neighbor802154_g__number_ranges[1 + 1] =
+{
+  { 1, 0 },
+  { 0, 7 }
+};
+const ProtobufCMessageDescriptor neighbor802154_g__descriptor =
+{
+  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
+  "Neighbor802154G",
+  "Neighbor802154G",
+  "Neighbor802154G",
+  "",
+  sizeof(Neighbor802154G),
+  7,
+  neighbor802154_g__field_descriptors,
+  neighbor802154_g__field_indices_by_name,
+  1,  neighbor802154_g__number_ranges,
+  (ProtobufCMessageInit) neighbor802154_g__init,
+  NULL,NULL,NULL    /* reserved[123] */
+};
+static const ProtobufCFieldDescriptor rplinstance__field_descriptors[7] =
+{
+  {
+    "instanceIndex",
+    1,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_INT32,
+    offsetof(RPLInstance, instance_index_present_case),
+    offsetof(RPLInstance, instanceindex),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "rssiReverse",
-    8,
+    "instanceId",
+    2,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_SINT32,
-    offsetof(IPRouteRPLMetrics, rssi_reverse_present_case),
-    offsetof(IPRouteRPLMetrics, rssireverse),
+    PROTOBUF_C_TYPE_INT32,
+    offsetof(RPLInstance, instance_id_present_case),
+    offsetof(RPLInstance, instanceid),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "lqiForward",
-    9,
+    "doDagId",
+    3,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_BYTES,
+    offsetof(RPLInstance, do_dag_id_present_case),
+    offsetof(RPLInstance, dodagid),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "doDagVersionNumber",
+    4,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_INT32,
-    offsetof(IPRouteRPLMetrics, lqi_forward_present_case),
-    offsetof(IPRouteRPLMetrics, lqiforward),
+    offsetof(RPLInstance, do_dag_version_number_present_case),
+    offsetof(RPLInstance, dodagversionnumber),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "rank",
+    5,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_INT32,
+    offsetof(RPLInstance, rank_present_case),
+    offsetof(RPLInstance, rank),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "lqiReverse",
-    10,
+    "parentCount",
+    6,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_INT32,
-    offsetof(IPRouteRPLMetrics, lqi_reverse_present_case),
-    offsetof(IPRouteRPLMetrics, lqireverse),
+    offsetof(RPLInstance, parent_count_present_case),
+    offsetof(RPLInstance, parentcount),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
@@ -2978,448 +4091,606 @@ static const ProtobufCFieldDescriptor iproute_rplmetrics__field_descriptors[11]
   },
   {
     "dagSize",
-    11,
+    7,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_UINT32,
-    offsetof(IPRouteRPLMetrics, dag_size_present_case),
-    offsetof(IPRouteRPLMetrics, dagsize),
+    offsetof(RPLInstance, dag_size_present_case),
+    offsetof(RPLInstance, dagsize),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
 };
-static const unsigned iproute_rplmetrics__field_indices_by_name[] = {
-  10,   /* field[10] = dagSize */
-  3,   /* field[3] = hops */
-  0,   /* field[0] = inetCidrRouteIndex */
-  1,   /* field[1] = instanceIndex */
-  5,   /* field[5] = linkEtx */
-  8,   /* field[8] = lqiForward */
-  9,   /* field[9] = lqiReverse */
-  4,   /* field[4] = pathEtx */
-  2,   /* field[2] = rank */
-  6,   /* field[6] = rssiForward */
-  7,   /* field[7] = rssiReverse */
+static const unsigned rplinstance__field_indices_by_name[] = {
+  6,   /* field[6] = dagSize */
+  2,   /* field[2] = doDagId */
+  3,   /* field[3] = doDagVersionNumber */
+  1,   /* field[1] = instanceId */
+  0,   /* field[0] = instanceIndex */
+  5,   /* field[5] = parentCount */
+  4,   /* field[4] = rank */
 };
-static const ProtobufCIntRange iproute_rplmetrics__number_ranges[1 + 1] =
+static const ProtobufCIntRange rplinstance__number_ranges[1 + 1] =
 {
   { 1, 0 },
-  { 0, 11 }
+  { 0, 7 }
 };
-const ProtobufCMessageDescriptor iproute_rplmetrics__descriptor =
+const ProtobufCMessageDescriptor rplinstance__descriptor =
 {
   PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
-  "IPRouteRPLMetrics",
-  "IPRouteRPLMetrics",
-  "IPRouteRPLMetrics",
+  "RPLInstance",
+  "RPLInstance",
+  "RPLInstance",
   "",
-  sizeof(IPRouteRPLMetrics),
-  11,
-  iproute_rplmetrics__field_descriptors,
-  iproute_rplmetrics__field_indices_by_name,
-  1,  iproute_rplmetrics__number_ranges,
-  (ProtobufCMessageInit) iproute_rplmetrics__init,
+  sizeof(RPLInstance),
+  7,
+  rplinstance__field_descriptors,
+  rplinstance__field_indices_by_name,
+  1,  rplinstance__number_ranges,
+  (ProtobufCMessageInit) rplinstance__init,
   NULL,NULL,NULL    /* reserved[123] */
 };
-static const ProtobufCFieldDescriptor wpanstatus__field_descriptors[16] =
+static const ProtobufCFieldDescriptor hardware_info__field_descriptors[2] =
 {
   {
-    "ifIndex",
+    "hwId",
     1,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_INT32,
-    offsetof(WPANStatus, if_index_present_case),
-    offsetof(WPANStatus, ifindex),
-    NULL,
+    PROTOBUF_C_TYPE_STRING,
+    offsetof(HardwareInfo, hw_id_present_case),
+    offsetof(HardwareInfo, hwid),
     NULL,
+    &protobuf_c_empty_string,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "SSID",
+    "vendorHwId",
     2,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_BYTES,
-    offsetof(WPANStatus, ssid_present_case),
-    offsetof(WPANStatus, ssid),
-    NULL,
+    PROTOBUF_C_TYPE_STRING,
+    offsetof(HardwareInfo, vendor_hw_id_present_case),
+    offsetof(HardwareInfo, vendorhwid),
     NULL,
+    &protobuf_c_empty_string,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
+};
+static const unsigned hardware_info__field_indices_by_name[] = {
+  0,   /* field[0] = hwId */
+  1,   /* field[1] = vendorHwId */
+};
+static const ProtobufCIntRange hardware_info__number_ranges[1 + 1] =
+{
+  { 1, 0 },
+  { 0, 2 }
+};
+const ProtobufCMessageDescriptor hardware_info__descriptor =
+{
+  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
+  "HardwareInfo",
+  "HardwareInfo",
+  "HardwareInfo",
+  "",
+  sizeof(HardwareInfo),
+  2,
+  hardware_info__field_descriptors,
+  hardware_info__field_indices_by_name,
+  1,  hardware_info__number_ranges,
+  (ProtobufCMessageInit) hardware_info__init,
+  NULL,NULL,NULL    /* reserved[123] */
+};
+static const ProtobufCFieldDescriptor transfer_request__field_descriptors[6] =
+{
   {
-    "panid",
-    3,
+    "fileHash",
+    1,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_UINT32,
-    offsetof(WPANStatus, panid_present_case),
-    offsetof(WPANStatus, panid),
+    PROTOBUF_C_TYPE_BYTES,
+    offsetof(TransferRequest, file_hash_present_case),
+    offsetof(TransferRequest, filehash),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "master",
-    4,
+    "fileName",
+    2,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_BOOL,
-    offsetof(WPANStatus, master_present_case),
-    offsetof(WPANStatus, master),
-    NULL,
+    PROTOBUF_C_TYPE_STRING,
+    offsetof(TransferRequest, file_name_present_case),
+    offsetof(TransferRequest, filename),
     NULL,
+    &protobuf_c_empty_string,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "dot1xEnabled",
-    5,
+    "version",
+    3,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_BOOL,
-    offsetof(WPANStatus, dot1x_enabled_present_case),
-    offsetof(WPANStatus, dot1xenabled),
-    NULL,
+    PROTOBUF_C_TYPE_STRING,
+    offsetof(TransferRequest, version_present_case),
+    offsetof(TransferRequest, version),
     NULL,
+    &protobuf_c_empty_string,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "securityLevel",
-    6,
+    "fileSize",
+    4,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_UINT32,
-    offsetof(WPANStatus, security_level_present_case),
-    offsetof(WPANStatus, securitylevel),
+    offsetof(TransferRequest, file_size_present_case),
+    offsetof(TransferRequest, filesize),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "rank",
-    7,
+    "blockSize",
+    5,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_UINT32,
-    offsetof(WPANStatus, rank_present_case),
-    offsetof(WPANStatus, rank),
+    offsetof(TransferRequest, block_size_present_case),
+    offsetof(TransferRequest, blocksize),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "beaconValid",
-    8,
+    "hwInfo",
+    6,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_BOOL,
-    offsetof(WPANStatus, beacon_valid_present_case),
-    offsetof(WPANStatus, beaconvalid),
-    NULL,
+    PROTOBUF_C_TYPE_MESSAGE,
+    0,   /* quantifier_offset */
+    offsetof(TransferRequest, hwinfo),
+    &hardware_info__descriptor,
     NULL,
-    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
+};
+static const unsigned transfer_request__field_indices_by_name[] = {
+  4,   /* field[4] = blockSize */
+  0,   /* field[0] = fileHash */
+  1,   /* field[1] = fileName */
+  3,   /* field[3] = fileSize */
+  5,   /* field[5] = hwInfo */
+  2,   /* field[2] = version */
+};
+static const ProtobufCIntRange transfer_request__number_ranges[1 + 1] =
+{
+  { 1, 0 },
+  { 0, 6 }
+};
+const ProtobufCMessageDescriptor transfer_request__descriptor =
+{
+  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
+  "TransferRequest",
+  "TransferRequest",
+  "TransferRequest",
+  "",
+  sizeof(TransferRequest),
+  6,
+  transfer_request__field_descriptors,
+  transfer_request__field_indices_by_name,
+  1,  transfer_request__number_ranges,
+  (ProtobufCMessageInit) transfer_request__init,
+  NULL,NULL,NULL    /* reserved[123] */
+};
+static const ProtobufCFieldDescriptor image_block__field_descriptors[3] =
+{
   {
-    "beaconVersion",
-    9,
+    "fileHash",
+    1,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_UINT32,
-    offsetof(WPANStatus, beacon_version_present_case),
-    offsetof(WPANStatus, beaconversion),
+    PROTOBUF_C_TYPE_BYTES,
+    offsetof(ImageBlock, file_hash_present_case),
+    offsetof(ImageBlock, filehash),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "beaconAge",
-    10,
+    "blockNum",
+    2,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_UINT32,
-    offsetof(WPANStatus, beacon_age_present_case),
-    offsetof(WPANStatus, beaconage),
-    NULL,
-    NULL,
-    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
-    0,NULL,NULL    /* reserved1,reserved2, etc */
-  },
-  {
-    "txPower",
-    11,
-    PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_INT32,
-    offsetof(WPANStatus, tx_power_present_case),
-    offsetof(WPANStatus, txpower),
+    offsetof(ImageBlock, block_num_present_case),
+    offsetof(ImageBlock, blocknum),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "dagSize",
-    12,
+    "blockData",
+    3,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_UINT32,
-    offsetof(WPANStatus, dag_size_present_case),
-    offsetof(WPANStatus, dagsize),
+    PROTOBUF_C_TYPE_BYTES,
+    offsetof(ImageBlock, block_data_present_case),
+    offsetof(ImageBlock, blockdata),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
+};
+static const unsigned image_block__field_indices_by_name[] = {
+  2,   /* field[2] = blockData */
+  1,   /* field[1] = blockNum */
+  0,   /* field[0] = fileHash */
+};
+static const ProtobufCIntRange image_block__number_ranges[1 + 1] =
+{
+  { 1, 0 },
+  { 0, 3 }
+};
+const ProtobufCMessageDescriptor image_block__descriptor =
+{
+  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
+  "ImageBlock",
+  "ImageBlock",
+  "ImageBlock",
+  "",
+  sizeof(ImageBlock),
+  3,
+  image_block__field_descriptors,
+  image_block__field_indices_by_name,
+  1,  image_block__number_ranges,
+  (ProtobufCMessageInit) image_block__init,
+  NULL,NULL,NULL    /* reserved[123] */
+};
+static const ProtobufCFieldDescriptor load_request__field_descriptors[2] =
+{
   {
-    "metric",
-    13,
+    "fileHash",
+    1,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_UINT32,
-    offsetof(WPANStatus, metric_present_case),
-    offsetof(WPANStatus, metric),
+    PROTOBUF_C_TYPE_BYTES,
+    offsetof(LoadRequest, file_hash_present_case),
+    offsetof(LoadRequest, filehash),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "lastChanged",
-    14,
+    "loadTime",
+    2,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_UINT32,
-    offsetof(WPANStatus, last_changed_present_case),
-    offsetof(WPANStatus, lastchanged),
+    offsetof(LoadRequest, load_time_present_case),
+    offsetof(LoadRequest, loadtime),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
+};
+static const unsigned load_request__field_indices_by_name[] = {
+  0,   /* field[0] = fileHash */
+  1,   /* field[1] = loadTime */
+};
+static const ProtobufCIntRange load_request__number_ranges[1 + 1] =
+{
+  { 1, 0 },
+  { 0, 2 }
+};
+const ProtobufCMessageDescriptor load_request__descriptor =
+{
+  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
+  "LoadRequest",
+  "LoadRequest",
+  "LoadRequest",
+  "",
+  sizeof(LoadRequest),
+  2,
+  load_request__field_descriptors,
+  load_request__field_indices_by_name,
+  1,  load_request__number_ranges,
+  (ProtobufCMessageInit) load_request__init,
+  NULL,NULL,NULL    /* reserved[123] */
+};
+static const ProtobufCFieldDescriptor cancel_load_request__field_descriptors[1] =
+{
   {
-    "lastChangedReason",
-    15,
+    "fileHash",
+    1,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_UINT32,
-    offsetof(WPANStatus, last_changed_reason_present_case),
-    offsetof(WPANStatus, lastchangedreason),
+    PROTOBUF_C_TYPE_BYTES,
+    offsetof(CancelLoadRequest, file_hash_present_case),
+    offsetof(CancelLoadRequest, filehash),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
+};
+static const unsigned cancel_load_request__field_indices_by_name[] = {
+  0,   /* field[0] = fileHash */
+};
+static const ProtobufCIntRange cancel_load_request__number_ranges[1 + 1] =
+{
+  { 1, 0 },
+  { 0, 1 }
+};
+const ProtobufCMessageDescriptor cancel_load_request__descriptor =
+{
+  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
+  "CancelLoadRequest",
+  "CancelLoadRequest",
+  "CancelLoadRequest",
+  "",
+  sizeof(CancelLoadRequest),
+  1,
+  cancel_load_request__field_descriptors,
+  cancel_load_request__field_indices_by_name,
+  1,  cancel_load_request__number_ranges,
+  (ProtobufCMessageInit) cancel_load_request__init,
+  NULL,NULL,NULL    /* reserved[123] */
+};
+static const ProtobufCFieldDescriptor set_backup_request__field_descriptors[1] =
+{
   {
-    "demoModeEnabled",
-    16,
+    "fileHash",
+    1,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_BOOL,
-    offsetof(WPANStatus, demo_mode_enabled_present_case),
-    offsetof(WPANStatus, demomodeenabled),
+    PROTOBUF_C_TYPE_BYTES,
+    offsetof(SetBackupRequest, file_hash_present_case),
+    offsetof(SetBackupRequest, filehash),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
 };
-static const unsigned wpanstatus__field_indices_by_name[] = {
-  1,   /* field[1] = SSID */
-  9,   /* field[9] = beaconAge */
-  7,   /* field[7] = beaconValid */
-  8,   /* field[8] = beaconVersion */
-  11,   /* field[11] = dagSize */
-  15,   /* field[15] = demoModeEnabled */
-  4,   /* field[4] = dot1xEnabled */
-  0,   /* field[0] = ifIndex */
-  13,   /* field[13] = lastChanged */
-  14,   /* field[14] = lastChangedReason */
-  3,   /* field[3] = master */
-  12,   /* field[12] = metric */
-  2,   /* field[2] = panid */
-  6,   /* field[6] = rank */
-  5,   /* field[5] = securityLevel */
-  10,   /* field[10] = txPower */
+static const unsigned set_backup_request__field_indices_by_name[] = {
+  0,   /* field[0] = fileHash */
 };
-static const ProtobufCIntRange wpanstatus__number_ranges[1 + 1] =
+static const ProtobufCIntRange set_backup_request__number_ranges[1 + 1] =
 {
   { 1, 0 },
-  { 0, 16 }
+  { 0, 1 }
 };
-const ProtobufCMessageDescriptor wpanstatus__descriptor =
+const ProtobufCMessageDescriptor set_backup_request__descriptor =
 {
   PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
-  "WPANStatus",
-  "WPANStatus",
-  "WPANStatus",
+  "SetBackupRequest",
+  "SetBackupRequest",
+  "SetBackupRequest",
   "",
-  sizeof(WPANStatus),
-  16,
-  wpanstatus__field_descriptors,
-  wpanstatus__field_indices_by_name,
-  1,  wpanstatus__number_ranges,
-  (ProtobufCMessageInit) wpanstatus__init,
+  sizeof(SetBackupRequest),
+  1,
+  set_backup_request__field_descriptors,
+  set_backup_request__field_indices_by_name,
+  1,  set_backup_request__number_ranges,
+  (ProtobufCMessageInit) set_backup_request__init,
   NULL,NULL,NULL    /* reserved[123] */
 };
-static const ProtobufCFieldDescriptor rplinstance__field_descriptors[7] =
+static const ProtobufCFieldDescriptor transfer_response__field_descriptors[3] =
 {
   {
-    "instanceIndex",
+    "fileHash",
     1,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_INT32,
-    offsetof(RPLInstance, instance_index_present_case),
-    offsetof(RPLInstance, instanceindex),
+    PROTOBUF_C_TYPE_BYTES,
+    offsetof(TransferResponse, file_hash_present_case),
+    offsetof(TransferResponse, filehash),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "instanceId",
+    "response",
     2,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_INT32,
-    offsetof(RPLInstance, instance_id_present_case),
-    offsetof(RPLInstance, instanceid),
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(TransferResponse, response_present_case),
+    offsetof(TransferResponse, response),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "doDagId",
+    "missingBlocks",
     3,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_BYTES,
-    offsetof(RPLInstance, do_dag_id_present_case),
-    offsetof(RPLInstance, dodagid),
+    offsetof(TransferResponse, missing_blocks_present_case),
+    offsetof(TransferResponse, missingblocks),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
+};
+static const unsigned transfer_response__field_indices_by_name[] = {
+  0,   /* field[0] = fileHash */
+  2,   /* field[2] = missingBlocks */
+  1,   /* field[1] = response */
+};
+static const ProtobufCIntRange transfer_response__number_ranges[1 + 1] =
+{
+  { 1, 0 },
+  { 0, 3 }
+};
+const ProtobufCMessageDescriptor transfer_response__descriptor =
+{
+  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
+  "TransferResponse",
+  "TransferResponse",
+  "TransferResponse",
+  "",
+  sizeof(TransferResponse),
+  3,
+  transfer_response__field_descriptors,
+  transfer_response__field_indices_by_name,
+  1,  transfer_response__number_ranges,
+  (ProtobufCMessageInit) transfer_response__init,
+  NULL,NULL,NULL    /* reserved[123] */
+};
+static const ProtobufCFieldDescriptor load_response__field_descriptors[2] =
+{
   {
-    "doDagVersionNumber",
-    4,
+    "fileHash",
+    1,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_INT32,
-    offsetof(RPLInstance, do_dag_version_number_present_case),
-    offsetof(RPLInstance, dodagversionnumber),
+    PROTOBUF_C_TYPE_BYTES,
+    offsetof(LoadResponse, file_hash_present_case),
+    offsetof(LoadResponse, filehash),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "rank",
-    5,
+    "response",
+    2,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_INT32,
-    offsetof(RPLInstance, rank_present_case),
-    offsetof(RPLInstance, rank),
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(LoadResponse, response_present_case),
+    offsetof(LoadResponse, response),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
+};
+static const unsigned load_response__field_indices_by_name[] = {
+  0,   /* field[0] = fileHash */
+  1,   /* field[1] = response */
+};
+static const ProtobufCIntRange load_response__number_ranges[1 + 1] =
+{
+  { 1, 0 },
+  { 0, 2 }
+};
+const ProtobufCMessageDescriptor load_response__descriptor =
+{
+  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
+  "LoadResponse",
+  "LoadResponse",
+  "LoadResponse",
+  "",
+  sizeof(LoadResponse),
+  2,
+  load_response__field_descriptors,
+  load_response__field_indices_by_name,
+  1,  load_response__number_ranges,
+  (ProtobufCMessageInit) load_response__init,
+  NULL,NULL,NULL    /* reserved[123] */
+};
+static const ProtobufCFieldDescriptor cancel_load_response__field_descriptors[2] =
+{
   {
-    "parentCount",
-    6,
+    "fileHash",
+    1,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_INT32,
-    offsetof(RPLInstance, parent_count_present_case),
-    offsetof(RPLInstance, parentcount),
+    PROTOBUF_C_TYPE_BYTES,
+    offsetof(CancelLoadResponse, file_hash_present_case),
+    offsetof(CancelLoadResponse, filehash),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "dagSize",
-    7,
+    "response",
+    2,
     PROTOBUF_C_LABEL_NONE,
     PROTOBUF_C_TYPE_UINT32,
-    offsetof(RPLInstance, dag_size_present_case),
-    offsetof(RPLInstance, dagsize),
+    offsetof(CancelLoadResponse, response_present_case),
+    offsetof(CancelLoadResponse, response),
     NULL,
     NULL,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
 };
-static const unsigned rplinstance__field_indices_by_name[] = {
-  6,   /* field[6] = dagSize */
-  2,   /* field[2] = doDagId */
-  3,   /* field[3] = doDagVersionNumber */
-  1,   /* field[1] = instanceId */
-  0,   /* field[0] = instanceIndex */
-  5,   /* field[5] = parentCount */
-  4,   /* field[4] = rank */
+static const unsigned cancel_load_response__field_indices_by_name[] = {
+  0,   /* field[0] = fileHash */
+  1,   /* field[1] = response */
 };
-static const ProtobufCIntRange rplinstance__number_ranges[1 + 1] =
+static const ProtobufCIntRange cancel_load_response__number_ranges[1 + 1] =
 {
   { 1, 0 },
-  { 0, 7 }
+  { 0, 2 }
 };
-const ProtobufCMessageDescriptor rplinstance__descriptor =
+const ProtobufCMessageDescriptor cancel_load_response__descriptor =
 {
   PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
-  "RPLInstance",
-  "RPLInstance",
-  "RPLInstance",
+  "CancelLoadResponse",
+  "CancelLoadResponse",
+  "CancelLoadResponse",
   "",
-  sizeof(RPLInstance),
-  7,
-  rplinstance__field_descriptors,
-  rplinstance__field_indices_by_name,
-  1,  rplinstance__number_ranges,
-  (ProtobufCMessageInit) rplinstance__init,
+  sizeof(CancelLoadResponse),
+  2,
+  cancel_load_response__field_descriptors,
+  cancel_load_response__field_indices_by_name,
+  1,  cancel_load_response__number_ranges,
+  (ProtobufCMessageInit) cancel_load_response__init,
   NULL,NULL,NULL    /* reserved[123] */
 };
-static const ProtobufCFieldDescriptor hardware_info__field_descriptors[2] =
+static const ProtobufCFieldDescriptor set_backup_response__field_descriptors[2] =
 {
   {
-    "hwId",
+    "fileHash",
     1,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_STRING,
-    offsetof(HardwareInfo, hw_id_present_case),
-    offsetof(HardwareInfo, hwid),
+    PROTOBUF_C_TYPE_BYTES,
+    offsetof(SetBackupResponse, file_hash_present_case),
+    offsetof(SetBackupResponse, filehash),
+    NULL,
     NULL,
-    &protobuf_c_empty_string,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
   {
-    "vendorHwId",
+    "response",
     2,
     PROTOBUF_C_LABEL_NONE,
-    PROTOBUF_C_TYPE_STRING,
-    offsetof(HardwareInfo, vendor_hw_id_present_case),
-    offsetof(HardwareInfo, vendorhwid),
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(SetBackupResponse, response_present_case),
+    offsetof(SetBackupResponse, response),
+    NULL,
     NULL,
-    &protobuf_c_empty_string,
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
 };
-static const unsigned hardware_info__field_indices_by_name[] = {
-  0,   /* field[0] = hwId */
-  1,   /* field[1] = vendorHwId */
+static const unsigned set_backup_response__field_indices_by_name[] = {
+  0,   /* field[0] = fileHash */
+  1,   /* field[1] = response */
 };
-static const ProtobufCIntRange hardware_info__number_ranges[1 + 1] =
+static const ProtobufCIntRange set_backup_response__number_ranges[1 + 1] =
 {
   { 1, 0 },
   { 0, 2 }
 };
-const ProtobufCMessageDescriptor hardware_info__descriptor =
+const ProtobufCMessageDescriptor set_backup_response__descriptor =
 {
   PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
-  "HardwareInfo",
-  "HardwareInfo",
-  "HardwareInfo",
+  "SetBackupResponse",
+  "SetBackupResponse",
+  "SetBackupResponse",
   "",
-  sizeof(HardwareInfo),
+  sizeof(SetBackupResponse),
   2,
-  hardware_info__field_descriptors,
-  hardware_info__field_indices_by_name,
-  1,  hardware_info__number_ranges,
-  (ProtobufCMessageInit) hardware_info__init,
+  set_backup_response__field_descriptors,
+  set_backup_response__field_indices_by_name,
+  1,  set_backup_response__number_ranges,
+  (ProtobufCMessageInit) set_backup_response__init,
   NULL,NULL,NULL    /* reserved[123] */
 };
 static const ProtobufCFieldDescriptor firmware_image_info__field_descriptors[11] =
@@ -3590,3 +4861,144 @@ const ProtobufCMessageDescriptor firmware_image_info__descriptor =
   (ProtobufCMessageInit) firmware_image_info__init,
   NULL,NULL,NULL    /* reserved[123] */
 };
+static const ProtobufCFieldDescriptor event_report__field_descriptors[5] =
+{
+  {
+    "eventCode",
+    1,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(EventReport, event_code_present_case),
+    offsetof(EventReport, eventcode),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "vendorId",
+    2,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(EventReport, vendor_id_present_case),
+    offsetof(EventReport, vendorid),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "priority",
+    3,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(EventReport, priority_present_case),
+    offsetof(EventReport, priority),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "timestamp",
+    4,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(EventReport, timestamp_present_case),
+    offsetof(EventReport, timestamp),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "count",
+    5,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(EventReport, count_present_case),
+    offsetof(EventReport, count),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+};
+static const unsigned event_report__field_indices_by_name[] = {
+  4,   /* field[4] = count */
+  0,   /* field[0] = eventCode */
+  2,   /* field[2] = priority */
+  3,   /* field[3] = timestamp */
+  1,   /* field[1] = vendorId */
+};
+static const ProtobufCIntRange event_report__number_ranges[1 + 1] =
+{
+  { 1, 0 },
+  { 0, 5 }
+};
+const ProtobufCMessageDescriptor event_report__descriptor =
+{
+  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
+  "EventReport",
+  "EventReport",
+  "EventReport",
+  "",
+  sizeof(EventReport),
+  5,
+  event_report__field_descriptors,
+  event_report__field_indices_by_name,
+  1,  event_report__number_ranges,
+  (ProtobufCMessageInit) event_report__init,
+  NULL,NULL,NULL    /* reserved[123] */
+};
+static const ProtobufCFieldDescriptor nmsredirect_request__field_descriptors[2] =
+{
+  {
+    "url",
+    1,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_STRING,
+    offsetof(NMSRedirectRequest, url_present_case),
+    offsetof(NMSRedirectRequest, url),
+    NULL,
+    &protobuf_c_empty_string,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "holdTime",
+    2,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(NMSRedirectRequest, hold_time_present_case),
+    offsetof(NMSRedirectRequest, holdtime),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+};
+static const unsigned nmsredirect_request__field_indices_by_name[] = {
+  1,   /* field[1] = holdTime */
+  0,   /* field[0] = url */
+};
+static const ProtobufCIntRange nmsredirect_request__number_ranges[1 + 1] =
+{
+  { 1, 0 },
+  { 0, 2 }
+};
+const ProtobufCMessageDescriptor nmsredirect_request__descriptor =
+{
+  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
+  "NMSRedirectRequest",
+  "NMSRedirectRequest",
+  "NMSRedirectRequest",
+  "",
+  sizeof(NMSRedirectRequest),
+  2,
+  nmsredirect_request__field_descriptors,
+  nmsredirect_request__field_indices_by_name,
+  1,  nmsredirect_request__number_ranges,
+  (ProtobufCMessageInit) nmsredirect_request__init,
+  NULL,NULL,NULL    /* reserved[123] */
+};
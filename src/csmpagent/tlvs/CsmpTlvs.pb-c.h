@@ -37,9 +37,21 @@ typedef struct Uptime Uptime;
 typedef struct InterfaceMetrics InterfaceMetrics;
 typedef struct IPRouteRPLMetrics IPRouteRPLMetrics;
 typedef struct WPANStatus WPANStatus;
+typedef struct Neighbor802154G Neighbor802154G;
 typedef struct RPLInstance RPLInstance;
 typedef struct HardwareInfo HardwareInfo;
+typedef struct TransferRequest TransferRequest;
+typedef struct ImageBlock ImageBlock;
+typedef struct LoadRequest LoadRequest;
+typedef struct CancelLoadRequest CancelLoadRequest;
+typedef struct SetBackupRequest SetBackupRequest;
+typedef struct TransferResponse TransferResponse;
+typedef struct LoadResponse LoadResponse;
+typedef struct CancelLoadResponse CancelLoadResponse;
+typedef struct SetBackupResponse SetBackupResponse;
 typedef struct FirmwareImageInfo FirmwareImageInfo;
+typedef struct EventReport EventReport;
+typedef struct NMSRedirectRequest NMSRedirectRequest;
 
 
 /* --- enums --- */
@@ -135,6 +147,18 @@ typedef enum {
     PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(REPORT_SUBSCRIBE__INTERVAL_PRESENT__CASE)
 } ReportSubscribe__IntervalPresentCase;
 
+typedef enum {
+  REPORT_SUBSCRIBE__PHASE_PRESENT__NOT_SET = 0,
+  REPORT_SUBSCRIBE__PHASE_PRESENT_PHASE = 3
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(REPORT_SUBSCRIBE__PHASE_PRESENT__CASE)
+} ReportSubscribe__PhasePresentCase;
+
+typedef enum {
+  REPORT_SUBSCRIBE__INDEX_PRESENT__NOT_SET = 0,
+  REPORT_SUBSCRIBE__INDEX_PRESENT_INDEX = 4
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(REPORT_SUBSCRIBE__INDEX_PRESENT__CASE)
+} ReportSubscribe__IndexPresentCase;
+
 /*
  * TLV 13
  */
@@ -147,10 +171,18 @@ struct  ReportSubscribe
   union {
     uint32_t interval;
   };
+  ReportSubscribe__PhasePresentCase phase_present_case;
+  union {
+    uint32_t phase;
+  };
+  ReportSubscribe__IndexPresentCase index_present_case;
+  union {
+    uint32_t index;
+  };
 };
 #define REPORT_SUBSCRIBE__INIT \
  { PROTOBUF_C_MESSAGE_INIT (&report_subscribe__descriptor) \
-    , 0,NULL, REPORT_SUBSCRIBE__INTERVAL_PRESENT__NOT_SET, {0} }
+    , 0,NULL, REPORT_SUBSCRIBE__INTERVAL_PRESENT__NOT_SET, {0}, REPORT_SUBSCRIBE__PHASE_PRESENT__NOT_SET, {0}, REPORT_SUBSCRIBE__INDEX_PRESENT__NOT_SET, {0} }
 
 
 typedef enum {
@@ -165,6 +197,12 @@ typedef enum {
     PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(CGMSSETTINGS__REG_INTERVAL_MAX_PRESENT__CASE)
 } CGMSSettings__RegIntervalMaxPresentCase;
 
+typedef enum {
+  CGMSSETTINGS__REG_BACKOFF_PRESENT__NOT_SET = 0,
+  CGMSSETTINGS__REG_BACKOFF_PRESENT_REG_BACKOFF = 3
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(CGMSSETTINGS__REG_BACKOFF_PRESENT__CASE)
+} CGMSSettings__RegBackoffPresentCase;
+
 /*
  * TLV 42
  */
@@ -179,10 +217,14 @@ struct  CGMSSettings
   union {
     uint32_t regintervalmax;
   };
+  CGMSSettings__RegBackoffPresentCase reg_backoff_present_case;
+  union {
+    uint32_t regbackoff;
+  };
 };
 #define CGMSSETTINGS__INIT \
  { PROTOBUF_C_MESSAGE_INIT (&cgmssettings__descriptor) \
-    , CGMSSETTINGS__REG_INTERVAL_MIN_PRESENT__NOT_SET, {0}, CGMSSETTINGS__REG_INTERVAL_MAX_PRESENT__NOT_SET, {0} }
+    , CGMSSETTINGS__REG_INTERVAL_MIN_PRESENT__NOT_SET, {0}, CGMSSETTINGS__REG_INTERVAL_MAX_PRESENT__NOT_SET, {0}, CGMSSETTINGS__REG_BACKOFF_PRESENT__NOT_SET, {0} }
 
 
 typedef enum {
@@ -321,6 +363,36 @@ typedef enum {
     PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(CGMSSTATS__NMS_ERRORS_PRESENT__CASE)
 } CGMSStats__NmsErrorsPresentCase;
 
+typedef enum {
+  CGMSSTATS__REG_RTT_PRESENT__NOT_SET = 0,
+  CGMSSTATS__REG_RTT_PRESENT_REG_RTT = 10
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(CGMSSTATS__REG_RTT_PRESENT__CASE)
+} CGMSStats__RegRttPresentCase;
+
+typedef enum {
+  CGMSSTATS__REG_RTT_MAX_PRESENT__NOT_SET = 0,
+  CGMSSTATS__REG_RTT_MAX_PRESENT_REG_RTT_MAX = 11
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(CGMSSTATS__REG_RTT_MAX_PRESENT__CASE)
+} CGMSStats__RegRttMaxPresentCase;
+
+typedef enum {
+  CGMSSTATS__REG_RETRANSMITS_PRESENT__NOT_SET = 0,
+  CGMSSTATS__REG_RETRANSMITS_PRESENT_REG_RETRANSMITS = 12
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(CGMSSTATS__REG_RETRANSMITS_PRESENT__CASE)
+} CGMSStats__RegRetransmitsPresentCase;
+
+typedef enum {
+  CGMSSTATS__REPORT_LATENCY_PRESENT__NOT_SET = 0,
+  CGMSSTATS__REPORT_LATENCY_PRESENT_REPORT_LATENCY = 13
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(CGMSSTATS__REPORT_LATENCY_PRESENT__CASE)
+} CGMSStats__ReportLatencyPresentCase;
+
+typedef enum {
+  CGMSSTATS__REPORT_LATENCY_MAX_PRESENT__NOT_SET = 0,
+  CGMSSTATS__REPORT_LATENCY_MAX_PRESENT_REPORT_LATENCY_MAX = 14
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(CGMSSTATS__REPORT_LATENCY_MAX_PRESENT__CASE)
+} CGMSStats__ReportLatencyMaxPresentCase;
+
 /*
  * TLV 45
  */
@@ -363,10 +435,30 @@ struct  CGMSStats
   union {
     uint32_t nmserrors;
   };
+  CGMSStats__RegRttPresentCase reg_rtt_present_case;
+  union {
+    uint32_t regrtt;
+  };
+  CGMSStats__RegRttMaxPresentCase reg_rtt_max_present_case;
+  union {
+    uint32_t regrttmax;
+  };
+  CGMSStats__RegRetransmitsPresentCase reg_retransmits_present_case;
+  union {
+    uint32_t regretransmits;
+  };
+  CGMSStats__ReportLatencyPresentCase report_latency_present_case;
+  union {
+    uint32_t reportlatency;
+  };
+  CGMSStats__ReportLatencyMaxPresentCase report_latency_max_present_case;
+  union {
+    uint32_t reportlatencymax;
+  };
 };
 #define CGMSSTATS__INIT \
  { PROTOBUF_C_MESSAGE_INIT (&cgmsstats__descriptor) \
-    , CGMSSTATS__SIG_OK_PRESENT__NOT_SET, {0}, CGMSSTATS__SIG_BAD_AUTH_PRESENT__NOT_SET, {0}, CGMSSTATS__SIG_BAD_VALIDITY_PRESENT__NOT_SET, {0}, CGMSSTATS__SIG_NO_SYNC_PRESENT__NOT_SET, {0}, CGMSSTATS__REG_SUCCEED_PRESENT__NOT_SET, {0}, CGMSSTATS__REG_ATTEMPTS_PRESENT__NOT_SET, {0}, CGMSSTATS__REG_HOLDS_PRESENT__NOT_SET, {0}, CGMSSTATS__REG_FAILS_PRESENT__NOT_SET, {0}, CGMSSTATS__NMS_ERRORS_PRESENT__NOT_SET, {0} }
+    , CGMSSTATS__SIG_OK_PRESENT__NOT_SET, {0}, CGMSSTATS__SIG_BAD_AUTH_PRESENT__NOT_SET, {0}, CGMSSTATS__SIG_BAD_VALIDITY_PRESENT__NOT_SET, {0}, CGMSSTATS__SIG_NO_SYNC_PRESENT__NOT_SET, {0}, CGMSSTATS__REG_SUCCEED_PRESENT__NOT_SET, {0}, CGMSSTATS__REG_ATTEMPTS_PRESENT__NOT_SET, {0}, CGMSSTATS__REG_HOLDS_PRESENT__NOT_SET, {0}, CGMSSTATS__REG_FAILS_PRESENT__NOT_SET, {0}, CGMSSTATS__NMS_ERRORS_PRESENT__NOT_SET, {0}, CGMSSTATS__REG_RTT_PRESENT__NOT_SET, {0}, CGMSSTATS__REG_RTT_MAX_PRESENT__NOT_SET, {0}, CGMSSTATS__REG_RETRANSMITS_PRESENT__NOT_SET, {0}, CGMSSTATS__REPORT_LATENCY_PRESENT__NOT_SET, {0}, CGMSSTATS__REPORT_LATENCY_MAX_PRESENT__NOT_SET, {0} }
 
 
 typedef enum {
@@ -1515,6 +1607,88 @@ struct  WPANStatus
     , WPANSTATUS__IF_INDEX_PRESENT__NOT_SET, {0}, WPANSTATUS__SSID_PRESENT__NOT_SET, {0}, WPANSTATUS__PANID_PRESENT__NOT_SET, {0}, WPANSTATUS__MASTER_PRESENT__NOT_SET, {0}, WPANSTATUS__DOT1X_ENABLED_PRESENT__NOT_SET, {0}, WPANSTATUS__SECURITY_LEVEL_PRESENT__NOT_SET, {0}, WPANSTATUS__RANK_PRESENT__NOT_SET, {0}, WPANSTATUS__BEACON_VALID_PRESENT__NOT_SET, {0}, WPANSTATUS__BEACON_VERSION_PRESENT__NOT_SET, {0}, WPANSTATUS__BEACON_AGE_PRESENT__NOT_SET, {0}, WPANSTATUS__TX_POWER_PRESENT__NOT_SET, {0}, WPANSTATUS__DAG_SIZE_PRESENT__NOT_SET, {0}, WPANSTATUS__METRIC_PRESENT__NOT_SET, {0}, WPANSTATUS__LAST_CHANGED_PRESENT__NOT_SET, {0}, WPANSTATUS__LAST_CHANGED_REASON_PRESENT__NOT_SET, {0}, WPANSTATUS__DEMO_MODE_ENABLED_PRESENT__NOT_SET, {0} }
 
 
+typedef enum {
+  NEIGHBOR802154_G__NBR_INDEX_PRESENT__NOT_SET = 0,
+  NEIGHBOR802154_G__NBR_INDEX_PRESENT_NBR_INDEX = 1
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(NEIGHBOR802154_G__NBR_INDEX_PRESENT__CASE)
+} Neighbor802154G__NbrIndexPresentCase;
+
+typedef enum {
+  NEIGHBOR802154_G__PHYS_ADDRESS_PRESENT__NOT_SET = 0,
+  NEIGHBOR802154_G__PHYS_ADDRESS_PRESENT_PHYS_ADDRESS = 2
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(NEIGHBOR802154_G__PHYS_ADDRESS_PRESENT__CASE)
+} Neighbor802154G__PhysAddressPresentCase;
+
+typedef enum {
+  NEIGHBOR802154_G__LAST_CHANGED_PRESENT__NOT_SET = 0,
+  NEIGHBOR802154_G__LAST_CHANGED_PRESENT_LAST_CHANGED = 3
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(NEIGHBOR802154_G__LAST_CHANGED_PRESENT__CASE)
+} Neighbor802154G__LastChangedPresentCase;
+
+typedef enum {
+  NEIGHBOR802154_G__RSSI_FORWARD_PRESENT__NOT_SET = 0,
+  NEIGHBOR802154_G__RSSI_FORWARD_PRESENT_RSSI_FORWARD = 4
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(NEIGHBOR802154_G__RSSI_FORWARD_PRESENT__CASE)
+} Neighbor802154G__RssiForwardPresentCase;
+
+typedef enum {
+  NEIGHBOR802154_G__RSSI_REVERSE_PRESENT__NOT_SET = 0,
+  NEIGHBOR802154_G__RSSI_REVERSE_PRESENT_RSSI_REVERSE = 5
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(NEIGHBOR802154_G__RSSI_REVERSE_PRESENT__CASE)
+} Neighbor802154G__RssiReversePresentCase;
+
+typedef enum {
+  NEIGHBOR802154_G__LQI_FORWARD_PRESENT__NOT_SET = 0,
+  NEIGHBOR802154_G__LQI_FORWARD_PRESENT_LQI_FORWARD = 6
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(NEIGHBOR802154_G__LQI_FORWARD_PRESENT__CASE)
+} Neighbor802154G__LqiForwardPresentCase;
+
+typedef enum {
+  NEIGHBOR802154_G__LQI_REVERSE_PRESENT__NOT_SET = 0,
+  NEIGHBOR802154_G__LQI_REVERSE_PRESENT_LQI_REVERSE = 7
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(NEIGHBOR802154_G__LQI_REVERSE_PRESENT__CASE)
+} Neighbor802154G__LqiReversePresentCase;
+
+/*
+ * TLV 52
+ */
+struct  Neighbor802154G
+{
+  ProtobufCMessage base;
+  Neighbor802154G__NbrIndexPresentCase nbr_index_present_case;
+  union {
+    int32_t nbrindex;
+  };
+  Neighbor802154G__PhysAddressPresentCase phys_address_present_case;
+  union {
+    ProtobufCBinaryData physaddress;
+  };
+  Neighbor802154G__LastChangedPresentCase last_changed_present_case;
+  union {
+    uint32_t lastchanged;
+  };
+  Neighbor802154G__RssiForwardPresentCase rssi_forward_present_case;
+  union {
+    int32_t rssiforward;
+  };
+  Neighbor802154G__RssiReversePresentCase rssi_reverse_present_case;
+  union {
+    int32_t rssireverse;
+  };
+  Neighbor802154G__LqiForwardPresentCase lqi_forward_present_case;
+  union {
+    uint32_t lqiforward;
+  };
+  Neighbor802154G__LqiReversePresentCase lqi_reverse_present_case;
+  union {
+    uint32_t lqireverse;
+  };
+};
+#define NEIGHBOR802154_G__INIT \
+ { PROTOBUF_C_MESSAGE_INIT (&neighbor802154_g__descriptor) \
+    , NEIGHBOR802154_G__NBR_INDEX_PRESENT__NOT_SET, {0}, NEIGHBOR802154_G__PHYS_ADDRESS_PRESENT__NOT_SET, {0}, NEIGHBOR802154_G__LAST_CHANGED_PRESENT__NOT_SET, {0}, NEIGHBOR802154_G__RSSI_FORWARD_PRESENT__NOT_SET, {0}, NEIGHBOR802154_G__RSSI_REVERSE_PRESENT__NOT_SET, {0}, NEIGHBOR802154_G__LQI_FORWARD_PRESENT__NOT_SET, {0}, NEIGHBOR802154_G__LQI_REVERSE_PRESENT__NOT_SET, {0} }
+
+
 typedef enum {
   RPLINSTANCE__INSTANCE_INDEX_PRESENT__NOT_SET = 0,
   RPLINSTANCE__INSTANCE_INDEX_PRESENT_INSTANCE_INDEX = 1
@@ -1629,6 +1803,325 @@ struct  HardwareInfo
     , HARDWARE_INFO__HW_ID_PRESENT__NOT_SET, {0}, HARDWARE_INFO__VENDOR_HW_ID_PRESENT__NOT_SET, {0} }
 
 
+typedef enum {
+  TRANSFER_REQUEST__FILE_HASH_PRESENT__NOT_SET = 0,
+  TRANSFER_REQUEST__FILE_HASH_PRESENT_FILE_HASH = 1
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(TRANSFER_REQUEST__FILE_HASH_PRESENT__CASE)
+} TransferRequest__FileHashPresentCase;
+
+typedef enum {
+  TRANSFER_REQUEST__FILE_NAME_PRESENT__NOT_SET = 0,
+  TRANSFER_REQUEST__FILE_NAME_PRESENT_FILE_NAME = 2
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(TRANSFER_REQUEST__FILE_NAME_PRESENT__CASE)
+} TransferRequest__FileNamePresentCase;
+
+typedef enum {
+  TRANSFER_REQUEST__VERSION_PRESENT__NOT_SET = 0,
+  TRANSFER_REQUEST__VERSION_PRESENT_VERSION = 3
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(TRANSFER_REQUEST__VERSION_PRESENT__CASE)
+} TransferRequest__VersionPresentCase;
+
+typedef enum {
+  TRANSFER_REQUEST__FILE_SIZE_PRESENT__NOT_SET = 0,
+  TRANSFER_REQUEST__FILE_SIZE_PRESENT_FILE_SIZE = 4
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(TRANSFER_REQUEST__FILE_SIZE_PRESENT__CASE)
+} TransferRequest__FileSizePresentCase;
+
+typedef enum {
+  TRANSFER_REQUEST__BLOCK_SIZE_PRESENT__NOT_SET = 0,
+  TRANSFER_REQUEST__BLOCK_SIZE_PRESENT_BLOCK_SIZE = 5
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(TRANSFER_REQUEST__BLOCK_SIZE_PRESENT__CASE)
+} TransferRequest__BlockSizePresentCase;
+
+/*
+ * TLV 65
+ */
+struct  TransferRequest
+{
+  ProtobufCMessage base;
+  HardwareInfo *hwinfo;
+  TransferRequest__FileHashPresentCase file_hash_present_case;
+  union {
+    ProtobufCBinaryData filehash;
+  };
+  TransferRequest__FileNamePresentCase file_name_present_case;
+  union {
+    char *filename;
+  };
+  TransferRequest__VersionPresentCase version_present_case;
+  union {
+    char *version;
+  };
+  TransferRequest__FileSizePresentCase file_size_present_case;
+  union {
+    uint32_t filesize;
+  };
+  TransferRequest__BlockSizePresentCase block_size_present_case;
+  union {
+    uint32_t blocksize;
+  };
+};
+#define TRANSFER_REQUEST__INIT \
+ { PROTOBUF_C_MESSAGE_INIT (&transfer_request__descriptor) \
+    , NULL, TRANSFER_REQUEST__FILE_HASH_PRESENT__NOT_SET, {0}, TRANSFER_REQUEST__FILE_NAME_PRESENT__NOT_SET, {0}, TRANSFER_REQUEST__VERSION_PRESENT__NOT_SET, {0}, TRANSFER_REQUEST__FILE_SIZE_PRESENT__NOT_SET, {0}, TRANSFER_REQUEST__BLOCK_SIZE_PRESENT__NOT_SET, {0} }
+
+
+typedef enum {
+  IMAGE_BLOCK__FILE_HASH_PRESENT__NOT_SET = 0,
+  IMAGE_BLOCK__FILE_HASH_PRESENT_FILE_HASH = 1
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(IMAGE_BLOCK__FILE_HASH_PRESENT__CASE)
+} ImageBlock__FileHashPresentCase;
+
+typedef enum {
+  IMAGE_BLOCK__BLOCK_NUM_PRESENT__NOT_SET = 0,
+  IMAGE_BLOCK__BLOCK_NUM_PRESENT_BLOCK_NUM = 2
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(IMAGE_BLOCK__BLOCK_NUM_PRESENT__CASE)
+} ImageBlock__BlockNumPresentCase;
+
+typedef enum {
+  IMAGE_BLOCK__BLOCK_DATA_PRESENT__NOT_SET = 0,
+  IMAGE_BLOCK__BLOCK_DATA_PRESENT_BLOCK_DATA = 3
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(IMAGE_BLOCK__BLOCK_DATA_PRESENT__CASE)
+} ImageBlock__BlockDataPresentCase;
+
+/*
+ * TLV 67
+ */
+struct  ImageBlock
+{
+  ProtobufCMessage base;
+  ImageBlock__FileHashPresentCase file_hash_present_case;
+  union {
+    ProtobufCBinaryData filehash;
+  };
+  ImageBlock__BlockNumPresentCase block_num_present_case;
+  union {
+    uint32_t blocknum;
+  };
+  ImageBlock__BlockDataPresentCase block_data_present_case;
+  union {
+    ProtobufCBinaryData blockdata;
+  };
+};
+#define IMAGE_BLOCK__INIT \
+ { PROTOBUF_C_MESSAGE_INIT (&image_block__descriptor) \
+    , IMAGE_BLOCK__FILE_HASH_PRESENT__NOT_SET, {0}, IMAGE_BLOCK__BLOCK_NUM_PRESENT__NOT_SET, {0}, IMAGE_BLOCK__BLOCK_DATA_PRESENT__NOT_SET, {0} }
+
+
+typedef enum {
+  LOAD_REQUEST__FILE_HASH_PRESENT__NOT_SET = 0,
+  LOAD_REQUEST__FILE_HASH_PRESENT_FILE_HASH = 1
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(LOAD_REQUEST__FILE_HASH_PRESENT__CASE)
+} LoadRequest__FileHashPresentCase;
+
+typedef enum {
+  LOAD_REQUEST__LOAD_TIME_PRESENT__NOT_SET = 0,
+  LOAD_REQUEST__LOAD_TIME_PRESENT_LOAD_TIME = 2
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(LOAD_REQUEST__LOAD_TIME_PRESENT__CASE)
+} LoadRequest__LoadTimePresentCase;
+
+/*
+ * TLV 68
+ */
+struct  LoadRequest
+{
+  ProtobufCMessage base;
+  LoadRequest__FileHashPresentCase file_hash_present_case;
+  union {
+    ProtobufCBinaryData filehash;
+  };
+  LoadRequest__LoadTimePresentCase load_time_present_case;
+  union {
+    uint32_t loadtime;
+  };
+};
+#define LOAD_REQUEST__INIT \
+ { PROTOBUF_C_MESSAGE_INIT (&load_request__descriptor) \
+    , LOAD_REQUEST__FILE_HASH_PRESENT__NOT_SET, {0}, LOAD_REQUEST__LOAD_TIME_PRESENT__NOT_SET, {0} }
+
+
+typedef enum {
+  CANCEL_LOAD_REQUEST__FILE_HASH_PRESENT__NOT_SET = 0,
+  CANCEL_LOAD_REQUEST__FILE_HASH_PRESENT_FILE_HASH = 1
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(CANCEL_LOAD_REQUEST__FILE_HASH_PRESENT__CASE)
+} CancelLoadRequest__FileHashPresentCase;
+
+/*
+ * TLV 69
+ */
+struct  CancelLoadRequest
+{
+  ProtobufCMessage base;
+  CancelLoadRequest__FileHashPresentCase file_hash_present_case;
+  union {
+    ProtobufCBinaryData filehash;
+  };
+};
+#define CANCEL_LOAD_REQUEST__INIT \
+ { PROTOBUF_C_MESSAGE_INIT (&cancel_load_request__descriptor) \
+    , CANCEL_LOAD_REQUEST__FILE_HASH_PRESENT__NOT_SET, {0} }
+
+
+typedef enum {
+  SET_BACKUP_REQUEST__FILE_HASH_PRESENT__NOT_SET = 0,
+  SET_BACKUP_REQUEST__FILE_HASH_PRESENT_FILE_HASH = 1
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(SET_BACKUP_REQUEST__FILE_HASH_PRESENT__CASE)
+} SetBackupRequest__FileHashPresentCase;
+
+/*
+ * TLV 70
+ */
+struct  SetBackupRequest
+{
+  ProtobufCMessage base;
+  SetBackupRequest__FileHashPresentCase file_hash_present_case;
+  union {
+    ProtobufCBinaryData filehash;
+  };
+};
+#define SET_BACKUP_REQUEST__INIT \
+ { PROTOBUF_C_MESSAGE_INIT (&set_backup_request__descriptor) \
+    , SET_BACKUP_REQUEST__FILE_HASH_PRESENT__NOT_SET, {0} }
+
+
+typedef enum {
+  TRANSFER_RESPONSE__FILE_HASH_PRESENT__NOT_SET = 0,
+  TRANSFER_RESPONSE__FILE_HASH_PRESENT_FILE_HASH = 1
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(TRANSFER_RESPONSE__FILE_HASH_PRESENT__CASE)
+} TransferResponse__FileHashPresentCase;
+
+typedef enum {
+  TRANSFER_RESPONSE__RESPONSE_PRESENT__NOT_SET = 0,
+  TRANSFER_RESPONSE__RESPONSE_PRESENT_RESPONSE = 2
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(TRANSFER_RESPONSE__RESPONSE_PRESENT__CASE)
+} TransferResponse__ResponsePresentCase;
+
+typedef enum {
+  TRANSFER_RESPONSE__MISSING_BLOCKS_PRESENT__NOT_SET = 0,
+  TRANSFER_RESPONSE__MISSING_BLOCKS_PRESENT_MISSING_BLOCKS = 3
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(TRANSFER_RESPONSE__MISSING_BLOCKS_PRESENT__CASE)
+} TransferResponse__MissingBlocksPresentCase;
+
+/*
+ * TLV 71
+ */
+struct  TransferResponse
+{
+  ProtobufCMessage base;
+  TransferResponse__FileHashPresentCase file_hash_present_case;
+  union {
+    ProtobufCBinaryData filehash;
+  };
+  TransferResponse__ResponsePresentCase response_present_case;
+  union {
+    uint32_t response;
+  };
+  TransferResponse__MissingBlocksPresentCase missing_blocks_present_case;
+  union {
+    ProtobufCBinaryData missingblocks;
+  };
+};
+#define TRANSFER_RESPONSE__INIT \
+ { PROTOBUF_C_MESSAGE_INIT (&transfer_response__descriptor) \
+    , TRANSFER_RESPONSE__FILE_HASH_PRESENT__NOT_SET, {0}, TRANSFER_RESPONSE__RESPONSE_PRESENT__NOT_SET, {0}, TRANSFER_RESPONSE__MISSING_BLOCKS_PRESENT__NOT_SET, {0} }
+
+
+typedef enum {
+  LOAD_RESPONSE__FILE_HASH_PRESENT__NOT_SET = 0,
+  LOAD_RESPONSE__FILE_HASH_PRESENT_FILE_HASH = 1
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(LOAD_RESPONSE__FILE_HASH_PRESENT__CASE)
+} LoadResponse__FileHashPresentCase;
+
+typedef enum {
+  LOAD_RESPONSE__RESPONSE_PRESENT__NOT_SET = 0,
+  LOAD_RESPONSE__RESPONSE_PRESENT_RESPONSE = 2
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(LOAD_RESPONSE__RESPONSE_PRESENT__CASE)
+} LoadResponse__ResponsePresentCase;
+
+/*
+ * TLV 72
+ */
+struct  LoadResponse
+{
+  ProtobufCMessage base;
+  LoadResponse__FileHashPresentCase file_hash_present_case;
+  union {
+    ProtobufCBinaryData filehash;
+  };
+  LoadResponse__ResponsePresentCase response_present_case;
+  union {
+    uint32_t response;
+  };
+};
+#define LOAD_RESPONSE__INIT \
+ { PROTOBUF_C_MESSAGE_INIT (&load_response__descriptor) \
+    , LOAD_RESPONSE__FILE_HASH_PRESENT__NOT_SET, {0}, LOAD_RESPONSE__RESPONSE_PRESENT__NOT_SET, {0} }
+
+
+typedef enum {
+  CANCEL_LOAD_RESPONSE__FILE_HASH_PRESENT__NOT_SET = 0,
+  CANCEL_LOAD_RESPONSE__FILE_HASH_PRESENT_FILE_HASH = 1
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(CANCEL_LOAD_RESPONSE__FILE_HASH_PRESENT__CASE)
+} CancelLoadResponse__FileHashPresentCase;
+
+typedef enum {
+  CANCEL_LOAD_RESPONSE__RESPONSE_PRESENT__NOT_SET = 0,
+  CANCEL_LOAD_RESPONSE__RESPONSE_PRESENT_RESPONSE = 2
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(CANCEL_LOAD_RESPONSE__RESPONSE_PRESENT__CASE)
+} CancelLoadResponse__ResponsePresentCase;
+
+/*
+ * TLV 73
+ */
+struct  CancelLoadResponse
+{
+  ProtobufCMessage base;
+  CancelLoadResponse__FileHashPresentCase file_hash_present_case;
+  union {
+    ProtobufCBinaryData filehash;
+  };
+  CancelLoadResponse__ResponsePresentCase response_present_case;
+  union {
+    uint32_t response;
+  };
+};
+#define CANCEL_LOAD_RESPONSE__INIT \
+ { PROTOBUF_C_MESSAGE_INIT (&cancel_load_response__descriptor) \
+    , CANCEL_LOAD_RESPONSE__FILE_HASH_PRESENT__NOT_SET, {0}, CANCEL_LOAD_RESPONSE__RESPONSE_PRESENT__NOT_SET, {0} }
+
+
+typedef enum {
+  SET_BACKUP_RESPONSE__FILE_HASH_PRESENT__NOT_SET = 0,
+  SET_BACKUP_RESPONSE__FILE_HASH_PRESENT_FILE_HASH = 1
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(SET_BACKUP_RESPONSE__FILE_HASH_PRESENT__CASE)
+} SetBackupResponse__FileHashPresentCase;
+
+typedef enum {
+  SET_BACKUP_RESPONSE__RESPONSE_PRESENT__NOT_SET = 0,
+  SET_BACKUP_RESPONSE__RESPONSE_PRESENT_RESPONSE = 2
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(SET_BACKUP_RESPONSE__RESPONSE_PRESENT__CASE)
+} SetBackupResponse__ResponsePresentCase;
+
+/*
+ * TLV 74
+ */
+struct  SetBackupResponse
+{
+  ProtobufCMessage base;
+  SetBackupResponse__FileHashPresentCase file_hash_present_case;
+  union {
+    ProtobufCBinaryData filehash;
+  };
+  SetBackupResponse__ResponsePresentCase response_present_case;
+  union {
+    uint32_t response;
+  };
+};
+#define SET_BACKUP_RESPONSE__INIT \
+ { PROTOBUF_C_MESSAGE_INIT (&set_backup_response__descriptor) \
+    , SET_BACKUP_RESPONSE__FILE_HASH_PRESENT__NOT_SET, {0}, SET_BACKUP_RESPONSE__RESPONSE_PRESENT__NOT_SET, {0} }
+
+
 typedef enum {
   FIRMWARE_IMAGE_INFO__INDEX_PRESENT__NOT_SET = 0,
   FIRMWARE_IMAGE_INFO__INDEX_PRESENT_INDEX = 1
@@ -1742,6 +2235,100 @@ struct  FirmwareImageInfo
     , NULL, FIRMWARE_IMAGE_INFO__INDEX_PRESENT__NOT_SET, {0}, FIRMWARE_IMAGE_INFO__FILE_HASH_PRESENT__NOT_SET, {0}, FIRMWARE_IMAGE_INFO__FILE_NAME_PRESENT__NOT_SET, {0}, FIRMWARE_IMAGE_INFO__VERSION_PRESENT__NOT_SET, {0}, FIRMWARE_IMAGE_INFO__FILE_SIZE_PRESENT__NOT_SET, {0}, FIRMWARE_IMAGE_INFO__BLOCK_SIZE_PRESENT__NOT_SET, {0}, FIRMWARE_IMAGE_INFO__BITMAP_PRESENT__NOT_SET, {0}, FIRMWARE_IMAGE_INFO__IS_DEFAULT_PRESENT__NOT_SET, {0}, FIRMWARE_IMAGE_INFO__IS_RUNNING_PRESENT__NOT_SET, {0}, FIRMWARE_IMAGE_INFO__LOAD_TIME_PRESENT__NOT_SET, {0} }
 
 
+typedef enum {
+  EVENT_REPORT__EVENT_CODE_PRESENT__NOT_SET = 0,
+  EVENT_REPORT__EVENT_CODE_PRESENT_EVENT_CODE = 1
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(EVENT_REPORT__EVENT_CODE_PRESENT__CASE)
+} EventReport__EventCodePresentCase;
+
+typedef enum {
+  EVENT_REPORT__VENDOR_ID_PRESENT__NOT_SET = 0,
+  EVENT_REPORT__VENDOR_ID_PRESENT_VENDOR_ID = 2
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(EVENT_REPORT__VENDOR_ID_PRESENT__CASE)
+} EventReport__VendorIdPresentCase;
+
+typedef enum {
+  EVENT_REPORT__PRIORITY_PRESENT__NOT_SET = 0,
+  EVENT_REPORT__PRIORITY_PRESENT_PRIORITY = 3
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(EVENT_REPORT__PRIORITY_PRESENT__CASE)
+} EventReport__PriorityPresentCase;
+
+typedef enum {
+  EVENT_REPORT__TIMESTAMP_PRESENT__NOT_SET = 0,
+  EVENT_REPORT__TIMESTAMP_PRESENT_TIMESTAMP = 4
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(EVENT_REPORT__TIMESTAMP_PRESENT__CASE)
+} EventReport__TimestampPresentCase;
+
+typedef enum {
+  EVENT_REPORT__COUNT_PRESENT__NOT_SET = 0,
+  EVENT_REPORT__COUNT_PRESENT_COUNT = 5
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(EVENT_REPORT__COUNT_PRESENT__CASE)
+} EventReport__CountPresentCase;
+
+/*
+ * TLV 500
+ */
+struct  EventReport
+{
+  ProtobufCMessage base;
+  EventReport__EventCodePresentCase event_code_present_case;
+  union {
+    uint32_t eventcode;
+  };
+  EventReport__VendorIdPresentCase vendor_id_present_case;
+  union {
+    uint32_t vendorid;
+  };
+  EventReport__PriorityPresentCase priority_present_case;
+  union {
+    uint32_t priority;
+  };
+  EventReport__TimestampPresentCase timestamp_present_case;
+  union {
+    uint32_t timestamp;
+  };
+  EventReport__CountPresentCase count_present_case;
+  union {
+    uint32_t count;
+  };
+};
+#define EVENT_REPORT__INIT \
+ { PROTOBUF_C_MESSAGE_INIT (&event_report__descriptor) \
+    , EVENT_REPORT__EVENT_CODE_PRESENT__NOT_SET, {0}, EVENT_REPORT__VENDOR_ID_PRESENT__NOT_SET, {0}, EVENT_REPORT__PRIORITY_PRESENT__NOT_SET, {0}, EVENT_REPORT__TIMESTAMP_PRESENT__NOT_SET, {0}, EVENT_REPORT__COUNT_PRESENT__NOT_SET, {0} }
+
+
+typedef enum {
+  NMSREDIRECT_REQUEST__URL_PRESENT__NOT_SET = 0,
+  NMSREDIRECT_REQUEST__URL_PRESENT_URL = 1
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(NMSREDIRECT_REQUEST__URL_PRESENT__CASE)
+} NMSRedirectRequest__UrlPresentCase;
+
+typedef enum {
+  NMSREDIRECT_REQUEST__HOLD_TIME_PRESENT__NOT_SET = 0,
+  NMSREDIRECT_REQUEST__HOLD_TIME_PRESENT_HOLD_TIME = 2
+    PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(NMSREDIRECT_REQUEST__HOLD_TIME_PRESENT__CASE)
+} NMSRedirectRequest__HoldTimePresentCase;
+
+/*
+ * TLV 6
+ */
+struct  NMSRedirectRequest
+{
+  ProtobufCMessage base;
+  NMSRedirectRequest__UrlPresentCase url_present_case;
+  union {
+    char *url;
+  };
+  NMSRedirectRequest__HoldTimePresentCase hold_time_present_case;
+  union {
+    uint32_t holdtime;
+  };
+};
+#define NMSREDIRECT_REQUEST__INIT \
+ { PROTOBUF_C_MESSAGE_INIT (&nmsredirect_request__descriptor) \
+    , NMSREDIRECT_REQUEST__URL_PRESENT__NOT_SET, {0}, NMSREDIRECT_REQUEST__HOLD_TIME_PRESENT__NOT_SET, {0} }
+
+
 /* TlvIndex methods */
 void   tlv_index__init
                      (TlvIndex         *message);
@@ -2160,6 +2747,25 @@ WPANStatus *
 void   wpanstatus__free_unpacked
                      (WPANStatus *message,
                       ProtobufCAllocator *allocator);
+/* Neighbor802154G methods */
+void   neighbor802154_g__init
+                     (Neighbor802154G         *message);
+size_t neighbor802154_g__get_packed_size
+                     (const Neighbor802154G   *message);
+size_t neighbor802154_g__pack
+                     (const Neighbor802154G   *message,
+                      uint8_t             *out);
+size_t neighbor802154_g__pack_to_buffer
+                     (const Neighbor802154G   *message,
+                      ProtobufCBuffer     *buffer);
+Neighbor802154G *
+       neighbor802154_g__unpack
+                     (ProtobufCAllocator  *allocator,
+                      size_t               len,
+                      const uint8_t       *data);
+void   neighbor802154_g__free_unpacked
+                     (Neighbor802154G *message,
+                      ProtobufCAllocator *allocator);
 /* RPLInstance methods */
 void   rplinstance__init
                      (RPLInstance         *message);
@@ -2198,6 +2804,177 @@ HardwareInfo *
 void   hardware_info__free_unpacked
                      (HardwareInfo *message,
                       ProtobufCAllocator *allocator);
+/* TransferRequest methods */
+void   transfer_request__init
+                     (TransferRequest         *message);
+size_t transfer_request__get_packed_size
+                     (const TransferRequest   *message);
+size_t transfer_request__pack
+                     (const TransferRequest   *message,
+                      uint8_t             *out);
+size_t transfer_request__pack_to_buffer
+                     (const TransferRequest   *message,
+                      ProtobufCBuffer     *buffer);
+TransferRequest *
+       transfer_request__unpack
+                     (ProtobufCAllocator  *allocator,
+                      size_t               len,
+                      const uint8_t       *data);
+void   transfer_request__free_unpacked
+                     (TransferRequest *message,
+                      ProtobufCAllocator *allocator);
+/* ImageBlock methods */
+void   image_block__init
+                     (ImageBlock         *message);
+size_t image_block__get_packed_size
+                     (const ImageBlock   *message);
+size_t image_block__pack
+                     (const ImageBlock   *message,
+                      uint8_t             *out);
+size_t image_block__pack_to_buffer
+                     (const ImageBlock   *message,
+                      ProtobufCBuffer     *buffer);
+ImageBlock *
+       image_block__unpack
+                     (ProtobufCAllocator  *allocator,
+                      size_t               len,
+                      const uint8_t       *data);
+void   image_block__free_unpacked
+                     (ImageBlock *message,
+                      ProtobufCAllocator *allocator);
+/* LoadRequest methods */
+void   load_request__init
+                     (LoadRequest         *message);
+size_t load_request__get_packed_size
+                     (const LoadRequest   *message);
+size_t load_request__pack
+                     (const LoadRequest   *message,
+                      uint8_t             *out);
+size_t load_request__pack_to_buffer
+                     (const LoadRequest   *message,
+                      ProtobufCBuffer     *buffer);
+LoadRequest *
+       load_request__unpack
+                     (ProtobufCAllocator  *allocator,
+                      size_t               len,
+                      const uint8_t       *data);
+void   load_request__free_unpacked
+                     (LoadRequest *message,
+                      ProtobufCAllocator *allocator);
+/* CancelLoadRequest methods */
+void   cancel_load_request__init
+                     (CancelLoadRequest         *message);
+size_t cancel_load_request__get_packed_size
+                     (const CancelLoadRequest   *message);
+size_t cancel_load_request__pack
+                     (const CancelLoadRequest   *message,
+                      uint8_t             *out);
+size_t cancel_load_request__pack_to_buffer
+                     (const CancelLoadRequest   *message,
+                      ProtobufCBuffer     *buffer);
+CancelLoadRequest *
+       cancel_load_request__unpack
+                     (ProtobufCAllocator  *allocator,
+                      size_t               len,
+                      const uint8_t       *data);
+void   cancel_load_request__free_unpacked
+                     (CancelLoadRequest *message,
+                      ProtobufCAllocator *allocator);
+/* SetBackupRequest methods */
+void   set_backup_request__init
+                     (SetBackupRequest         *message);
+size_t set_backup_request__get_packed_size
+                     (const SetBackupRequest   *message);
+size_t set_backup_request__pack
+                     (const SetBackupRequest   *message,
+                      uint8_t             *out);
+size_t set_backup_request__pack_to_buffer
+                     (const SetBackupRequest   *message,
+                      ProtobufCBuffer     *buffer);
+SetBackupRequest *
+       set_backup_request__unpack
+                     (ProtobufCAllocator  *allocator,
+                      size_t               len,
+                      const uint8_t       *data);
+void   set_backup_request__free_unpacked
+                     (SetBackupRequest *message,
+                      ProtobufCAllocator *allocator);
+/* TransferResponse methods */
+void   transfer_response__init
+                     (TransferResponse         *message);
+size_t transfer_response__get_packed_size
+                     (const TransferResponse   *message);
+size_t transfer_response__pack
+                     (const TransferResponse   *message,
+                      uint8_t             *out);
+size_t transfer_response__pack_to_buffer
+                     (const TransferResponse   *message,
+                      ProtobufCBuffer     *buffer);
+TransferResponse *
+       transfer_response__unpack
+                     (ProtobufCAllocator  *allocator,
+                      size_t               len,
+                      const uint8_t       *data);
+void   transfer_response__free_unpacked
+                     (TransferResponse *message,
+                      ProtobufCAllocator *allocator);
+/* LoadResponse methods */
+void   load_response__init
+                     (LoadResponse         *message);
+size_t load_response__get_packed_size
+                     (const LoadResponse   *message);
+size_t load_response__pack
+                     (const LoadResponse   *message,
+                      uint8_t             *out);
+size_t load_response__pack_to_buffer
+                     (const LoadResponse   *message,
+                      ProtobufCBuffer     *buffer);
+LoadResponse *
+       load_response__unpack
+                     (ProtobufCAllocator  *allocator,
+                      size_t               len,
+                      const uint8_t       *data);
+void   load_response__free_unpacked
+                     (LoadResponse *message,
+                      ProtobufCAllocator *allocator);
+/* CancelLoadResponse methods */
+void   cancel_load_response__init
+                     (CancelLoadResponse         *message);
+size_t cancel_load_response__get_packed_size
+                     (const CancelLoadResponse   *message);
+size_t cancel_load_response__pack
+                     (const CancelLoadResponse   *message,
+                      uint8_t             *out);
+size_t cancel_load_response__pack_to_buffer
+                     (const CancelLoadResponse   *message,
+                      ProtobufCBuffer     *buffer);
+CancelLoadResponse *
+       cancel_load_response__unpack
+                     (ProtobufCAllocator  *allocator,
+                      size_t               len,
+                      const uint8_t       *data);
+void   cancel_load_response__free_unpacked
+                     (CancelLoadResponse *message,
+                      ProtobufCAllocator *allocator);
+/* SetBackupResponse methods */
+void   set_backup_response__init
+                     (SetBackupResponse         *message);
+size_t set_backup_response__get_packed_size
+                     (const SetBackupResponse   *message);
+size_t set_backup_response__pack
+                     (const SetBackupResponse   *message,
+                      uint8_t             *out);
+size_t set_backup_response__pack_to_buffer
+                     (const SetBackupResponse   *message,
+                      ProtobufCBuffer     *buffer);
+SetBackupResponse *
+       set_backup_response__unpack
+                     (ProtobufCAllocator  *allocator,
+                      size_t               len,
+                      const uint8_t       *data);
+void   set_backup_response__free_unpacked
+                     (SetBackupResponse *message,
+                      ProtobufCAllocator *allocator);
 /* FirmwareImageInfo methods */
 void   firmware_image_info__init
                      (FirmwareImageInfo         *message);
@@ -2217,6 +2994,44 @@ FirmwareImageInfo *
 void   firmware_image_info__free_unpacked
                      (FirmwareImageInfo *message,
                       ProtobufCAllocator *allocator);
+/* EventReport methods */
+void   event_report__init
+                     (EventReport         *message);
+size_t event_report__get_packed_size
+                     (const EventReport   *message);
+size_t event_report__pack
+                     (const EventReport   *message,
+                      uint8_t             *out);
+size_t event_report__pack_to_buffer
+                     (const EventReport   *message,
+                      ProtobufCBuffer     *buffer);
+EventReport *
+       event_report__unpack
+                     (ProtobufCAllocator  *allocator,
+                      size_t               len,
+                      const uint8_t       *data);
+void   event_report__free_unpacked
+                     (EventReport *message,
+                      ProtobufCAllocator *allocator);
+/* NMSRedirectRequest methods */
+void   nmsredirect_request__init
+                     (NMSRedirectRequest         *message);
+size_t nmsredirect_request__get_packed_size
+                     (const NMSRedirectRequest   *message);
+size_t nmsredirect_request__pack
+                     (const NMSRedirectRequest   *message,
+                      uint8_t             *out);
+size_t nmsredirect_request__pack_to_buffer
+                     (const NMSRedirectRequest   *message,
+                      ProtobufCBuffer     *buffer);
+NMSRedirectRequest *
+       nmsredirect_request__unpack
+                     (ProtobufCAllocator  *allocator,
+                      size_t               len,
+                      const uint8_t       *data);
+void   nmsredirect_request__free_unpacked
+                     (NMSRedirectRequest *message,
+                      ProtobufCAllocator *allocator);
 /* --- per-message closures --- */
 
 typedef void (*TlvIndex_Closure)
@@ -2285,15 +3100,51 @@ typedef void (*IPRouteRPLMetrics_Closure)
 typedef void (*WPANStatus_Closure)
                  (const WPANStatus *message,
                   void *closure_data);
+typedef void (*Neighbor802154G_Closure)
+                 (const Neighbor802154G *message,
+                  void *closure_data);
 typedef void (*RPLInstance_Closure)
                  (const RPLInstance *message,
                   void *closure_data);
 typedef void (*HardwareInfo_Closure)
                  (const HardwareInfo *message,
                   void *closure_data);
+typedef void (*TransferRequest_Closure)
+                 (const TransferRequest *message,
+                  void *closure_data);
+typedef void (*ImageBlock_Closure)
+                 (const ImageBlock *message,
+                  void *closure_data);
+typedef void (*LoadRequest_Closure)
+                 (const LoadRequest *message,
+                  void *closure_data);
+typedef void (*CancelLoadRequest_Closure)
+                 (const CancelLoadRequest *message,
+                  void *closure_data);
+typedef void (*SetBackupRequest_Closure)
+                 (const SetBackupRequest *message,
+                  void *closure_data);
+typedef void (*TransferResponse_Closure)
+                 (const TransferResponse *message,
+                  void *closure_data);
+typedef void (*LoadResponse_Closure)
+                 (const LoadResponse *message,
+                  void *closure_data);
+typedef void (*CancelLoadResponse_Closure)
+                 (const CancelLoadResponse *message,
+                  void *closure_data);
+typedef void (*SetBackupResponse_Closure)
+                 (const SetBackupResponse *message,
+                  void *closure_data);
 typedef void (*FirmwareImageInfo_Closure)
                  (const FirmwareImageInfo *message,
                   void *closure_data);
+typedef void (*EventReport_Closure)
+                 (const EventReport *message,
+                  void *closure_data);
+typedef void (*NMSRedirectRequest_Closure)
+                 (const NMSRedirectRequest *message,
+                  void *closure_data);
 
 /* --- services --- */
 
@@ -2322,9 +3173,21 @@ extern const ProtobufCMessageDescriptor uptime__descriptor;
 extern const ProtobufCMessageDescriptor interface_metrics__descriptor;
 extern const ProtobufCMessageDescriptor iproute_rplmetrics__descriptor;
 extern const ProtobufCMessageDescriptor wpanstatus__descriptor;
+extern const ProtobufCMessageDescriptor neighbor802154_g__descriptor;
 extern const ProtobufCMessageDescriptor rplinstance__descriptor;
 extern const ProtobufCMessageDescriptor hardware_info__descriptor;
+extern const ProtobufCMessageDescriptor transfer_request__descriptor;
+extern const ProtobufCMessageDescriptor image_block__descriptor;
+extern const ProtobufCMessageDescriptor load_request__descriptor;
+extern const ProtobufCMessageDescriptor cancel_load_request__descriptor;
+extern const ProtobufCMessageDescriptor set_backup_request__descriptor;
+extern const ProtobufCMessageDescriptor transfer_response__descriptor;
+extern const ProtobufCMessageDescriptor load_response__descriptor;
+extern const ProtobufCMessageDescriptor cancel_load_response__descriptor;
+extern const ProtobufCMessageDescriptor set_backup_response__descriptor;
 extern const ProtobufCMessageDescriptor firmware_image_info__descriptor;
+extern const ProtobufCMessageDescriptor event_report__descriptor;
+extern const ProtobufCMessageDescriptor nmsredirect_request__descriptor;
 
 PROTOBUF_C__END_DECLS
 
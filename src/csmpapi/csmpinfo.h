@@ -41,6 +41,9 @@ typedef struct _IPRoute_RPLMetrics IPRoute_RPLMetrics;
 typedef struct _WPAN_Status WPAN_Status;
 typedef struct _Neighbor_802154G Neighbor_802154G;
 typedef struct _RPL_Instance RPL_Instance;
+typedef struct _Load_Request Load_Request;
+typedef struct _Cancel_Load_Request Cancel_Load_Request;
+typedef struct _Set_Backup_Request Set_Backup_Request;
 typedef struct _Firmware_Image_Info Firmware_Image_Info;
 
 // HARDWARE_DESC
@@ -471,4 +474,45 @@ struct  _Firmware_Image_Info
 };
 #define FIRMWARE_IMAGE_INFO_INIT \
    { 0,0, 0,{0,{0}}, 0,{0}, 0,{0}, 0,0, 0,0, 0,{0,{0}}, 0,0, 0,0, 0,0, 0,{0,{0}, 0,{0}} }
+
+
+// LOAD_REQUEST
+struct  _Load_Request
+{
+  bool has_filehash;
+  struct {
+    size_t len;
+    uint8_t data[32];
+  } filehash;
+  bool has_loadtime;
+  uint32_t loadtime;
+};
+#define LOAD_REQUEST_INIT \
+ { 0,{0,{0}}, 0,0 }
+
+
+// CANCEL_LOAD_REQUEST
+struct  _Cancel_Load_Request
+{
+  bool has_filehash;
+  struct {
+    size_t len;
+    uint8_t data[32];
+  } filehash;
+};
+#define CANCEL_LOAD_REQUEST_INIT \
+ { 0,{0,{0}} }
+
+
+// SET_BACKUP_REQUEST
+struct  _Set_Backup_Request
+{
+  bool has_filehash;
+  struct {
+    size_t len;
+    uint8_t data[32];
+  } filehash;
+};
+#define SET_BACKUP_REQUEST_INIT \
+ { 0,{0,{0}} }
 #endif
@@ -24,17 +24,32 @@
 #include "csmpservice.h"
 #include "cgmsagent.h"
 #include "csmpserver.h"
+#include "reportqueue.h"
+#include "imageslot.h"
+#include "csmpevent.h"
+#include "csmplatency.h"
+#include "csmpstats.h"
+#include "csmpexport.h"
+#include "csmptlv.h"
+#include "coap.h"
+#include "debug.h"
 
 uint8_t g_csmplib_status = SERVICE_NOT_START;
 
 uint8_t g_csmplib_eui64[8];
 uint32_t g_csmplib_reginterval_min = 0;
 uint32_t g_csmplib_reginterval_max = 0;
+uint32_t g_csmplib_report_refresh = 0;
+uint32_t g_csmplib_report_queue_rate = 0;
+uint32_t g_csmplib_reg_storm_window = 0;
+bool g_csmplib_outage_recovery = false;
+coap_socket_config_t g_csmplib_socket_config = {0};
 
-csmp_service_stats_t g_csmplib_stats;
 
 csmptlvs_get_t g_csmptlvs_get;
 csmptlvs_post_t g_csmptlvs_post;
+csmptlvs_get_batch_t g_csmptlvs_get_batch;
+csmptlvs_get_rows_t g_csmptlvs_get_rows;
 signature_verify_t g_csmplib_signature_verify;
 
 int csmp_service_start(dev_config_t *devconfig, csmp_handle_t *csmp_handle) {
@@ -52,20 +67,53 @@ int csmp_service_start(dev_config_t *devconfig, csmp_handle_t *csmp_handle) {
   memcpy(g_csmplib_eui64, devconfig->ieee_eui64.data, sizeof(g_csmplib_eui64));
   g_csmplib_reginterval_min = devconfig->reginterval_min;
   g_csmplib_reginterval_max = devconfig->reginterval_max;
+  g_csmplib_report_refresh = devconfig->report_refresh;
+  g_csmplib_report_queue_rate = devconfig->report_queue_rate;
+  g_csmplib_reg_storm_window = devconfig->reg_storm_window;
+  g_csmplib_outage_recovery = devconfig->outage_recovery;
+  g_csmplib_socket_config.rcvbuf = devconfig->sock_rcvbuf;
+  g_csmplib_socket_config.sndbuf = devconfig->sock_sndbuf;
 
   g_csmptlvs_get = csmp_handle->csmptlvs_get;
   g_csmptlvs_post = csmp_handle->csmptlvs_post;
+  g_csmptlvs_get_batch = csmp_handle->csmptlvs_get_batch;
+  g_csmptlvs_get_rows = csmp_handle->csmptlvs_get_rows;
   g_csmplib_signature_verify = csmp_handle->signature_verify;
 
-  memset(&g_csmplib_stats, 0, sizeof(g_csmplib_stats));
+  csmpstats_reset();
+  csmpevent_init();
+  csmplatency_reset();
+
+  // Reports are still produced without the queue, they are just not kept offline
+  if(devconfig->report_queue_path &&
+     (reportqueue_open(devconfig->report_queue_path, devconfig->report_queue_size) < 0)) {
+    WPRINTF("csmp_service_start: report queue disabled\n");
+  }
+  if(devconfig->metrics_socket_path &&
+     (csmpexport_start(devconfig->metrics_socket_path) < 0)) {
+    WPRINTF("csmp_service_start: metrics exporter disabled\n");
+  }
+  // Without the slot, transfer requests are answered with CSMP_IMAGE_NO_SLOT
+  if(devconfig->image_slot_path &&
+     (imageslot_open(devconfig->image_slot_path, devconfig->image_slot_size) < 0)) {
+    WPRINTF("csmp_service_start: firmware image slot disabled\n");
+  }
 
   ret = csmpserver_enable();
-  if(!ret)
+  if(!ret) {
+    csmpexport_stop();
+    reportqueue_close();
+    imageslot_close();
     return -1;
+  }
 
-  ret = register_start(&devconfig->NMSaddr, false);
+  ret = register_start(&devconfig->NMSaddr, devconfig->NMSaddr_failover,
+                       devconfig->NMSaddr_failover_cnt, false);
   if(!ret) {
     csmpserver_disable();
+    csmpexport_stop();
+    reportqueue_close();
+    imageslot_close();
     return -1;
   }
 
@@ -82,8 +130,12 @@ bool csmp_devconfig_update(dev_config_t *devconfig) {
   memcpy(g_csmplib_eui64, devconfig->ieee_eui64.data, sizeof(g_csmplib_eui64));
   g_csmplib_reginterval_min = devconfig->reginterval_min;
   g_csmplib_reginterval_max = devconfig->reginterval_max;
+  g_csmplib_report_refresh = devconfig->report_refresh;
+  g_csmplib_report_queue_rate = devconfig->report_queue_rate;
+  g_csmplib_reg_storm_window = devconfig->reg_storm_window;
 
-  return register_start(&devconfig->NMSaddr, true);
+  return register_start(&devconfig->NMSaddr, devconfig->NMSaddr_failover,
+                        devconfig->NMSaddr_failover_cnt, true);
 }
 
 bool csmp_service_stop() {
@@ -93,13 +145,16 @@ bool csmp_service_stop() {
     return false;
 
   g_csmplib_status = SERVICE_NOT_START;
-  memset(&g_csmplib_stats, 0, sizeof(g_csmplib_stats));
 
   ret = csmpserver_disable();
   if(!ret)
     return false;
 
   ret = cgmsagent_stop();
+  csmpexport_stop();
+  reportqueue_close();
+  imageslot_close();
+  csmplog_flush();
   return ret;
 }
 
@@ -108,5 +163,74 @@ csmp_service_status_t csmp_service_status() {
 }
 
 csmp_service_stats_t* csmp_service_stats() {
-  return &g_csmplib_stats;
+  static __thread csmp_service_stats_t stats;
+
+  csmpstats_snapshot(&stats, CSMP_STATS_TOTAL);
+  return &stats;
+}
+
+int csmp_service_stats_snapshot(csmp_service_stats_t *out, csmp_stats_mode_t mode) {
+  if(out == NULL)
+    return -1;
+
+  csmpstats_snapshot(out, mode);
+  return 0;
+}
+
+void csmp_service_invalidate(tlv_type_t type) {
+  cgmsagent_invalidate(type);
+}
+
+int csmp_event_raise(eventid_t eventid, csmp_event_priority_t priority,
+                     const csmp_event_tlvlist_t *tlvlist, uint32_t tlvcnt) {
+  if(g_csmplib_status < REGISTRATION_IN_PROGRESS)
+    return -1;
+
+  return csmpevent_raise(eventid, priority, tlvlist, tlvcnt);
+}
+
+int csmp_event_stats_snapshot(csmp_event_stats_t *out) {
+  if(out == NULL)
+    return -1;
+
+  csmpevent_stats(out);
+  return 0;
+}
+
+int csmp_nms_endpoints(csmp_nms_endpoint_t *list, uint32_t cnt) {
+  if((list == NULL) || (g_csmplib_status < REGISTRATION_IN_PROGRESS))
+    return -1;
+
+  return cgmsagent_endpoints(list, cnt);
+}
+
+int csmp_latency_snapshot(csmp_latency_stats_t *list, uint32_t cnt) {
+  if((list == NULL) || (g_csmplib_status < REGISTRATION_IN_PROGRESS))
+    return -1;
+
+  return csmplatency_snapshot(list, cnt);
+}
+
+void csmp_log_config(csmp_log_level_t level, uint32_t subsys) {
+  csmplog_config(level, subsys);
+}
+
+void csmp_allocator_config(const csmp_allocator_t *allocator) {
+  ProtobufCAllocator heap;
+
+  if (allocator == NULL) {
+    csmptlv_allocator(NULL);
+    return;
+  }
+  heap.alloc = allocator->alloc;
+  heap.free = allocator->free;
+  heap.allocator_data = allocator->ctx;
+  csmptlv_allocator(&heap);
+}
+
+int csmp_metrics_render(char *buf, uint32_t size) {
+  if((buf == NULL) || (g_csmplib_status < REGISTRATION_IN_PROGRESS))
+    return -1;
+
+  return csmpexport_render(buf, size);
 }
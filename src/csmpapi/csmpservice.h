@@ -19,6 +19,7 @@
 
 #include <netinet/in.h>
 #include "csmp.h"
+#include "csmplog.h"
 
 /*! \file
  *
@@ -41,7 +42,10 @@ typedef enum {
   IPROUTE_RPLMETRICS_ID = 25, /**< ip route rpl info */
   WPANSTATUS_ID = 35,       /**< wan status info */
   NEIGHBOR802154_G_ID = 52, /**< neighbor info */
-  RPLINSTANCE_ID = 53    /**< rpl instance info */
+  RPLINSTANCE_ID = 53,   /**< rpl instance info */
+  LOAD_REQUEST_ID = 68,  /**< firmware load */
+  CANCEL_LOAD_REQUEST_ID = 69,  /**< firmware load cancel */
+  SET_BACKUP_REQUEST_ID = 70    /**< firmware backup */
 } tlv_type_t;
 
 /**
@@ -56,6 +60,19 @@ typedef struct dev_config {
   } ieee_eui64;          /**< the device’s eui64, should be the same with the EID that imported on NMS */
   uint32_t reginterval_min;  /**< the minimum interval to send register message to NMS */
   uint32_t reginterval_max;  /**< the maximum interval to send register message to NMS */
+  uint32_t report_refresh;  /**< report only changed TLVs, with a full report every report_refresh periods (0 disables) */
+  const char *report_queue_path;  /**< file keeping reports while the NMS is unreachable (NULL disables) */
+  uint32_t report_queue_size;  /**< size in bytes of the report queue */
+  uint32_t report_queue_rate;  /**< queued reports replayed per second once registered again (0 means 1) */
+  bool outage_recovery;  /**< the device is starting after a power outage */
+  uint32_t reg_storm_window;  /**< after an outage, spread the first registration over this many seconds (0 disables) */
+  const struct in6_addr *NMSaddr_failover;  /**< NMS addresses to fail over to, in order (NULL if none) */
+  uint32_t NMSaddr_failover_cnt;  /**< number of addresses in NMSaddr_failover */
+  uint32_t sock_rcvbuf;  /**< CoAP socket receive buffer in bytes (0 keeps the system default) */
+  uint32_t sock_sndbuf;  /**< CoAP socket send buffer in bytes (0 keeps the system default) */
+  const char *metrics_socket_path;  /**< Unix socket serving OpenMetrics text (NULL disables) */
+  const char *image_slot_path;  /**< file receiving firmware images from the NMS (NULL disables) */
+  uint32_t image_slot_size;  /**< largest firmware image in bytes */
 } dev_config_t;
 
 /**
@@ -66,6 +83,16 @@ typedef struct dev_config {
  */
 typedef void* (* csmptlvs_get_t)(tlvid_t tlvid, uint32_t *num);
 
+/**
+ * @brief table GET function definition
+ *
+ * @param tlvid the URL being called
+ * @param first the first row wanted
+ * @param max the most rows wanted
+ * @param num set to the rows returned
+ */
+typedef void* (* csmptlvs_get_rows_t)(tlvid_t tlvid, uint32_t first, uint32_t max, uint32_t *num);
+
 /**
  * @brief POST function definition
  *
@@ -74,6 +101,27 @@ typedef void* (* csmptlvs_get_t)(tlvid_t tlvid, uint32_t *num);
  */
 typedef void (* csmptlvs_post_t)(tlvid_t tlvid, void *tlv);
 
+/**
+ * csmp_tlv_slot_t
+ *
+ * one TLV of a batched GET
+ */
+typedef struct {
+  tlvid_t tlvid;
+  void *data;
+  uint32_t max;
+  uint32_t num;
+} csmp_tlv_slot_t;
+
+/**
+ * @brief batched GET function definition
+ *
+ * @param slots the TLVs to read
+ * @param cnt number of slots
+ * @return uint32_t generation of the data
+ */
+typedef uint32_t (* csmptlvs_get_batch_t)(csmp_tlv_slot_t *slots, uint32_t cnt);
+
 /**
  * @brief signature verification function definition
  *
@@ -93,8 +141,21 @@ typedef struct _csmp_handle {
   csmptlvs_get_t csmptlvs_get;
   csmptlvs_post_t csmptlvs_post;
   signature_verify_t signature_verify;
+  csmptlvs_get_batch_t csmptlvs_get_batch;
+  csmptlvs_get_rows_t csmptlvs_get_rows;
 } csmp_handle_t;
 
+/**
+ * csmp_allocator_t
+ *
+ * heap allocator of the library
+ */
+typedef struct {
+  void *(*alloc)(void *ctx, size_t size);
+  void (*free)(void *ctx, void *ptr);
+  void *ctx;
+} csmp_allocator_t;
+
 /**
  * csmp_service_status_t
  *
@@ -120,10 +181,32 @@ typedef struct {
     uint32_t error_signature;/**< signature check failure */
     uint32_t error_process;/**< overall error */
   } reg_fails_stats; /**< failure statistics */
+  uint32_t reg_holds; /**< registrations held to spread the load on the NMS */
+  uint32_t nms_failovers; /**< failovers to the next NMS endpoint */
+  uint32_t nms_redirects; /**< redirects to another NMS */
+  uint32_t reg_rtt; /**< smoothed registration round trip time (ms) */
+  uint32_t reg_rtt_max; /**< longest registration round trip time (ms) */
+  uint32_t reg_retransmits; /**< registrations resent while the previous one was unanswered */
   uint32_t metrics_reports;/**< metric reports */
+  uint32_t metrics_tlvs_suppressed;/**< unchanged TLVs left out of delta reports */
+  uint32_t metrics_reports_queued;/**< reports queued while the NMS was unreachable */
+  uint32_t metrics_reports_replayed;/**< queued reports sent to the NMS */
+  uint32_t metrics_reports_dropped;/**< queued reports dropped because the queue was full */
+  uint32_t metrics_report_latency;/**< smoothed time to encode and send a report (us) */
+  uint32_t metrics_report_latency_max;/**< longest time to encode and send a report (us) */
 
   uint32_t csmp_get_succeed;/**< CoAP GET successfull */
   uint32_t csmp_post_succeed;/**< CoAP POST successfull */
+  uint32_t csmp_outbuf_overflows;/**< POST responses that overflowed the response buffer */
+
+  uint32_t coap_rx_errors;/**< failed CoAP socket receives */
+  uint32_t coap_rx_truncated;/**< datagrams larger than the receive buffer, dropped */
+  uint32_t coap_rx_malformed;/**< datagrams that did not parse as CoAP */
+  uint32_t coap_rx_kernel_drops;/**< datagrams dropped by the kernel because the socket queue was full */
+  uint32_t coap_tx_errors;/**< failed CoAP sends */
+  uint32_t log_dropped;/**< debug log messages dropped because the log rings were full */
+  uint32_t tlv_heap_allocs;/**< decoded TLVs that did not fit the decode arena and used the heap */
+  uint32_t latency_dropped;/**< latency samples not recorded because every histogram was in use */
 
   uint32_t sig_ok; /**< signature status */
   uint32_t sig_no_signature; /**< no signature needed */
@@ -131,6 +214,17 @@ typedef struct {
   uint32_t sig_bad_validity; /**< signature failure on time check */
 } csmp_service_stats_t;
 
+/**
+ * @brief what the counters of a statistics snapshot count from
+ *
+ * Smoothed values and maxima are reported as they are in every mode.
+ */
+typedef enum {
+  CSMP_STATS_TOTAL = 0,  /**< since the service started or the last reset */
+  CSMP_STATS_DELTA = 1,  /**< since the previous delta or reset snapshot */
+  CSMP_STATS_RESET = 2   /**< since the last reset, then count from zero again */
+} csmp_stats_mode_t;
+
 /**
  * @brief start service
  *
@@ -159,23 +253,139 @@ csmp_service_status_t csmp_service_status();
 /**
  * @brief retrive service statistics
  *
+ * Deprecated, use csmp_service_stats_snapshot(). Kept for compatibility,
+ * returns a total snapshot in a copy private to the calling thread, valid
+ * until that thread calls it again.
+ *
  * @return csmp_service_stats_t* service statistics
  */
 csmp_service_stats_t* csmp_service_stats();
 
 /**
- * @brief stop service
+ * @brief take a consistent snapshot of the service statistics
  *
- * @return true
- * @return false
+ * Lock-free for the threads that update the counters, safe to call from
+ * any thread at any rate. Counters survive csmp_service_stop() and are
+ * cleared by csmp_service_start().
+ *
+ * @param out filled with the statistics
+ * @param mode total, delta since the previous delta snapshot, or total then reset
+ * @return int 0 on success, -1 if out is NULL
  */
-bool csmp_service_stop();
+int csmp_service_stats_snapshot(csmp_service_stats_t *out, csmp_stats_mode_t mode);
 
 /**
- * @brief externally defined stats
+ * @brief invalidate cached TLV data
+ *
+ * The registration message is encoded once and kept. The current time,
+ * IP routes, interface and RPL route metrics, WPAN status and RPL
+ * instance are requested again from the application on every attempt.
+ * The device id, hardware and interface descriptions, IP addresses and
+ * firmware image info are requested again when invalidated here, or
+ * once they are older than REG_CACHE_MAX_AGE (5 minutes by default).
+ *
+ * The application calls it whenever the data returned for one of those
+ * TLVs changes, so that the next registration carries it at once. GETs
+ * and reports always read the current data. Safe to call from any
+ * thread, callbacks included.
+ *
+ * @param type the changed TLV, 0 for all of them
+ */
+void csmp_service_invalidate(tlv_type_t type);
+
+/**
+ * @brief raise an event to be reported to the NMS
+ *
+ * @param eventid the event
+ * @param priority event priority
+ * @param tlvlist TLVs to report with the event, may be NULL
+ * @param tlvcnt number of TLVs in tlvlist (at most MAX_EVENT_TLV_CNT)
+ * @return int 0 on success, -1 on bad arguments or full queue
+ */
+int csmp_event_raise(eventid_t eventid, csmp_event_priority_t priority,
+                     const csmp_event_tlvlist_t *tlvlist, uint32_t tlvcnt);
+
+/**
+ * @brief copy the event statistics
+ *
+ * Each counter is read atomically, safe to call from any thread at any
+ * rate. Counters are cleared by csmp_service_start().
  *
+ * @param out filled with the statistics
+ * @return int 0 on success, -1 if out is NULL
  */
-extern csmp_service_stats_t g_csmplib_stats;
+int csmp_event_stats_snapshot(csmp_event_stats_t *out);
+
+/**
+ * @brief retrieve the health of the NMS endpoints
+ *
+ * The configured NMS is listed first, followed by its failover
+ * endpoints and the last NMS the agent was redirected to.
+ *
+ * @param list filled with up to cnt endpoints
+ * @param cnt size of list
+ * @return int number of endpoints written to list, -1 if the service is not started
+ */
+int csmp_nms_endpoints(csmp_nms_endpoint_t *list, uint32_t cnt);
+
+/**
+ * @brief retrieve latency summaries
+ *
+ * One summary per timed kind and key: request handling per CoAP method,
+ * TLV handlers and application callbacks per TLV type, signature checks
+ * and response sending.
+ *
+ * @param list filled with up to cnt summaries
+ * @param cnt size of list
+ * @return int number of summaries written to list, -1 if the service is not started
+ */
+int csmp_latency_snapshot(csmp_latency_stats_t *list, uint32_t cnt);
+
+/**
+ * @brief render the statistics as OpenMetrics text
+ *
+ * Service, event and CoAP drop counters and the latency summaries, taken
+ * from snapshots without allocating. Use it to serve metrics from an
+ * application event loop instead of the metrics_socket_path exporter.
+ *
+ * @param buf filled with the text, NUL terminated
+ * @param size size of buf
+ * @return int length of the text, -1 if the service is not started or the text does not fit
+ */
+int csmp_metrics_render(char *buf, uint32_t size);
+
+/**
+ * @brief set the log filters
+ *
+ * Messages above level or outside the subsystem mask are skipped at the
+ * call site. Debug messages are only built into libraries built with
+ * PRINTDEBUG, the others always are. Until this is called only errors
+ * are logged, or everything in PRINTDEBUG builds.
+ *
+ * @param level highest level logged
+ * @param subsys mask of csmp_log_subsys_t subsystems logged
+ */
+void csmp_log_config(csmp_log_level_t level, uint32_t subsys);
+
+/**
+ * @brief set the heap allocator
+ *
+ * The library decodes TLVs into a per-thread arena (TLV_ARENA_SIZE) and
+ * keeps everything else in static storage, so once started it only
+ * calls the allocator for TLVs too large for the arena. Set it before
+ * csmp_service_start().
+ *
+ * @param allocator the allocator, NULL for malloc and free
+ */
+void csmp_allocator_config(const csmp_allocator_t *allocator);
+
+/**
+ * @brief stop service
+ *
+ * @return true
+ * @return false
+ */
+bool csmp_service_stop();
 
 /**
  * @brief externally defined get function
@@ -189,6 +399,18 @@ extern csmptlvs_get_t g_csmptlvs_get;
  */
 extern csmptlvs_post_t g_csmptlvs_post;
 
+/**
+ * @brief externally defined batched get function
+ *
+ */
+extern csmptlvs_get_batch_t g_csmptlvs_get_batch;
+
+/**
+ * @brief externally defined table get function
+ *
+ */
+extern csmptlvs_get_rows_t g_csmptlvs_get_rows;
+
 /**
  * @brief externally signature verification function
  *
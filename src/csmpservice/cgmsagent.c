@@ -19,6 +19,7 @@
 #include <string.h>
 #include <errno.h>
 #include <time.h>
+#include <sys/time.h>
 #include <unistd.h>
 #include <sys/types.h>
 #include <stdint.h>
@@ -34,9 +35,12 @@
 #include "cgmsagent.h"
 #include "CsmpTlvs.pb-c.h"
 #include "trickle_timer.h"
+#include "reportqueue.h"
+#include "csmpevent.h"
+#include "csmpstats.h"
 
 #define OUTBUF_SIZE 1048
-static struct sockaddr_in6 NMS_addr;
+static struct sockaddr_in6 NMS_addr;  /* address of the active endpoint */
 static uint8_t g_outbuf[OUTBUF_SIZE];
 
 enum {
@@ -53,62 +57,595 @@ enum {
 extern uint8_t g_csmplib_status;
 extern uint32_t g_csmplib_reginterval_min;
 extern uint32_t g_csmplib_reginterval_max;
-extern csmp_subscription_list_t g_csmplib_report_list;
+extern uint32_t g_csmplib_report_refresh;
+extern uint32_t g_csmplib_report_queue_rate;
+extern uint32_t g_csmplib_reg_storm_window;
+extern uint32_t g_csmplib_reg_backoff;
+extern bool g_csmplib_outage_recovery;
+extern coap_socket_config_t g_csmplib_socket_config;
+extern csmp_subscription_list_t g_csmplib_report_list[MAX_SUBSCRIPTION_CNT];
 
 uint32_t g_csmplib_notificationCode = 0;
+static uint32_t m_reg_reason = REASON_COLDSTART;
 
-int doSendtlvs(tlvid_t *list, uint32_t list_cnt, coap_transaction_type_t txn_type,
-                           char name, int32_t tlvindex, bool prepend,
-                           uint8_t token_length, uint8_t *token) {
-  uint8_t *pbuf = g_outbuf;
-  coap_uri_seg_t url;
-  int rvi, used = 0;
+enum {
+  REG_PHASE_SALT = 1,    // trickle_timer_phase() salt of the registration hold
+  REPORT_PHASE_SALT = 2  // trickle_timer_phase() salt of the report schedule
+};
+
+enum {
+  REPORT_TLV_MAX = MAX_SUBSCRIPTION_CNT * MAX_SUBSCRIBE_LIST_CNT,
+  REPORT_MERGE_WINDOW = 1  // sec, subscriptions due this close are sent together
+};
+
+/* digest of the last reported encoding of a subscribed TLV (delta reporting) */
+typedef struct {
+  tlvid_t tlvid;
+  bool valid;
+  uint32_t val;
+} report_digest_t;
+
+/* schedule of one report subscription */
+typedef struct {
+  uint32_t due;      /* next report time (sec) */
+  uint32_t periods;  /* reports sent, drives the delta full refresh */
+} report_sched_t;
+
+/* an NMS the agent may register with */
+typedef struct {
+  struct sockaddr_in6 addr;
+  uint8_t origin;      /* nms_origin_t */
+  bool pending;        /* a registration request is unanswered */
+  uint32_t sent;       /* time the pending request was sent (ms) */
+  uint32_t srtt;       /* smoothed registration round trip time (ms) */
+  uint32_t fails;      /* consecutive failed or unanswered requests */
+  uint32_t failovers;  /* failovers away from this endpoint */
+} nms_endpoint_t;
+
+/* queued report sent confirmable to learn whether the NMS is reachable */
+typedef struct {
+  bool pending;
+  uint16_t seq;      /* token sequence */
+  uint32_t sent;     /* time sent (sec) */
+  uint32_t dropped;  /* reportqueue_dropped() when sent, the record was dropped if it moved */
+} report_probe_t;
+
+/* one TLV of the cached registration body */
+typedef struct {
+  uint32_t off;
+  uint32_t len;
+  uint32_t version;  /* m_reg_version[] the TLV was encoded at */
+  uint32_t stamp;    /* when the TLV was encoded (sec) */
+} reg_segment_t;
+
+static const tlvid_t m_reg_list[] = {{0,DEVICE_ID_TLVID},{0,CURRENT_TIME_TLVID},
+                    {0,HARDWARE_DESC_TLVID},{0,INTERFACE_DESC_TLVID},{0,IPADDRESS_TLVID},
+                    {0,IPROUTE_TLVID},{0,INTERFACE_METRICS_TLVID},{0,IPROUTE_RPLMETRICS_TLVID},
+                    {0,WPANSTATUS_TLVID}, {0,RPLINSTANCE_TLVID}, {0,FIRMWARE_IMAGE_INFO_TLVID}};
+#define REG_TLV_CNT (sizeof(m_reg_list)/sizeof(tlvid_t))
+
+static nms_endpoint_t m_nms[MAX_NMS_ENDPOINT_CNT];
+static uint32_t m_nms_cnt = 0;
+static uint32_t m_nms_cur = 0;
+static bool m_redirected = false;
+static uint32_t m_last_reg = 0;
+static uint32_t m_last_reg_reason = 0;
+
+static uint8_t m_reg_buf[OUTBUF_SIZE];
+static uint32_t m_reg_used = 0;
+static reg_segment_t m_reg_seg[REG_TLV_CNT];
+static uint32_t m_reg_version[REG_TLV_CNT];
+
+void report_timer_fired();
+void replay_timer_fired();
+void register_timer_fired();
+
+static report_digest_t m_report_digest[REPORT_TLV_MAX];
+static uint32_t m_report_digest_cnt = 0;
+static report_sched_t m_report_sched[MAX_SUBSCRIPTION_CNT];
+static bool m_nms_down = false;       /* the NMS failed to answer or could not be sent to */
+static report_probe_t m_report_probe; /* replay timer only */
+static uint32_t m_report_acked = 0;   /* REPORT_ACKED | seq of the last confirmed report */
+
+#define REPORT_ACKED 0x10000
+
+/* 32-bit FNV-1a over an encoded TLV */
+static uint32_t tlv_digest(const uint8_t *buf, size_t len) {
+  uint32_t hash = 2166136261U;
+
+  while (len--) {
+    hash ^= *buf++;
+    hash *= 16777619U;
+  }
+  return hash;
+}
+
+static uint32_t now_sec() {
+  struct timeval tv = {0};
+
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec;
+}
+
+static uint32_t now_ms() {
+  struct timeval tv = {0};
+
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec * 1000 + tv.tv_usec / 1000;
+}
+
+static uint32_t now_us() {
+  struct timeval tv = {0};
+
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+static void nms_init(nms_endpoint_t *nms, const struct sockaddr_in6 *addr, nms_origin_t origin) {
+  memset(nms, 0, sizeof(nms_endpoint_t));
+  memcpy(&nms->addr, addr, sizeof(struct sockaddr_in6));
+  nms->origin = origin;
+}
+
+static int nms_find(const struct sockaddr_in6 *addr) {
   uint32_t i;
-  tlvid_t list_pre[2] = {{0,SESSION_ID_TLVID},{0,CURRENT_TIME_TLVID}};
 
-  url.len = 1;
-  url.val = (uint8_t *)&name;
+  for (i = 0; i < m_nms_cnt; i++) {
+    if ((m_nms[i].addr.sin6_port == addr->sin6_port) &&
+        (memcmp(&m_nms[i].addr.sin6_addr, &addr->sin6_addr, sizeof(struct in6_addr)) == 0))
+      return i;
+  }
+  return -1;
+}
+
+static void nms_select(uint32_t index) {
+  m_nms_cur = index;
+  memcpy(&NMS_addr, &m_nms[index].addr, sizeof(struct sockaddr_in6));
+}
+
+/*
+ * Track the round trip time and failures of the endpoint that answered
+ * a registration. Responses to event and report CONs carry a token and
+ * never get here. srtt is an exponentially weighted moving average with
+ * a gain of 1/8, as TCP's srtt.
+ */
+static void nms_response(const struct sockaddr_in6 *from, uint16_t status) {
+  nms_endpoint_t *nms;
+  uint32_t rtt;
+  int i = nms_find(from);
+
+  if (i < 0)
+    return;
+  nms = &m_nms[i];
+
+  if (nms->pending) {
+    rtt = now_ms() - nms->sent;
+    nms->srtt = nms->srtt ? (7 * nms->srtt + rtt) / 8 : rtt;
+    CSMP_STAT_SMOOTH(reg_rtt, reg_rtt_max, rtt);
+    nms->pending = false;
+  }
+  // An overloaded NMS is still healthy, it is handled by the backoff
+  if (((status / 100) == 5) && (status != 503))
+    nms->fails++;
+  else
+    nms->fails = 0;
+}
+
+static report_digest_t *report_digest_find(tlvid_t tlvid) {
+  uint32_t i;
+
+  for (i = 0; i < m_report_digest_cnt; i++) {
+    if ((m_report_digest[i].tlvid.vendor == tlvid.vendor) &&
+        (m_report_digest[i].tlvid.type == tlvid.type))
+      return &m_report_digest[i];
+  }
+  if (m_report_digest_cnt == REPORT_TLV_MAX)
+    return NULL;
+
+  m_report_digest[m_report_digest_cnt].tlvid = tlvid;
+  m_report_digest[m_report_digest_cnt].valid = false;
+  return &m_report_digest[m_report_digest_cnt++];
+}
+
+/*
+ * Encode the TLVs in list into buf. With digests, TLVs whose encoding
+ * matches what was last reported are left out and the fresh digests are
+ * returned in fresh. Returns the bytes used, 0 if nothing changed.
+ */
+static int encode_tlvs(uint8_t *buf, size_t size, tlvid_t *list, uint32_t list_cnt,
+                       int32_t tlvindex, bool prepend,
+                       report_digest_t **digests, uint32_t *fresh) {
+  uint8_t *pbuf = buf;
+  int rvi = 0, used = 0, used_pre = 0;
+  uint32_t i;
+  tlvid_t list_pre[2] = {{0,SESSION_ID_TLVID},{0,CURRENT_TIME_TLVID}};
 
   if (prepend) {
     for(i = 0; i < 2; i++)  {
-      rvi = csmpagent_get(list_pre[i], pbuf, OUTBUF_SIZE-used, -1);
+      rvi = csmpagent_get(list_pre[i], pbuf, size-used, -1);
       if (rvi < 0) {
-        DPRINTF("CgmsAgent: Unable to write TLV %u.%u\n",list_pre[i].vendor,list_pre[i].type);
+        EPRINTF("CgmsAgent: Unable to write TLV %u.%u\n",list_pre[i].vendor,list_pre[i].type);
         return -1;
       }
       pbuf += rvi; used += rvi;
     }
+    used_pre = used;
   }
 
+  csmp_provider_begin(list, list_cnt);
   for (i = 0; i < list_cnt; i++) {
-    rvi = csmpagent_get(list[i], pbuf, OUTBUF_SIZE-used, tlvindex);
+    rvi = csmpagent_get(list[i], pbuf, size-used, tlvindex);
     if (rvi < 0) {
-      DPRINTF("CgmsAgent: Unable to write TLV %u.%u\n",list[i].vendor,list[i].type);
+      EPRINTF("CgmsAgent: Unable to write TLV %u.%u\n",list[i].vendor,list[i].type);
+      csmp_provider_end();
       return -1;
     }
+    if (digests && digests[i]) {
+      // Leave out TLVs whose encoding matches what was last reported
+      fresh[i] = tlv_digest(pbuf, rvi);
+      if (digests[i]->valid && (digests[i]->val == fresh[i])) {
+        CSMP_STAT_INC(metrics_tlvs_suppressed);
+        continue;
+      }
+    }
     pbuf += rvi; used += rvi;
   }
+  csmp_provider_end();
+
+  if (digests && (used == used_pre)) {
+    DPRINTF("CgmsAgent: No subscribed TLV changed, report suppressed\n");
+    return 0;
+  }
+  return used;
+}
+
+static void commit_digests(uint32_t list_cnt, report_digest_t **digests, uint32_t *fresh) {
+  uint32_t i;
 
-  if (used) {
-    rvi =  coapclient_request(&NMS_addr, txn_type, COAP_POST, token_length, token,
-                              &url,1,NULL,0,g_outbuf,used);
-    if (rvi<0) {
-      DPRINTF("CsmpAgent: CoapClient.request failed! list[1] = e%u.%u\n",list[1].vendor,list[1].type);
+  for (i = 0; i < list_cnt; i++) {
+    if (digests[i]) {
+      digests[i]->valid = true;
+      digests[i]->val = fresh[i];
     }
   }
+}
+
+int cgmsagent_post(coap_transaction_type_t txn_type, const uint8_t *body, uint16_t body_len) {
+  coap_uri_seg_t url;
+
+  url.len = 1;
+  url.val = (uint8_t *)"c";
+
+  return coapclient_request(&NMS_addr, txn_type, COAP_POST, 0, NULL,
+                            &url,1,NULL,0,body,body_len);
+}
+
+int cgmsagent_post_con(uint8_t kind, uint16_t seq, const uint8_t *body, uint16_t body_len) {
+  coap_uri_seg_t url;
+  uint8_t token[CGMS_TOKEN_LEN] = {kind, seq >> 8, seq & 0xFF};
+
+  url.len = 1;
+  url.val = (uint8_t *)"c";
+
+  return coapclient_request(&NMS_addr, COAP_CON, COAP_POST, CGMS_TOKEN_LEN, token,
+                            &url,1,NULL,0,body,body_len);
+}
+
+/* count the queued reports the queue overwrote to make room */
+static void account_dropped(uint32_t dropped_before) {
+  CSMP_STAT_ADD(metrics_reports_dropped, reportqueue_dropped() - dropped_before);
+}
+
+/*
+ * Reports are sent non-confirmable and never answered, so silence says
+ * nothing about the NMS. It only counts as unreachable after a real
+ * failure: an unanswered registration or queued report confirmation, or
+ * a failed send. Any response from it makes it reachable again.
+ */
+static void nms_reachable(bool reachable) {
+  __atomic_store_n(&m_nms_down, !reachable, __ATOMIC_RELAXED);
+}
+
+static bool nms_down() {
+  return __atomic_load_n(&m_nms_down, __ATOMIC_RELAXED);
+}
+
+/*
+ * Send a report to the NMS. While not registered, while the NMS is
+ * unreachable, or while earlier reports wait to be replayed, the report
+ * is encoded straight into a record of the offline queue instead. The
+ * replay then confirms the NMS is reachable before draining the queue.
+ * A report that cannot be sent is queued as well.
+ */
+static int send_report(tlvid_t *list, uint32_t list_cnt, report_digest_t **digests) {
+  int rvi = 0, used = 0;
+  uint32_t fresh[REPORT_TLV_MAX];
+  uint32_t dropped = reportqueue_dropped();
+  uint32_t start = now_us();
+  uint32_t now = now_sec();
+  uint8_t *rec = NULL;
+  bool queue;
+
+  if (digests && (list_cnt > REPORT_TLV_MAX))
+    return -1;
+
+  queue = reportqueue_isopen() &&
+          ((g_csmplib_status != REGISTRATION_SUCCESS) || nms_down() || reportqueue_count());
+  if (queue)
+    rec = reportqueue_reserve(OUTBUF_SIZE);
+
+  used = encode_tlvs(rec ? rec : g_outbuf, OUTBUF_SIZE, list, list_cnt, -1, true, digests, fresh);
+  if (used <= 0) {
+    if (rec)
+      reportqueue_cancel();
+    rvi = used;
+    goto done;
+  }
+
+  if (rec) {
+    rvi = reportqueue_commit(used, now);
+    goto queued;
+  }
+  if (!queue) {
+    rvi = cgmsagent_post(COAP_NON, g_outbuf, used);
+    if (rvi >= 0) {
+      CSMP_STAT_SMOOTH(metrics_report_latency, metrics_report_latency_max, now_us() - start);
+      goto sent;
+    }
+    EPRINTF("CgmsAgent: Report request failed\n");
+    nms_reachable(false);
+    if (!reportqueue_isopen())
+      goto done;
+  }
+  rvi = reportqueue_append(g_outbuf, used, now);
+
+queued:
+  if (rvi < 0)
+    goto done;
+  CSMP_STAT_INC(metrics_reports_queued);
+  if ((g_csmplib_status == REGISTRATION_SUCCESS) && !trickle_timer_next(rpy_timer))
+    trickle_timer_oneshot(rpy_timer, 0, (trickle_timer_fired_t)replay_timer_fired);
+
+sent:
+  if (digests)
+    commit_digests(list_cnt, digests, fresh);
+done:
+  account_dropped(dropped);
   return rvi;
 }
 
+/* the NMS answered a queued report sent confirmable, on the CoAP client thread */
+static void report_response(uint16_t seq, uint16_t status) {
+  (void) status; // Suppress unused param compiler warning.
+  DPRINTF("CgmsAgent: Queued report %u confirmed with status %u\n", seq, status);
+  __atomic_store_n(&m_report_acked, REPORT_ACKED | seq, __ATOMIC_RELAXED);
+  trickle_timer_oneshot(rpy_timer, 0, (trickle_timer_fired_t)replay_timer_fired);
+}
+
+/*
+ * While the NMS is unreachable the oldest queued report is sent
+ * confirmable, and resent every REPORT_ACK_TIMEOUT
+ * until the NMS answers. The answer is all the report needs, whatever
+ * its status, so it is removed and the queue drained.
+ */
+static bool replay_probe(uint32_t now) {
+  report_probe_t *probe = &m_report_probe;
+  const uint8_t *rec;
+  uint32_t len, timestamp;
+
+  if (probe->pending) {
+    if (__atomic_load_n(&m_report_acked, __ATOMIC_RELAXED) == (REPORT_ACKED | probe->seq)) {
+      probe->pending = false;
+      // Unless the queue dropped it to make room meanwhile
+      if (reportqueue_dropped() == probe->dropped) {
+        reportqueue_pop();
+        CSMP_STAT_INC(metrics_reports_replayed);
+      }
+      return true;
+    }
+    if ((now - probe->sent) < REPORT_ACK_TIMEOUT) {
+      trickle_timer_oneshot(rpy_timer, REPORT_ACK_TIMEOUT - (now - probe->sent),
+                            (trickle_timer_fired_t)replay_timer_fired);
+      return false;
+    }
+    probe->pending = false;
+    nms_reachable(false);
+  }
+  if (!nms_down())
+    return true;
+
+  rec = reportqueue_peek(&len, &timestamp);
+  if (!rec)
+    return false;
+  probe->seq++;
+  probe->sent = now;
+  probe->dropped = reportqueue_dropped();
+  probe->pending = true;
+  DPRINTF("CgmsAgent: Confirming queued report %u queued at %u\n", probe->seq, timestamp);
+  cgmsagent_post_con(CGMS_TOKEN_REPORT, probe->seq, rec, len);
+  trickle_timer_oneshot(rpy_timer, REPORT_ACK_TIMEOUT, (trickle_timer_fired_t)replay_timer_fired);
+  return false;
+}
+
+/* send up to report_queue_rate queued reports, then wait a second */
+void replay_timer_fired() {
+  const uint8_t *rec;
+  uint32_t len, timestamp, i;
+  uint32_t rate = g_csmplib_report_queue_rate ? g_csmplib_report_queue_rate : 1;
+
+  // Resumed by the next successful registration
+  if (g_csmplib_status != REGISTRATION_SUCCESS)
+    return;
+
+  if (!replay_probe(now_sec()))
+    return;
+
+  for (i = 0; i < rate; i++) {
+    rec = reportqueue_peek(&len, &timestamp);
+    if (!rec) {
+      DPRINTF("CgmsAgent: Report queue drained\n");
+      return;
+    }
+    if (cgmsagent_post(COAP_NON, rec, len) < 0) {
+      nms_reachable(false);
+      break;
+    }
+    DPRINTF("CgmsAgent: Replayed report queued at %u\n", timestamp);
+    reportqueue_pop();
+    CSMP_STAT_INC(metrics_reports_replayed);
+  }
+  trickle_timer_oneshot(rpy_timer, 1, (trickle_timer_fired_t)replay_timer_fired);
+}
+
+/*
+ * First report time of a subscription after now. Reports are aligned to
+ * the wall clock at a per-device phase within the period, so a fleet
+ * subscribed at the same interval reports at a uniform rate no matter
+ * when each device registered.
+ */
+static uint32_t report_next_due(uint32_t index, uint32_t now) {
+  csmp_subscription_list_t *sub = &g_csmplib_report_list[index];
+  uint32_t phase, due;
+
+  if (sub->period == 0)
+    return now;
+
+  if (sub->phase_set)
+    phase = sub->phase % sub->period;
+  else
+    phase = trickle_timer_phase(REPORT_PHASE_SALT, sub->period);
+
+  due = now - (now % sub->period) + phase;
+  if ((int32_t)(due - now) <= 0)
+    due += sub->period;
+  return due;
+}
+
+/* arm the report timer for the earliest active subscription */
+static void schedule_report() {
+  uint32_t now = now_sec();
+  uint32_t i;
+  int32_t delay, next = -1;
+
+  for (i = 0; i < MAX_SUBSCRIPTION_CNT; i++) {
+    if (g_csmplib_report_list[i].period == 0)
+      continue;
+    delay = (int32_t)(m_report_sched[i].due - now);
+    if (delay < 0)
+      delay = 0;
+    if ((next < 0) || (delay < next))
+      next = delay;
+  }
+
+  if (next < 0)
+    trickle_timer_stop(rpt_timer);
+  else
+    trickle_timer_oneshot(rpt_timer, next, (trickle_timer_fired_t)report_timer_fired);
+}
+
+/*
+ * Report every subscription that is due, merging the TLV lists of
+ * subscriptions that fall due together into a single message.
+ */
 void report_timer_fired() {
+  tlvid_t list[REPORT_TLV_MAX];
+  report_digest_t *digests[REPORT_TLV_MAX];
+  uint32_t cnt = 0;
+  uint32_t now = now_sec();
+  uint32_t i, j, k;
+  bool refresh;
+
+  for (i = 0; i < MAX_SUBSCRIPTION_CNT; i++) {
+    csmp_subscription_list_t *sub = &g_csmplib_report_list[i];
+    report_sched_t *sched = &m_report_sched[i];
+
+    if (sub->period == 0)
+      continue;
+    if ((int32_t)(sched->due - now) > REPORT_MERGE_WINDOW)
+      continue;
+
+    // Every report_refresh periods send the full subscription
+    refresh = (g_csmplib_report_refresh == 0) ||
+              ((sched->periods++ % g_csmplib_report_refresh) == 0);
 
-  g_csmplib_stats.metrics_reports++;
-  doSendtlvs(g_csmplib_report_list.list, g_csmplib_report_list.cnt,COAP_NON,'c',-1,true,0,NULL);
+    for (j = 0; j < sub->cnt; j++) {
+      for (k = 0; k < cnt; k++) {
+        if ((list[k].vendor == sub->list[j].vendor) && (list[k].type == sub->list[j].type))
+          break;
+      }
+      if (k == cnt) {
+        list[cnt] = sub->list[j];
+        digests[cnt] = report_digest_find(sub->list[j]);
+        cnt++;
+      }
+      if (refresh && digests[k])
+        digests[k]->valid = false;
+    }
+
+    sched->due += sub->period;
+    if ((int32_t)(sched->due - now) <= 0)
+      sched->due = report_next_due(i, now);
+  }
+
+  if (cnt) {
+    CSMP_STAT_INC(metrics_reports);
+    send_report(list,cnt,g_csmplib_report_refresh ? digests : NULL);
+  }
+  schedule_report();
 }
 
-void reset_rpttimer() {
-  trickle_timer_stop(rpt_timer);
-  trickle_timer_start(rpt_timer, g_csmplib_report_list.period, g_csmplib_report_list.period,
-                        (trickle_timer_fired_t)report_timer_fired);
+static bool report_listed(const csmp_subscription_list_t *sub, tlvid_t tlvid) {
+  uint32_t i;
+
+  for (i = 0; i < sub->cnt; i++) {
+    if ((sub->list[i].vendor == tlvid.vendor) && (sub->list[i].type == tlvid.type))
+      return true;
+  }
+  return false;
+}
+
+/*
+ * Drop the digests of TLVs no longer subscribed and invalidate those of
+ * the subscription, so its next report is a full one
+ */
+static void report_digest_reset(uint32_t index) {
+  uint32_t i, k, n = 0;
+  bool keep;
+
+  for (i = 0; i < m_report_digest_cnt; i++) {
+    for (k = 0, keep = false; (k < MAX_SUBSCRIPTION_CNT) && !keep; k++)
+      keep = report_listed(&g_csmplib_report_list[k], m_report_digest[i].tlvid);
+    if (!keep)
+      continue;
+    m_report_digest[n] = m_report_digest[i];
+    if (report_listed(&g_csmplib_report_list[index], m_report_digest[n].tlvid))
+      m_report_digest[n].valid = false;
+    n++;
+  }
+  m_report_digest_cnt = n;
+}
+
+/* restart the schedule of a subscription after its period or list changed */
+void reset_rpttimer(uint32_t index) {
+  if (index >= MAX_SUBSCRIPTION_CNT)
+    return;
+
+  m_report_sched[index].due = report_next_due(index, now_sec());
+  m_report_sched[index].periods = 0;
+  report_digest_reset(index);
+  schedule_report();
+}
+
+/* restart the schedules of all subscriptions at their phase */
+static void start_reports() {
+  uint32_t now = now_sec();
+  uint32_t i;
+
+  for (i = 0; i < MAX_SUBSCRIPTION_CNT; i++) {
+    m_report_sched[i].due = report_next_due(i, now);
+    m_report_sched[i].periods = 0;
+  }
+  schedule_report();
 }
 
 void process_reg(const uint8_t *buf,size_t len, bool preload_only) {
@@ -118,6 +655,8 @@ void process_reg(const uint8_t *buf,size_t len, bool preload_only) {
   uint32_t used = 0;
   int rv = 0;
 
+  m_redirected = false;
+
   while (used < len) {
     rv = csmptlv_readTL(pbuf,len - used,&tlvid,&tlvlen);
     if (rv == 0)
@@ -138,53 +677,238 @@ void process_reg(const uint8_t *buf,size_t len, bool preload_only) {
   }
 
   if (!preload_only) {
-   if(used == 0)
+   // Registration continues with the NMS the response redirected to
+   if((used == 0) || m_redirected)
       return;
    trickle_timer_stop(reg_timer);
    g_csmplib_status = REGISTRATION_SUCCESS;
+   m_last_reg = now_sec();
+   m_last_reg_reason = m_reg_reason;
 
-   if(g_csmplib_report_list.period != 0)
-     report_timer_fired();
-
-   trickle_timer_start(rpt_timer, g_csmplib_report_list.period, g_csmplib_report_list.period,
-                      (trickle_timer_fired_t)report_timer_fired);
+   start_reports();
+   if (reportqueue_count())
+     trickle_timer_oneshot(rpy_timer, 1, (trickle_timer_fired_t)replay_timer_fired);
+   csmpevent_dispatch();
   }
   return;
 }
 
+/* registration TLVs that change too often to be cached */
+static bool reg_volatile(tlvid_t tlvid) {
+  switch (tlvid.type) {
+    case CURRENT_TIME_TLVID:
+    case IPROUTE_TLVID:
+    case INTERFACE_METRICS_TLVID:
+    case IPROUTE_RPLMETRICS_TLVID:
+    case WPANSTATUS_TLVID:
+    case RPLINSTANCE_TLVID:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static bool reg_stale(uint32_t i, uint32_t version, uint32_t now) {
+  return (m_reg_seg[i].version != version) || reg_volatile(m_reg_list[i]) ||
+         ((now - m_reg_seg[i].stamp) >= REG_CACHE_MAX_AGE);
+}
+
+/*
+ * Bring the cached registration body up to date. The current time,
+ * metrics, routes and RPL state are read again from the application on
+ * every attempt, the other TLVs when they were invalidated or are older
+ * than REG_CACHE_MAX_AGE, and spliced into place.
+ */
+static int refresh_registration() {
+  reg_segment_t *seg;
+  tlvid_t stale[REG_TLV_CNT];
+  uint32_t i, j, version, end, stale_cnt = 0;
+  uint32_t now = now_sec();
+  int rvi, delta, encoded = 0;
+
+  for (i = 0; i < REG_TLV_CNT; i++) {
+    if (reg_stale(i, m_reg_version[i], now))
+      stale[stale_cnt++] = m_reg_list[i];
+  }
+  csmp_provider_begin(stale, stale_cnt);
+
+  for (i = 0; i < REG_TLV_CNT; i++) {
+    seg = &m_reg_seg[i];
+    version = m_reg_version[i];
+    if (!reg_stale(i, version, now))
+      continue;
+
+    rvi = csmpagent_get(m_reg_list[i], g_outbuf, OUTBUF_SIZE, -1);
+    if (rvi < 0) {
+      EPRINTF("CgmsAgent: Unable to write TLV %u.%u\n",m_reg_list[i].vendor,m_reg_list[i].type);
+      csmp_provider_end();
+      return -1;
+    }
+    delta = rvi - seg->len;
+    if (m_reg_used + delta > OUTBUF_SIZE) {
+      csmp_provider_end();
+      return -1;
+    }
+
+    if (delta) {
+      end = seg->off + seg->len;
+      memmove(m_reg_buf + end + delta, m_reg_buf + end, m_reg_used - end);
+      for (j = i + 1; j < REG_TLV_CNT; j++)
+        m_reg_seg[j].off += delta;
+      m_reg_used += delta;
+    }
+    memcpy(m_reg_buf + seg->off, g_outbuf, rvi);
+    seg->len = rvi;
+    seg->version = version;
+    seg->stamp = now;
+    encoded++;
+  }
+  csmp_provider_end();
+  DPRINTF("CgmsAgent: Registration refreshed %d of %u TLVs\n", encoded, (uint32_t)REG_TLV_CNT);
+  return m_reg_used;
+}
+
+void cgmsagent_invalidate(uint32_t type) {
+  uint32_t i;
+
+  for (i = 0; i < REG_TLV_CNT; i++) {
+    if ((type == 0) || (m_reg_list[i].type == type))
+      __sync_fetch_and_add(&m_reg_version[i], 1);
+  }
+}
+
+/* move on to the next endpoint and retry at the minimum interval */
+static void nms_failover() {
+  m_nms[m_nms_cur].failovers++;
+  CSMP_STAT_INC(nms_failovers);
+  nms_select((m_nms_cur + 1) % m_nms_cnt);
+  m_nms[m_nms_cur].fails = 0;
+  m_nms[m_nms_cur].pending = false;
+  m_reg_reason = REASON_NMS_ERROR;
+
+  WPRINTF("CgmsAgent: Failing over to NMS endpoint %u\n", m_nms_cur);
+  trickle_timer_start(reg_timer, g_csmplib_reginterval_min, g_csmplib_reginterval_max,
+                      (trickle_timer_fired_t)register_timer_fired);
+}
+
 void register_timer_fired() {
-  tlvid_t list[] = {{0,DEVICE_ID_TLVID},{0,CURRENT_TIME_TLVID},
-                    {0,HARDWARE_DESC_TLVID},{0,INTERFACE_DESC_TLVID},{0,IPADDRESS_TLVID},
-                    {0,IPROUTE_TLVID},{0,INTERFACE_METRICS_TLVID},{0,IPROUTE_RPLMETRICS_TLVID},
-                    {0,WPANSTATUS_TLVID}, {0,RPLINSTANCE_TLVID}, {0,FIRMWARE_IMAGE_INFO_TLVID}};
-  uint32_t list_cnt = sizeof(list)/sizeof(tlvid_t);
+  coap_uri_seg_t url;
+  nms_endpoint_t *nms = &m_nms[m_nms_cur];
+  int rvi;
+
+  url.len = 1;
+  url.val = (uint8_t *)"r";
+
+  if (nms->pending) {
+    nms->fails++;
+    nms_reachable(false);
+    CSMP_STAT_INC(reg_retransmits);
+  }
+  if ((nms->fails >= NMS_FAILOVER_ATTEMPTS) && (m_nms_cnt > 1))
+    nms_failover();
 
-  g_csmplib_stats.reg_attempts++;
-  doSendtlvs(list,list_cnt,COAP_CON,'r',-1,false,0,NULL);
+  CSMP_STAT_INC(reg_attempts);
+  if (refresh_registration() <= 0)
+    return;
+
+  nms = &m_nms[m_nms_cur];
+  nms->sent = now_ms();
+  nms->pending = true;
+  rvi = coapclient_request(&NMS_addr, COAP_CON, COAP_POST, 0, NULL,
+                           &url,1,NULL,0,m_reg_buf,m_reg_used);
+  if (rvi < 0) {
+    EPRINTF("CgmsAgent: Registration request failed\n");
+    nms_reachable(false);
+  }
 }
 
 
-void response_handler(struct sockaddr_in6 *from, uint16_t status, const void *body, uint16_t body_len)
+static void register_hold_fired() {
+  register_timer_fired();
+  trickle_timer_start(reg_timer, g_csmplib_reginterval_min, g_csmplib_reginterval_max,
+                      (trickle_timer_fired_t)register_timer_fired);
+}
+
+/*
+ * Hold the next registration until this device's phase within the
+ * window, a hint from the NMS takes precedence over the configured one.
+ * Devices recovering from the same outage then reach the NMS evenly
+ * spread instead of all at once.
+ */
+static void register_hold(uint32_t window) {
+  uint32_t delay;
+
+  if (g_csmplib_reg_backoff)
+    window = g_csmplib_reg_backoff;
+  delay = trickle_timer_phase(REG_PHASE_SALT, window);
+
+  CSMP_STAT_INC(reg_holds);
+  DPRINTF("CgmsAgent: Registration held for %u of %u sec\n", delay, window);
+  trickle_timer_oneshot(reg_timer, delay, (trickle_timer_fired_t)register_hold_fired);
+}
+
+void response_handler(struct sockaddr_in6 *from, uint16_t status,
+                      const uint8_t *token, uint8_t token_len,
+                      const void *body, uint16_t body_len)
 {
   int sigStat = 0;
+  int index;
+
+  DPRINTF("CgmsAgent: CoapClient.response with status=%d token_len=%d body_len=%d\n",
+          status,token_len,body_len);
 
-  (void) from;	// To avoid the unused-parameter warning.
-  DPRINTF("CgmsAgent: CoapClient.response with status=%d body_len=%d\n",status,body_len);
+  if (nms_find(from) >= 0)
+    nms_reachable(true);
+
+  // An empty acknowledgement or reset answers no request in particular
+  if (status == 0)
+    return;
+
+  // Only registration requests are sent without a token
+  if (token_len) {
+    if ((token_len == CGMS_TOKEN_LEN) && (token[0] == CGMS_TOKEN_EVENT))
+      csmpevent_response((token[1] << 8) | token[2], status);
+    else if ((token_len == CGMS_TOKEN_LEN) && (token[0] == CGMS_TOKEN_REPORT))
+      report_response((token[1] << 8) | token[2], status);
+    else {
+      DPRINTF("CgmsAgent: Response with unknown token ignored\n");
+    }
+    return;
+  }
+
+  nms_response(from, status);
+
+  // Late answers from an endpoint the agent moved away from are stale
+  index = nms_find(from);
+  if ((index >= 0) && ((uint32_t)index != m_nms_cur)) {
+    DPRINTF("CgmsAgent: Response from inactive NMS endpoint %d ignored\n", index);
+    return;
+  }
 
   if ((status/100) != 2) {
-    if (g_csmplib_status == REGISTRATION_SUCCESS) {
-      // Something went wrong at the NMS. Re-register
+    // An overloaded NMS may carry its backoff hint in CGMSSettings
+    if ((status == 503) && (body_len > 0) && (checkSignature(body,body_len) > 0))
+      process_reg(body,body_len,true);
 
-      trickle_timer_start(reg_timer, g_csmplib_reginterval_min, g_csmplib_reginterval_max,
-                         (trickle_timer_fired_t)register_timer_fired);
+    if (g_csmplib_status == REGISTRATION_SUCCESS) {
+      // Something went wrong at the NMS. Re-register with fresh data
+      cgmsagent_invalidate(0);
+      m_reg_reason = REASON_NMS_ERROR;
       g_csmplib_status = REGISTRATION_IN_PROGRESS;
+      if (status != 503)
+        trickle_timer_start(reg_timer, g_csmplib_reginterval_min, g_csmplib_reginterval_max,
+                           (trickle_timer_fired_t)register_timer_fired);
     }
     else {
-      g_csmplib_stats.reg_fails++;
-      g_csmplib_stats.reg_fails_stats.error_coap++;
+      CSMP_STAT_INC(reg_fails);
+      CSMP_STAT_INC(reg_fails_stats.error_coap);
     }
 
-    DPRINTF("CgmsAgent: Response status Check failed.\n");
+    // Service unavailable, back off instead of retrying on the trickle schedule
+    if (status == 503)
+      register_hold(g_csmplib_reg_storm_window ? g_csmplib_reg_storm_window : g_csmplib_reginterval_max);
+
+    WPRINTF("CgmsAgent: Response status Check failed.\n");
     return;
   }
 
@@ -192,11 +916,11 @@ void response_handler(struct sockaddr_in6 *from, uint16_t status, const void *bo
     sigStat = checkSignature(body,body_len);
     if(sigStat <= 0) {
       if(sigStat == 0)
-        g_csmplib_stats.sig_no_signature++;
+        CSMP_STAT_INC(sig_no_signature);
 
-      DPRINTF("CgmsAgent: Response Signature Check failed.\n");
-      g_csmplib_stats.reg_fails++;
-      g_csmplib_stats.reg_fails_stats.error_signature++;
+      WPRINTF("CgmsAgent: Response Signature Check failed.\n");
+      CSMP_STAT_INC(reg_fails);
+      CSMP_STAT_INC(reg_fails_stats.error_signature);
       return;
     }
   }
@@ -205,12 +929,12 @@ void response_handler(struct sockaddr_in6 *from, uint16_t status, const void *bo
   case REGISTRATION_IN_PROGRESS:
     process_reg(body,body_len,false);
     if (g_csmplib_status == REGISTRATION_SUCCESS)  {
-      g_csmplib_stats.reg_succeed++;
-      DPRINTF("CgmsAgent: Registration Complete!\n");
+      CSMP_STAT_INC(reg_succeed);
+      IPRINTF("CgmsAgent: Registration Complete!\n");
     }
     else {
-      g_csmplib_stats.reg_fails++;
-      g_csmplib_stats.reg_fails_stats.error_process++;
+      CSMP_STAT_INC(reg_fails);
+      CSMP_STAT_INC(reg_fails_stats.error_process);
     }
     break;
   }
@@ -222,6 +946,8 @@ bool cgmsagent_stop()
   int ret = 0;
   trickle_timer_stop(reg_timer);
   trickle_timer_stop(rpt_timer);
+  trickle_timer_stop(rpy_timer);
+  trickle_timer_stop(evt_timer);
   ret = coapclient_stop();
   if(ret < 0)
     return false;
@@ -229,25 +955,94 @@ bool cgmsagent_stop()
     return true;
 }
 
-bool register_start(struct in6_addr *NMSaddr, bool update)
+void cgmsagent_redirect(const struct sockaddr_in6 *addr, uint32_t holdtime)
 {
+  int index = nms_find(addr);
+
+  // A new endpoint takes a free slot, or replaces the last one
+  if (index < 0) {
+    index = (m_nms_cnt < MAX_NMS_ENDPOINT_CNT) ? m_nms_cnt++ : MAX_NMS_ENDPOINT_CNT - 1;
+    nms_init(&m_nms[index], addr, NMS_ORIGIN_REDIRECT);
+  }
+  m_nms[index].fails = 0;
+  m_nms[index].pending = false;
+  nms_select(index);
+
+  CSMP_STAT_INC(nms_redirects);
+  m_redirected = true;
+  m_reg_reason = REASON_NMS_REDIRECT;
+  cgmsagent_invalidate(0);
+  g_csmplib_status = REGISTRATION_IN_PROGRESS;
+  if (holdtime)
+    register_hold(holdtime);
+  else
+    trickle_timer_start(reg_timer, g_csmplib_reginterval_min, g_csmplib_reginterval_max,
+                        (trickle_timer_fired_t)register_timer_fired);
+}
+
+uint32_t cgmsagent_endpoints(csmp_nms_endpoint_t *list, uint32_t cnt)
+{
+  uint32_t i;
+
+  for (i = 0; (i < cnt) && (i < m_nms_cnt); i++) {
+    memcpy(&list[i].addr, &m_nms[i].addr.sin6_addr, sizeof(struct in6_addr));
+    list[i].port = ntohs(m_nms[i].addr.sin6_port);
+    list[i].active = (i == m_nms_cur);
+    list[i].srtt = m_nms[i].srtt;
+    list[i].fails = m_nms[i].fails;
+    list[i].failovers = m_nms[i].failovers;
+  }
+  return i;
+}
+
+void cgmsagent_status(cgmsagent_status_t *status)
+{
+  memcpy(&status->nms_addr, &NMS_addr.sin6_addr, sizeof(struct in6_addr));
+  status->nms_origin = m_nms[m_nms_cur].origin;
+  status->last_reg = m_last_reg;
+  status->last_reg_reason = m_last_reg_reason;
+  status->next_reg = (g_csmplib_status == REGISTRATION_SUCCESS) ? 0 : trickle_timer_next(reg_timer);
+}
+
+bool register_start(const struct in6_addr *NMSaddr, const struct in6_addr *failover,
+                    uint32_t failover_cnt, bool update)
+{
+  struct sockaddr_in6 addr;
+  uint32_t i;
   int ret = 0;
 
   if(!update) {
-    ret = coapclient_open(response_handler);
+    ret = coapclient_open(response_handler, &g_csmplib_socket_config);
     if (ret < 0) {
-      DPRINTF("coapclient_open failed.\n");
+      EPRINTF("coapclient_open failed.\n");
       return false;
     }
   }
 
-  memset(&NMS_addr, 0, sizeof(NMS_addr));
-  NMS_addr.sin6_family = AF_INET6;
-  NMS_addr.sin6_port = htons(CSMP_DEFAULT_PORT);
-  memcpy(NMS_addr.sin6_addr.s6_addr, NMSaddr, sizeof(struct in6_addr));
+  // The configured NMS comes first, followed by its failover endpoints
+  memset(&addr, 0, sizeof(addr));
+  addr.sin6_family = AF_INET6;
+  addr.sin6_port = htons(CSMP_DEFAULT_PORT);
+  m_nms_cnt = 0;
+  memcpy(&addr.sin6_addr, NMSaddr, sizeof(struct in6_addr));
+  nms_init(&m_nms[m_nms_cnt++], &addr, NMS_ORIGIN_CONFIG);
+  for (i = 0; failover && (i < failover_cnt) && (m_nms_cnt < MAX_NMS_ENDPOINT_CNT); i++) {
+    memcpy(&addr.sin6_addr, &failover[i], sizeof(struct in6_addr));
+    nms_init(&m_nms[m_nms_cnt++], &addr, NMS_ORIGIN_FAILOVER);
+  }
+  nms_select(0);
+
+  if (update)
+    m_reg_reason = REASON_NMS_CHANGE;
+  else
+    m_reg_reason = g_csmplib_outage_recovery ? REASON_OUTAGE_RECOVERY : REASON_COLDSTART;
 
+  cgmsagent_invalidate(0);
   g_csmplib_status = REGISTRATION_IN_PROGRESS;
-  trickle_timer_start(reg_timer, g_csmplib_reginterval_min, g_csmplib_reginterval_max,
-      (trickle_timer_fired_t)register_timer_fired);
+  if ((m_reg_reason == REASON_OUTAGE_RECOVERY) && g_csmplib_reg_storm_window)
+    register_hold(g_csmplib_reg_storm_window);
+  else
+    trickle_timer_start(reg_timer, g_csmplib_reginterval_min, g_csmplib_reginterval_max,
+        (trickle_timer_fired_t)register_timer_fired);
   return true;
 }
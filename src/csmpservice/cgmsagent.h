@@ -24,22 +24,117 @@
  */
 
 #include <netinet/in.h>
+#include "coap.h"
+#include "csmp.h"
+
+/** where the active NMS address came from */
+typedef enum {
+  NMS_ORIGIN_CONFIG = 1,    /**< dev_config_t.NMSaddr */
+  NMS_ORIGIN_FAILOVER = 2,  /**< dev_config_t.NMSaddr_failover */
+  NMS_ORIGIN_REDIRECT = 3   /**< NMSRedirectRequest */
+} nms_origin_t;
+
+/** registration state reported in CGMSStatus */
+typedef struct {
+  struct in6_addr nms_addr;  /**< active NMS address */
+  nms_origin_t nms_origin;   /**< where nms_addr came from */
+  uint32_t last_reg;         /**< time of the last successful registration (sec), 0 if none */
+  uint32_t last_reg_reason;  /**< reason of the last successful registration */
+  uint32_t next_reg;         /**< time of the next registration attempt (sec), 0 if none */
+} cgmsagent_status_t;
 
 /**
  * @brief
  *
  * @param NMSaddr address of the NMS
+ * @param failover NMS addresses to fail over to, in order, may be NULL
+ * @param failover_cnt number of addresses in failover
  * @param update update the address
  * @return true
  * @return false
  */
-bool register_start(struct in6_addr *NMSaddr, bool update);
+bool register_start(const struct in6_addr *NMSaddr, const struct in6_addr *failover,
+                    uint32_t failover_cnt, bool update);
 
 /**
- * @brief reset timer
+ * @brief register with another NMS
+ *
+ * The endpoint is added to the endpoint list if it is not there yet
+ * and becomes the active one.
+ *
+ * @param addr address of the NMS
+ * @param holdtime spread the registration over this many seconds, 0 registers at once
+ */
+void cgmsagent_redirect(const struct sockaddr_in6 *addr, uint32_t holdtime);
+
+/**
+ * @brief retrieve the health of the NMS endpoints
+ *
+ * @param list filled with up to cnt endpoints
+ * @param cnt size of list
+ * @return uint32_t endpoints written to list
+ */
+uint32_t cgmsagent_endpoints(csmp_nms_endpoint_t *list, uint32_t cnt);
+
+/**
+ * @brief retrieve the registration state
+ *
+ * @param status filled with the current state
+ */
+void cgmsagent_status(cgmsagent_status_t *status);
+
+/**
+ * @brief restart the report schedule of a subscription
+ *
+ * The subscription's TLV digests are reset, its next report is a full one.
+ *
+ * @param index the subscription slot whose period or TLV list changed
+ */
+void reset_rpttimer(uint32_t index);
+
+/**
+ * @brief mark a registration TLV as changed
+ *
+ * The registration body is cached and only invalidated TLVs are read
+ * again from the application before the next registration attempt.
+ *
+ * @param type TLV type, 0 invalidates every TLV
+ */
+void cgmsagent_invalidate(uint32_t type);
+
+/** token kind of confirmable event messages */
+#define CGMS_TOKEN_EVENT 'e'
+
+/** token kind of confirmable queued reports */
+#define CGMS_TOKEN_REPORT 'r'
+
+/** token length of confirmable messages other than registrations: kind, then a 16-bit sequence */
+#define CGMS_TOKEN_LEN 3
+
+/**
+ * @brief POST a CSMP message to the NMS
+ *
+ * @param txn_type confirmable or not
+ * @param body encoded TLVs
+ * @param body_len length of body
+ * @return int negative on failure
+ */
+int cgmsagent_post(coap_transaction_type_t txn_type, const uint8_t *body, uint16_t body_len);
+
+/**
+ * @brief POST a confirmable CSMP message to the NMS
+ *
+ * Registration requests carry no token, other confirmable messages
+ * carry one so their responses are told apart and handed to the
+ * path of their kind instead of the registration.
  *
+ * @param kind token kind, CGMS_TOKEN_EVENT or CGMS_TOKEN_REPORT
+ * @param seq sequence matched against the response
+ * @param body encoded TLVs
+ * @param body_len length of body
+ * @return int negative on failure
  */
-void reset_rpttimer();
+int cgmsagent_post_con(uint8_t kind, uint16_t seq, const uint8_t *body, uint16_t body_len);
 
 /**
  * @brief stop the agent
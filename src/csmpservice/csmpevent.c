@@ -0,0 +1,397 @@
+/*
+ *  Copyright 2021 Cisco Systems, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <sys/time.h>
+
+#include "coap.h"
+#include "csmp.h"
+#include "csmptlv.h"
+#include "csmpagent.h"
+#include "cgmsagent.h"
+#include "csmpevent.h"
+#include "CsmpTlvs.pb-c.h"
+#include "trickle_timer.h"
+
+#define EVENT_BUF_SIZE 1048
+#define EVENT_PRIORITY_CNT 3
+#define EVENT_CON_TRACK 8  /* confirmable messages awaiting their response */
+#define EVENT_CON_PENDING ((uint64_t)1 << 63)
+
+extern uint8_t g_csmplib_status;
+
+/* one queued event, seq hands the slot between producers and the consumer */
+typedef struct {
+  uint32_t seq;
+  eventid_t eventid;
+  uint32_t timestamp;
+  uint32_t count;
+  uint32_t tlvcnt;
+  csmp_event_tlvlist_t tlvlist[MAX_EVENT_TLV_CNT];
+} event_slot_t;
+
+/* bounded multi-producer, single-consumer ring */
+typedef struct {
+  uint32_t tail;       /* next slot to fill, shared by producers */
+  uint32_t head;       /* next slot to drain, timer thread only */
+  uint32_t next_send;  /* earliest time of the next batch (sec), written by the timer thread */
+  event_slot_t slot[EVENT_QUEUE_LEN];
+} event_queue_t;
+
+static event_queue_t m_event_queue[EVENT_PRIORITY_CNT];
+static csmp_event_stats_t m_event_stats;
+_Static_assert(sizeof(csmp_event_stats_t) % sizeof(uint32_t) == 0,
+               "csmp_event_stats_t has fields other than uint32_t counters");
+static uint8_t m_event_buf[EVENT_BUF_SIZE];
+
+/*
+ * Confirmable messages awaiting their response, by token sequence:
+ * EVENT_CON_PENDING | sequence << 32 | events in the message, cleared
+ * by the response. Filled by the timer thread, answered on the CoAP
+ * client thread.
+ */
+static uint64_t m_event_con[EVENT_CON_TRACK];
+static uint16_t m_event_con_seq;
+
+static const uint32_t m_event_interval[EVENT_PRIORITY_CNT] = {
+  EVENT_LOW_INTERVAL, EVENT_MEDIUM_INTERVAL, 0
+};
+
+void event_timer_fired();
+
+static uint32_t now_sec() {
+  struct timeval tv = {0};
+
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec;
+}
+
+static void stat_inc(uint32_t *counter, uint32_t n) {
+  __atomic_add_fetch(counter, n, __ATOMIC_RELAXED);
+}
+
+void csmpevent_init() {
+  uint32_t p, i;
+
+  memset(m_event_queue, 0, sizeof(m_event_queue));
+  for (p = 0; p < EVENT_PRIORITY_CNT; p++) {
+    for (i = 0; i < EVENT_QUEUE_LEN; i++)
+      m_event_queue[p].slot[i].seq = i;
+  }
+  memset(&m_event_stats, 0, sizeof(m_event_stats));
+  memset(m_event_con, 0, sizeof(m_event_con));
+}
+
+static bool event_push(event_queue_t *q, eventid_t eventid,
+                       const csmp_event_tlvlist_t *tlvlist, uint32_t tlvcnt) {
+  uint32_t pos = __atomic_load_n(&q->tail, __ATOMIC_RELAXED);
+  event_slot_t *slot;
+  int32_t dif;
+
+  while (1) {
+    slot = &q->slot[pos & (EVENT_QUEUE_LEN - 1)];
+    dif = (int32_t)(__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) - pos);
+    if (dif == 0) {
+      if (__atomic_compare_exchange_n(&q->tail, &pos, pos + 1, true,
+                                      __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        break;
+    }
+    else if (dif < 0)
+      return false;
+    else
+      pos = __atomic_load_n(&q->tail, __ATOMIC_RELAXED);
+  }
+
+  slot->eventid = eventid;
+  slot->timestamp = now_sec();
+  slot->count = 1;
+  slot->tlvcnt = tlvcnt;
+  if (tlvcnt)
+    memcpy(slot->tlvlist, tlvlist, tlvcnt * sizeof(csmp_event_tlvlist_t));
+  __atomic_store_n(&slot->seq, pos + 1, __ATOMIC_RELEASE);
+  return true;
+}
+
+static event_slot_t *event_peek(event_queue_t *q) {
+  event_slot_t *slot = &q->slot[q->head & (EVENT_QUEUE_LEN - 1)];
+
+  if (__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) != q->head + 1)
+    return NULL;
+  return slot;
+}
+
+static void event_release(event_queue_t *q, event_slot_t *slot) {
+  __atomic_store_n(&slot->seq, q->head + EVENT_QUEUE_LEN, __ATOMIC_RELEASE);
+  q->head++;
+}
+
+/* seconds until the queue of priority p may send, -1 if it is empty */
+static int32_t event_delay(uint32_t p, uint32_t now) {
+  event_queue_t *q = &m_event_queue[p];
+  int32_t delay;
+
+  if (!event_peek(q))
+    return -1;
+  delay = (int32_t)(q->next_send - now);
+  return (delay < 0) ? 0 : delay;
+}
+
+/* timer thread only */
+static void event_schedule(uint32_t now) {
+  int32_t delay, next = -1;
+  uint32_t p;
+
+  for (p = 0; p < EVENT_PRIORITY_CNT; p++) {
+    delay = event_delay(p, now);
+    if ((delay >= 0) && ((next < 0) || (delay < next)))
+      next = delay;
+  }
+  if (next >= 0)
+    trickle_timer_oneshot(evt_timer, next, (trickle_timer_fired_t)event_timer_fired);
+}
+
+static int event_encode(uint8_t *buf, size_t len, const event_slot_t *ev,
+                        csmp_event_priority_t priority) {
+  EventReport msg = EVENT_REPORT__INIT;
+  tlvid_t tlvid = {0, EVENT_REPORT_TLVID};
+  tlvid_t ids[MAX_EVENT_TLV_CNT];
+  size_t used;
+  uint32_t i;
+  int rv;
+
+  msg.event_code_present_case = EVENT_REPORT__EVENT_CODE_PRESENT_EVENT_CODE;
+  msg.eventcode = ev->eventid.code;
+  if (ev->eventid.vendor) {
+    msg.vendor_id_present_case = EVENT_REPORT__VENDOR_ID_PRESENT_VENDOR_ID;
+    msg.vendorid = ev->eventid.vendor;
+  }
+  msg.priority_present_case = EVENT_REPORT__PRIORITY_PRESENT_PRIORITY;
+  msg.priority = priority;
+  msg.timestamp_present_case = EVENT_REPORT__TIMESTAMP_PRESENT_TIMESTAMP;
+  msg.timestamp = ev->timestamp;
+  if (ev->count > 1) {
+    msg.count_present_case = EVENT_REPORT__COUNT_PRESENT_COUNT;
+    msg.count = ev->count;
+  }
+
+  used = csmptlv_write(buf, len, tlvid, (ProtobufCMessage *)&msg);
+  if (used == 0)
+    return -1;
+
+  for (i = 0; i < ev->tlvcnt; i++)
+    ids[i] = ev->tlvlist[i].id;
+  csmp_provider_begin(ids, ev->tlvcnt);
+  for (i = 0; i < ev->tlvcnt; i++) {
+    rv = csmpagent_get(ev->tlvlist[i].id, buf + used, len - used, ev->tlvlist[i].index);
+    if (rv < 0) {
+      EPRINTF("csmpevent: Unable to write TLV %u.%u for event %u\n",
+              ev->tlvlist[i].id.vendor, ev->tlvlist[i].id.type, ev->eventid.code);
+      csmp_provider_end();
+      return -1;
+    }
+    used += rv;
+  }
+  csmp_provider_end();
+  return used;
+}
+
+/* same event reporting the same TLVs */
+static bool event_same(const event_slot_t *a, const event_slot_t *b) {
+  uint32_t i;
+
+  if ((a->eventid.vendor != b->eventid.vendor) || (a->eventid.code != b->eventid.code) ||
+      (a->tlvcnt != b->tlvcnt))
+    return false;
+  for (i = 0; i < a->tlvcnt; i++) {
+    if ((a->tlvlist[i].id.vendor != b->tlvlist[i].id.vendor) ||
+        (a->tlvlist[i].id.type != b->tlvlist[i].id.type) ||
+        (a->tlvlist[i].index != b->tlvlist[i].index))
+      return false;
+  }
+  return true;
+}
+
+/* drain up to EVENT_BATCH_MAX distinct events of one priority into a message */
+static void event_send_batch(uint32_t p) {
+  event_queue_t *q = &m_event_queue[p];
+  csmp_event_priority_t priority = p + 1;
+  event_slot_t batch[EVENT_BATCH_MAX];
+  event_slot_t *slot;
+  tlvid_t list_pre[2] = {{0,SESSION_ID_TLVID},{0,CURRENT_TIME_TLVID}};
+  uint32_t cnt = 0, sent = 0, i;
+  uint64_t *con = NULL;
+  uint16_t seq;
+  int rv, used = 0;
+
+  while ((slot = event_peek(q)) != NULL) {
+    for (i = 0; i < cnt; i++) {
+      if (event_same(&batch[i], slot))
+        break;
+    }
+    if (i < cnt) {
+      batch[i].count++;
+      stat_inc(&m_event_stats.coalesced, 1);
+    }
+    else if (cnt < EVENT_BATCH_MAX)
+      batch[cnt++] = *slot;
+    else
+      break;
+    event_release(q, slot);
+  }
+  if (cnt == 0)
+    return;
+
+  for (i = 0; i < 2; i++) {
+    rv = csmpagent_get(list_pre[i], m_event_buf + used, EVENT_BUF_SIZE - used, -1);
+    if (rv < 0)
+      goto dropped;
+    used += rv;
+  }
+  for (i = 0; i < cnt; i++) {
+    rv = event_encode(m_event_buf + used, EVENT_BUF_SIZE - used, &batch[i], priority);
+    if (rv < 0)
+      break;
+    used += rv;
+    sent += batch[i].count;
+  }
+  if (i == 0)
+    goto dropped;
+
+  if (priority == CSMP_EVENT_PRIORITY_HIGH) {
+    // Tracked before it is sent, the response may come back first
+    seq = ++m_event_con_seq;
+    con = &m_event_con[seq % EVENT_CON_TRACK];
+    __atomic_store_n(con, EVENT_CON_PENDING | ((uint64_t)seq << 32) | sent, __ATOMIC_RELEASE);
+    rv = cgmsagent_post_con(CGMS_TOKEN_EVENT, seq, m_event_buf, used);
+  }
+  else
+    rv = cgmsagent_post(COAP_NON, m_event_buf, used);
+  if (rv < 0) {
+    if (con)
+      __atomic_store_n(con, 0, __ATOMIC_RELAXED);
+    goto dropped;
+  }
+  DPRINTF("csmpevent: Sent %u events of priority %u\n", sent, priority);
+  stat_inc(&m_event_stats.sent, sent);
+  for (; i < cnt; i++)
+    stat_inc(&m_event_stats.dropped, batch[i].count);
+  return;
+
+dropped:
+  WPRINTF("csmpevent: Event message of priority %u dropped\n", priority);
+  for (i = 0; i < cnt; i++)
+    stat_inc(&m_event_stats.dropped, batch[i].count);
+}
+
+void event_timer_fired() {
+  uint32_t now = now_sec();
+  int32_t p;
+
+  // Held until registration succeeds
+  if (g_csmplib_status != REGISTRATION_SUCCESS)
+    return;
+
+  for (p = EVENT_PRIORITY_CNT - 1; p >= 0; p--) {
+    if (event_delay(p, now) != 0)
+      continue;
+    event_send_batch(p);
+    __atomic_store_n(&m_event_queue[p].next_send, now + m_event_interval[p], __ATOMIC_RELAXED);
+  }
+  event_schedule(now);
+}
+
+/* have the timer thread send and schedule the queued events now */
+static void event_kick() {
+  trickle_timer_oneshot(evt_timer, 0, (trickle_timer_fired_t)event_timer_fired);
+}
+
+void csmpevent_dispatch() {
+  event_kick();
+}
+
+int csmpevent_raise(eventid_t eventid, csmp_event_priority_t priority,
+                    const csmp_event_tlvlist_t *tlvlist, uint32_t tlvcnt) {
+  uint32_t now, due, next;
+
+  if ((priority < CSMP_EVENT_PRIORITY_LOW) || (priority > CSMP_EVENT_PRIORITY_HIGH)) {
+    stat_inc(&m_event_stats.bad_priority, 1);
+    return -1;
+  }
+  if ((tlvcnt > MAX_EVENT_TLV_CNT) || (tlvcnt && !tlvlist))
+    return -1;
+
+  switch (priority) {
+    case CSMP_EVENT_PRIORITY_LOW:
+      stat_inc(&m_event_stats.trigger_low, 1);
+      break;
+    case CSMP_EVENT_PRIORITY_MEDIUM:
+      stat_inc(&m_event_stats.trigger_med, 1);
+      break;
+    default:
+      stat_inc(&m_event_stats.trigger_high, 1);
+      break;
+  }
+
+  if (!event_push(&m_event_queue[priority - 1], eventid, tlvlist, tlvcnt)) {
+    stat_inc(&m_event_stats.dropped, 1);
+    return -1;
+  }
+
+  // Unless the timer is due to fire by the time the event may go. While
+  // a oneshot timer fires it is not running, so a firing that may have
+  // missed the event is always followed by another.
+  if (g_csmplib_status == REGISTRATION_SUCCESS) {
+    now = now_sec();
+    due = __atomic_load_n(&m_event_queue[priority - 1].next_send, __ATOMIC_RELAXED);
+    if ((int32_t)(due - now) < 0)
+      due = now;
+    next = trickle_timer_next(evt_timer);
+    if ((next == 0) || ((int32_t)(next - due) > 0))
+      event_kick();
+  }
+  return 0;
+}
+
+void csmpevent_response(uint16_t seq, uint16_t status) {
+  uint64_t *con = &m_event_con[seq % EVENT_CON_TRACK];
+  uint64_t pending = __atomic_load_n(con, __ATOMIC_ACQUIRE);
+
+  // Answered already, or overwritten by later messages
+  if (!(pending & EVENT_CON_PENDING) || ((uint16_t)(pending >> 32) != seq) ||
+      !__atomic_compare_exchange_n(con, &pending, 0, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)) {
+    DPRINTF("csmpevent: Response to unknown event message %u ignored\n", seq);
+    return;
+  }
+
+  if ((status / 100) == 2)
+    stat_inc(&m_event_stats.acked, (uint32_t)pending);
+  else {
+    WPRINTF("csmpevent: Event message %u rejected with status %u\n", seq, status);
+    stat_inc(&m_event_stats.rejected, (uint32_t)pending);
+  }
+}
+
+void csmpevent_stats(csmp_event_stats_t *out) {
+  const uint32_t *src = (const uint32_t *)&m_event_stats;
+  uint32_t *dst = (uint32_t *)out;
+  uint32_t i;
+
+  for (i = 0; i < sizeof(*out) / sizeof(uint32_t); i++)
+    dst[i] = __atomic_load_n(&src[i], __ATOMIC_RELAXED);
+}
@@ -0,0 +1,78 @@
+/*
+ *  Copyright 2021 Cisco Systems, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef _CSMPEVENT_H
+#define _CSMPEVENT_H
+
+/*! \file
+ *
+ * Event reporting
+ *
+ * Events are queued per priority in bounded rings that any thread may
+ * fill and only the timer thread drains and schedules. Raising an event
+ * wakes the timer thread when the event may go before its next firing.
+ * High priority events are sent at once as confirmable messages; low
+ * and medium priority events are coalesced into batches sent at most
+ * once per priority interval.
+ */
+
+#include <stdint.h>
+#include "csmp.h"
+
+/**
+ * @brief reset the event queues and statistics
+ */
+void csmpevent_init();
+
+/**
+ * @brief queue an event for the NMS
+ *
+ * @param eventid the event
+ * @param priority event priority
+ * @param tlvlist TLVs reported with the event, may be NULL
+ * @param tlvcnt number of TLVs in tlvlist, at most MAX_EVENT_TLV_CNT
+ * @return int 0 on success, -1 on bad priority or full queue
+ */
+int csmpevent_raise(eventid_t eventid, csmp_event_priority_t priority,
+                    const csmp_event_tlvlist_t *tlvlist, uint32_t tlvcnt);
+
+/**
+ * @brief send whatever events are allowed to go now
+ *
+ * Called once registration succeeds to flush events raised while
+ * the agent was not registered. The events are sent from the timer
+ * thread.
+ */
+void csmpevent_dispatch();
+
+/**
+ * @brief handle the response to a confirmable event message
+ *
+ * @param seq token sequence of the message
+ * @param status CoAP status of the response
+ */
+void csmpevent_response(uint16_t seq, uint16_t status);
+
+/**
+ * @brief copy the event statistics
+ *
+ * Each counter is read atomically, safe to call from any thread.
+ *
+ * @param out filled with the statistics
+ */
+void csmpevent_stats(csmp_event_stats_t *out);
+
+#endif
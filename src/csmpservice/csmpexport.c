@@ -0,0 +1,357 @@
+/*
+ *  Copyright 2021 Cisco Systems, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "csmp.h"
+#include "csmpservice.h"
+#include "csmpstats.h"
+#include "csmpevent.h"
+#include "csmplatency.h"
+#include "csmpexport.h"
+
+enum {
+  EXPORT_BUF_SIZE = 32768,
+  EXPORT_REQ_SIZE = 512,
+  EXPORT_REQ_WAIT = 100  // ms to wait for an HTTP request line
+};
+
+typedef enum {
+  EXPORT_COUNTER,
+  EXPORT_GAUGE
+} export_type_t;
+
+/* one metric taken from a field of a statistics struct */
+typedef struct {
+  const char *name;
+  const char *help;
+  size_t offset;
+  export_type_t type;
+} export_metric_t;
+
+/* output position while rendering */
+typedef struct {
+  char *buf;
+  uint32_t size;
+  uint32_t used;
+  bool overflow;
+} export_out_t;
+
+/* offset of a field read as uint32_t, the build fails for any other size */
+#define U32_OFFSET(type, field) \
+  (offsetof(type, field) + 0 * sizeof(struct { \
+    _Static_assert(sizeof(((type *)0)->field) == sizeof(uint32_t), \
+                   #type "." #field " is not a uint32_t"); \
+    int unused; }))
+
+#define SERVICE_METRIC(field, name, help, type) \
+  { name, help, U32_OFFSET(csmp_service_stats_t, field), type }
+#define EVENT_METRIC(field, name, help) \
+  { name, help, U32_OFFSET(csmp_event_stats_t, field), EXPORT_COUNTER }
+
+static const export_metric_t m_service_metric[] = {
+  SERVICE_METRIC(reg_succeed, "csmp_reg_succeed", "Successful registrations.", EXPORT_COUNTER),
+  SERVICE_METRIC(reg_attempts, "csmp_reg_attempts", "Registration attempts.", EXPORT_COUNTER),
+  SERVICE_METRIC(reg_fails, "csmp_reg_fails", "Failed registrations.", EXPORT_COUNTER),
+  SERVICE_METRIC(reg_fails_stats.error_coap, "csmp_reg_fails_coap",
+                 "Registrations failed with a CoAP error.", EXPORT_COUNTER),
+  SERVICE_METRIC(reg_fails_stats.error_signature, "csmp_reg_fails_signature",
+                 "Registrations failed the signature check.", EXPORT_COUNTER),
+  SERVICE_METRIC(reg_fails_stats.error_process, "csmp_reg_fails_process",
+                 "Registrations whose response could not be processed.", EXPORT_COUNTER),
+  SERVICE_METRIC(reg_holds, "csmp_reg_holds", "Registrations held to spread the NMS load.", EXPORT_COUNTER),
+  SERVICE_METRIC(nms_failovers, "csmp_nms_failovers", "Failovers to the next NMS endpoint.", EXPORT_COUNTER),
+  SERVICE_METRIC(nms_redirects, "csmp_nms_redirects", "Redirects to another NMS.", EXPORT_COUNTER),
+  SERVICE_METRIC(reg_rtt, "csmp_reg_rtt_milliseconds",
+                 "Smoothed registration round trip time.", EXPORT_GAUGE),
+  SERVICE_METRIC(reg_rtt_max, "csmp_reg_rtt_max_milliseconds",
+                 "Longest registration round trip time.", EXPORT_GAUGE),
+  SERVICE_METRIC(reg_retransmits, "csmp_reg_retransmits",
+                 "Registrations resent while the previous one was unanswered.", EXPORT_COUNTER),
+  SERVICE_METRIC(metrics_reports, "csmp_reports", "Metric reports sent.", EXPORT_COUNTER),
+  SERVICE_METRIC(metrics_tlvs_suppressed, "csmp_report_tlvs_suppressed",
+                 "Unchanged TLVs left out of delta reports.", EXPORT_COUNTER),
+  SERVICE_METRIC(metrics_reports_queued, "csmp_reports_queued",
+                 "Reports queued while the NMS was unreachable.", EXPORT_COUNTER),
+  SERVICE_METRIC(metrics_reports_replayed, "csmp_reports_replayed",
+                 "Queued reports sent to the NMS.", EXPORT_COUNTER),
+  SERVICE_METRIC(metrics_reports_dropped, "csmp_reports_dropped",
+                 "Queued reports dropped because the queue was full.", EXPORT_COUNTER),
+  SERVICE_METRIC(metrics_report_latency, "csmp_report_latency_microseconds",
+                 "Smoothed time to encode and send a report.", EXPORT_GAUGE),
+  SERVICE_METRIC(metrics_report_latency_max, "csmp_report_latency_max_microseconds",
+                 "Longest time to encode and send a report.", EXPORT_GAUGE),
+  SERVICE_METRIC(csmp_get_succeed, "csmp_get_succeed", "Successful CSMP GET requests.", EXPORT_COUNTER),
+  SERVICE_METRIC(csmp_post_succeed, "csmp_post_succeed", "Successful CSMP POST requests.", EXPORT_COUNTER),
+  SERVICE_METRIC(csmp_outbuf_overflows, "csmp_outbuf_overflows",
+                 "POST responses that overflowed the response buffer.", EXPORT_COUNTER),
+  SERVICE_METRIC(coap_rx_errors, "csmp_coap_rx_errors", "Failed CoAP socket receives.", EXPORT_COUNTER),
+  SERVICE_METRIC(coap_rx_truncated, "csmp_coap_rx_truncated",
+                 "Datagrams larger than the receive buffer.", EXPORT_COUNTER),
+  SERVICE_METRIC(coap_rx_malformed, "csmp_coap_rx_malformed",
+                 "Datagrams that did not parse as CoAP.", EXPORT_COUNTER),
+  SERVICE_METRIC(coap_rx_kernel_drops, "csmp_coap_rx_kernel_drops",
+                 "Datagrams dropped by the kernel because the socket queue was full.", EXPORT_COUNTER),
+  SERVICE_METRIC(coap_tx_errors, "csmp_coap_tx_errors", "Failed CoAP sends.", EXPORT_COUNTER),
+  SERVICE_METRIC(log_dropped, "csmp_log_dropped",
+                 "Debug log messages dropped because the log rings were full.", EXPORT_COUNTER),
+  SERVICE_METRIC(tlv_heap_allocs, "csmp_tlv_heap_allocs",
+                 "Decoded TLVs that did not fit the decode arena and used the heap.", EXPORT_COUNTER),
+  SERVICE_METRIC(latency_dropped, "csmp_latency_dropped",
+                 "Latency samples not recorded because every histogram was in use.", EXPORT_COUNTER),
+  SERVICE_METRIC(sig_ok, "csmp_sig_ok", "Valid signatures.", EXPORT_COUNTER),
+  SERVICE_METRIC(sig_no_signature, "csmp_sig_no_signature",
+                 "Requests refused for a missing signature.", EXPORT_COUNTER),
+  SERVICE_METRIC(sig_bad_auth, "csmp_sig_bad_auth", "Signatures that failed verification.", EXPORT_COUNTER),
+  SERVICE_METRIC(sig_bad_validity, "csmp_sig_bad_validity",
+                 "Signatures outside their validity period.", EXPORT_COUNTER)
+};
+
+static const export_metric_t m_event_metric[] = {
+  EVENT_METRIC(trigger_low, "csmp_events_low", "Low priority events raised."),
+  EVENT_METRIC(trigger_med, "csmp_events_medium", "Medium priority events raised."),
+  EVENT_METRIC(trigger_high, "csmp_events_high", "High priority events raised."),
+  EVENT_METRIC(sent, "csmp_events_sent", "Events sent to the NMS."),
+  EVENT_METRIC(bad_priority, "csmp_events_bad_priority", "Events raised with an invalid priority."),
+  EVENT_METRIC(coalesced, "csmp_events_coalesced", "Repeats merged into an earlier event."),
+  EVENT_METRIC(dropped, "csmp_events_dropped", "Events dropped."),
+  EVENT_METRIC(acked, "csmp_events_acked", "High priority events acknowledged by the NMS."),
+  EVENT_METRIC(rejected, "csmp_events_rejected", "High priority events the NMS answered with an error.")
+};
+
+static const char *m_latency_kind[CSMP_LATENCY_KIND_CNT] = {
+  "request", "handler_get", "handler_post", "provider_get", "provider_post",
+  "signature", "response", "provider_batch"
+};
+
+extern uint8_t g_csmplib_status;
+
+static char m_export_buf[EXPORT_BUF_SIZE];
+static pthread_t m_export_thread;
+static bool m_export_running = false;
+static int m_export_fd = -1;
+static char m_export_path[sizeof(((struct sockaddr_un *)0)->sun_path)];
+
+static void out_printf(export_out_t *out, const char *fmt, ...) {
+  va_list ap;
+  int n;
+
+  if (out->overflow)
+    return;
+  va_start(ap, fmt);
+  n = vsnprintf(out->buf + out->used, out->size - out->used, fmt, ap);
+  va_end(ap);
+  if ((n < 0) || ((uint32_t)n >= out->size - out->used))
+    out->overflow = true;
+  else
+    out->used += n;
+}
+
+static void out_family(export_out_t *out, const char *name, const char *type, const char *help) {
+  out_printf(out, "# TYPE %s %s\n# HELP %s %s\n", name, type, name, help);
+}
+
+static void out_metric(export_out_t *out, const export_metric_t *metric, uint32_t value) {
+  bool counter = (metric->type == EXPORT_COUNTER);
+
+  out_family(out, metric->name, counter ? "counter" : "gauge", metric->help);
+  out_printf(out, "%s%s %u\n", metric->name, counter ? "_total" : "", value);
+}
+
+static void render_latency(export_out_t *out) {
+  const char *name = "csmp_latency_microseconds";
+  const char *max_name = "csmp_latency_max_microseconds";
+  csmp_latency_stats_t latency[LATENCY_SITE_MAX];
+  csmp_latency_stats_t *st;
+  uint32_t cnt, i;
+
+  cnt = csmplatency_snapshot(latency, LATENCY_SITE_MAX);
+  if (cnt == 0)
+    return;
+
+  out_family(out, name, "summary", "Latency of request handling, handlers and callbacks.");
+  for (i = 0; i < cnt; i++) {
+    st = &latency[i];
+    out_printf(out, "%s{kind=\"%s\",key=\"%u\",quantile=\"0.5\"} %u\n",
+               name, m_latency_kind[st->kind], st->key, st->p50);
+    out_printf(out, "%s{kind=\"%s\",key=\"%u\",quantile=\"0.99\"} %u\n",
+               name, m_latency_kind[st->kind], st->key, st->p99);
+    out_printf(out, "%s_count{kind=\"%s\",key=\"%u\"} %u\n",
+               name, m_latency_kind[st->kind], st->key, st->count);
+  }
+  out_family(out, max_name, "gauge", "Longest latency of request handling, handlers and callbacks.");
+  for (i = 0; i < cnt; i++) {
+    st = &latency[i];
+    out_printf(out, "%s{kind=\"%s\",key=\"%u\"} %u\n",
+               max_name, m_latency_kind[st->kind], st->key, st->max);
+  }
+}
+
+int csmpexport_render(char *buf, uint32_t size) {
+  export_out_t out = { buf, size, 0, false };
+  csmp_service_stats_t stats;
+  csmp_event_stats_t event_stats;
+  uint32_t i;
+
+  if (!buf || !size)
+    return -1;
+
+  csmpstats_snapshot(&stats, CSMP_STATS_TOTAL);
+  out_family(&out, "csmp_service_status", "gauge",
+             "Service status: 0 not started, 1 start failure, 2 registering, 3 registered.");
+  out_printf(&out, "csmp_service_status %u\n", g_csmplib_status);
+  for (i = 0; i < sizeof(m_service_metric) / sizeof(m_service_metric[0]); i++) {
+    out_metric(&out, &m_service_metric[i],
+               *(uint32_t *)((uint8_t *)&stats + m_service_metric[i].offset));
+  }
+
+  csmpevent_stats(&event_stats);
+  for (i = 0; i < sizeof(m_event_metric) / sizeof(m_event_metric[0]); i++) {
+    out_metric(&out, &m_event_metric[i],
+               *(uint32_t *)((uint8_t *)&event_stats + m_event_metric[i].offset));
+  }
+
+  render_latency(&out);
+  out_printf(&out, "# EOF\n");
+  return out.overflow ? -1 : (int)out.used;
+}
+
+static void export_write(int fd, const char *buf, size_t len) {
+  ssize_t rv;
+
+  while (len) {
+    rv = send(fd, buf, len, MSG_NOSIGNAL);
+    if (rv < 0) {
+      if (errno == EINTR)
+        continue;
+      return;
+    }
+    buf += rv;
+    len -= rv;
+  }
+}
+
+/* answer one client, with an HTTP header if it sent an HTTP request */
+static void export_serve(int fd) {
+  char req[EXPORT_REQ_SIZE];
+  char hdr[128];
+  struct pollfd pfd = { fd, POLLIN, 0 };
+  bool http = false;
+  ssize_t rv;
+  int len;
+
+  if (poll(&pfd, 1, EXPORT_REQ_WAIT) > 0) {
+    rv = recv(fd, req, sizeof(req), MSG_DONTWAIT);
+    http = (rv >= 4) && (memcmp(req, "GET ", 4) == 0);
+  }
+
+  len = csmpexport_render(m_export_buf, sizeof(m_export_buf));
+  if (len < 0) {
+    EPRINTF("csmpexport: metrics do not fit in %u bytes\n", EXPORT_BUF_SIZE);
+    if (http)
+      export_write(fd, "HTTP/1.0 500 Internal Server Error\r\n\r\n", 38);
+    return;
+  }
+
+  if (http) {
+    snprintf(hdr, sizeof(hdr), "HTTP/1.0 200 OK\r\n"
+             "Content-Type: application/openmetrics-text; version=1.0.0; charset=utf-8\r\n"
+             "Content-Length: %d\r\n\r\n", len);
+    export_write(fd, hdr, strlen(hdr));
+  }
+  export_write(fd, m_export_buf, len);
+}
+
+static void *export_thread(void *arg) {
+  int fd;
+
+  (void)arg; // Suppress unused param compiler warning.
+  IPRINTF("csmpexport: serving metrics on %s\n", m_export_path);
+
+  while (1) {
+    fd = accept(m_export_fd, NULL, NULL);
+    if (fd < 0) {
+      if ((errno == EINTR) || (errno == ECONNABORTED))
+        continue;
+      EPRINTF("csmpexport: accept failed: %s\n", strerror(errno));
+      break;
+    }
+    pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, NULL);
+    export_serve(fd);
+    close(fd);
+    pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, NULL);
+  }
+  return NULL;
+}
+
+int csmpexport_start(const char *path) {
+  struct sockaddr_un addr;
+
+  if (m_export_running)
+    csmpexport_stop();
+  if (!path || (strlen(path) >= sizeof(addr.sun_path)))
+    return -1;
+
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strcpy(addr.sun_path, path);
+
+  m_export_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (m_export_fd < 0)
+    return -1;
+
+  unlink(path);
+  if ((bind(m_export_fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) ||
+      (listen(m_export_fd, 4) < 0)) {
+    EPRINTF("csmpexport: listen on %s failed: %s\n", path, strerror(errno));
+    close(m_export_fd);
+    m_export_fd = -1;
+    return -1;
+  }
+
+  strcpy(m_export_path, path);
+  if (pthread_create(&m_export_thread, NULL, export_thread, NULL) != 0) {
+    close(m_export_fd);
+    m_export_fd = -1;
+    unlink(path);
+    return -1;
+  }
+  m_export_running = true;
+  return 0;
+}
+
+void csmpexport_stop() {
+  if (!m_export_running)
+    return;
+
+  // accept() is a cancellation point, a scrape in progress finishes first
+  pthread_cancel(m_export_thread);
+  pthread_join(m_export_thread, NULL);
+  close(m_export_fd);
+  m_export_fd = -1;
+  unlink(m_export_path);
+  m_export_running = false;
+}
@@ -0,0 +1,55 @@
+/*
+ *  Copyright 2021 Cisco Systems, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef _CSMPEXPORT_H
+#define _CSMPEXPORT_H
+
+/*! \file
+ *
+ * OpenMetrics exporter
+ *
+ * Renders the service statistics, event statistics, CoAP drop counters
+ * and latency summaries as OpenMetrics text. Rendering works from
+ * snapshots into a caller supplied buffer and never allocates. The
+ * optional exporter thread serves the text on a Unix domain socket, with
+ * an HTTP header when the client sends an HTTP request.
+ */
+
+#include <stdint.h>
+
+/**
+ * @brief render the metrics as OpenMetrics text
+ *
+ * @param buf filled with the text, NUL terminated
+ * @param size size of buf
+ * @return int length of the text, -1 if it does not fit
+ */
+int csmpexport_render(char *buf, uint32_t size);
+
+/**
+ * @brief start serving the metrics on a Unix domain socket
+ *
+ * @param path socket path, an existing socket file is replaced
+ * @return int 0 on success, -1 on failure
+ */
+int csmpexport_start(const char *path);
+
+/**
+ * @brief stop the exporter and remove its socket
+ */
+void csmpexport_stop();
+
+#endif
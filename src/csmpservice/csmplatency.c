@@ -0,0 +1,155 @@
+/*
+ *  Copyright 2021 Cisco Systems, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include "csmp.h"
+#include "csmplatency.h"
+#include "csmpstats.h"
+
+enum {
+  LATENCY_BUCKET_CNT = 24,  // bucket b > 0 holds [2^(b-1), 2^b) us, the last one the rest
+  LATENCY_KEY_MASK = 0xFFFFFF
+};
+
+/* samples of every histogram recorded by the threads sharing a shard */
+typedef struct {
+  uint32_t bucket[LATENCY_SITE_MAX][LATENCY_BUCKET_CNT];
+  uint32_t max[LATENCY_SITE_MAX];
+} latency_shard_t;
+
+/* kind and key of each histogram, (kind << 24 | key) + 1, 0 while unused */
+static uint32_t m_site[LATENCY_SITE_MAX];
+static latency_shard_t m_shard[LATENCY_SHARD_CNT];
+static uint32_t m_shard_next = 0;
+static __thread int32_t m_shard_self = -1;
+
+void csmplatency_reset() {
+  memset(m_site, 0, sizeof(m_site));
+  memset(m_shard, 0, sizeof(m_shard));
+}
+
+uint64_t csmplatency_start() {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/* find the histogram of kind and key, claiming a free one on first use */
+static int32_t latency_site(csmp_latency_kind_t kind, uint32_t key) {
+  uint32_t id = (((uint32_t)kind << 24) | (key & LATENCY_KEY_MASK)) + 1;
+  uint32_t i, slot, cur;
+
+  for (i = 0; i < LATENCY_SITE_MAX; i++) {
+    slot = (id * 2654435761U + i) % LATENCY_SITE_MAX;
+    cur = __atomic_load_n(&m_site[slot], __ATOMIC_ACQUIRE);
+    if (cur == id)
+      return slot;
+    if (cur == 0) {
+      if (__atomic_compare_exchange_n(&m_site[slot], &cur, id, false,
+                                      __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) || (cur == id))
+        return slot;
+    }
+  }
+  return -1;
+}
+
+static uint32_t latency_bucket(uint32_t us) {
+  uint32_t b;
+
+  if (us == 0)
+    return 0;
+  b = 32 - __builtin_clz(us);
+  return (b < LATENCY_BUCKET_CNT) ? b : LATENCY_BUCKET_CNT - 1;
+}
+
+void csmplatency_record(csmp_latency_kind_t kind, uint32_t key, uint64_t start) {
+  uint64_t elapsed = csmplatency_start() - start;
+  uint32_t us = (elapsed > UINT32_MAX) ? UINT32_MAX : (uint32_t)elapsed;
+  latency_shard_t *shard;
+  uint32_t max;
+  int32_t site;
+
+  site = latency_site(kind, key);
+  if (site < 0) {
+    CSMP_STAT_INC(latency_dropped);
+    return;
+  }
+
+  if (m_shard_self < 0)
+    m_shard_self = __atomic_fetch_add(&m_shard_next, 1, __ATOMIC_RELAXED) % LATENCY_SHARD_CNT;
+  shard = &m_shard[m_shard_self];
+
+  __atomic_fetch_add(&shard->bucket[site][latency_bucket(us)], 1, __ATOMIC_RELAXED);
+  max = __atomic_load_n(&shard->max[site], __ATOMIC_RELAXED);
+  while ((us > max) &&
+         !__atomic_compare_exchange_n(&shard->max[site], &max, us, true,
+                                      __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    ;
+}
+
+/* upper bound of the bucket holding the pct percentile sample, at most max */
+static uint32_t latency_percentile(const uint32_t *bucket, uint32_t count,
+                                   uint32_t max, uint32_t pct) {
+  uint32_t target = (uint32_t)(((uint64_t)count * pct + 99) / 100);
+  uint32_t sum = 0, b, bound;
+
+  for (b = 0; b < LATENCY_BUCKET_CNT; b++) {
+    sum += bucket[b];
+    if (sum >= target)
+      break;
+  }
+  if (b >= LATENCY_BUCKET_CNT - 1)
+    return max;
+  bound = b ? (1U << b) - 1 : 0;
+  return (bound < max) ? bound : max;
+}
+
+uint32_t csmplatency_snapshot(csmp_latency_stats_t *list, uint32_t cnt) {
+  uint32_t bucket[LATENCY_BUCKET_CNT];
+  uint32_t site, shard, b, id, n = 0;
+  csmp_latency_stats_t *st;
+
+  for (site = 0; (site < LATENCY_SITE_MAX) && (n < cnt); site++) {
+    id = __atomic_load_n(&m_site[site], __ATOMIC_ACQUIRE);
+    if (id == 0)
+      continue;
+
+    st = &list[n];
+    memset(st, 0, sizeof(csmp_latency_stats_t));
+    memset(bucket, 0, sizeof(bucket));
+    for (shard = 0; shard < LATENCY_SHARD_CNT; shard++) {
+      for (b = 0; b < LATENCY_BUCKET_CNT; b++)
+        bucket[b] += __atomic_load_n(&m_shard[shard].bucket[site][b], __ATOMIC_RELAXED);
+      if (m_shard[shard].max[site] > st->max)
+        st->max = m_shard[shard].max[site];
+    }
+    for (b = 0; b < LATENCY_BUCKET_CNT; b++)
+      st->count += bucket[b];
+    if (st->count == 0)
+      continue;
+
+    st->kind = (csmp_latency_kind_t)((id - 1) >> 24);
+    st->key = (id - 1) & LATENCY_KEY_MASK;
+    st->p50 = latency_percentile(bucket, st->count, st->max, 50);
+    st->p99 = latency_percentile(bucket, st->count, st->max, 99);
+    n++;
+  }
+  return n;
+}
@@ -0,0 +1,62 @@
+/*
+ *  Copyright 2021 Cisco Systems, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef _CSMPLATENCY_H
+#define _CSMPLATENCY_H
+
+/*! \file
+ *
+ * Latency histograms
+ *
+ * Samples are counted in log2 buckets of microseconds. Each thread
+ * records into its own shard with relaxed atomics, and the shards are
+ * merged when a snapshot is taken.
+ */
+
+#include <stdint.h>
+#include "csmp.h"
+
+/**
+ * @brief clear every histogram
+ */
+void csmplatency_reset();
+
+/**
+ * @brief start timing
+ *
+ * @return uint64_t monotonic time (us) to pass to csmplatency_record()
+ */
+uint64_t csmplatency_start();
+
+/**
+ * @brief record the time elapsed since start
+ *
+ * @param kind what was timed
+ * @param key TLV type or CoAP method, 0 for kinds without a key
+ * @param start value returned by csmplatency_start()
+ */
+void csmplatency_record(csmp_latency_kind_t kind, uint32_t key, uint64_t start);
+
+/**
+ * @brief summarise the histograms
+ *
+ * @param list filled with up to cnt summaries
+ * @param cnt size of list
+ * @return uint32_t summaries written to list
+ */
+uint32_t csmplatency_snapshot(csmp_latency_stats_t *list, uint32_t cnt);
+
+#endif
@@ -30,10 +30,11 @@
 #include "csmptlv.h"
 #include "coapserver.h"
 #include "csmpagent.h"
+#include "csmplatency.h"
+#include "csmpstats.h"
 #include "CsmpTlvs.pb-c.h"
 
 enum {
-  URISEG_MAX_SIZE = 128,
   OUTBUF_SIZE = 1048,
   OUTBUF_MAX = 1024, // Provides margin to overflow
   QRY_LIST_MAX = 20,
@@ -42,14 +43,170 @@ enum {
 
 static uint8_t m_RespBuf[OUTBUF_SIZE];
 
-uint32_t strntoul(char *str, char **endptr, uint32_t len, int base);
-bool getArgInt(char *key, const coap_uri_seg_t *list,
-    uint32_t list_cnt, uint32_t *val);
-bool getArgTlvList(char *key, const coap_uri_seg_t *list,
-    uint32_t list_cnt, tlvid_t *vals, uint32_t *vals_cnt);
-bool getArgString(char *key, const coap_uri_seg_t *list,
-    uint32_t list_cnt, char* s, uint32_t *slen);
+/* Block2 transfer being served, a request for its next block resumes here */
+typedef struct {
+  struct in6_addr addr;  // the client
+  uint16_t port;
+  tlvid_t tlvid;
+  uint8_t szx;
+  uint32_t num;  // next block, 0 when no transfer is open
+  uint32_t used;  // when it was last served, the oldest is reused
+  csmp_cursor_t cursor;  // start of block num
+} block_state_t;
+
+static block_state_t m_block[BLOCK_XFER_MAX];
+static uint32_t m_block_clock = 0;
+
+extern coap_socket_config_t g_csmplib_socket_config;
+
+/* query arguments of a request, slices of the CoAP options */
+typedef struct {
+  bool has_t1;
+  bool has_t2;
+  bool has_s;
+  bool has_n;
+  uint32_t t1;
+  uint32_t t2;
+  uint32_t s;  // first row of a page
+  uint32_t n;  // rows in a page
+  const char *q;  // TLV list, NULL without q=
+  uint32_t q_len;
+  uint32_t f_cnt;  // row predicates, every f= is kept
+  const char *f[FILTER_PRED_MAX + 1];
+  uint32_t f_len[FILTER_PRED_MAX + 1];
+} query_args_t;
 
+/*
+ * Finds every known argument in one pass over the Uri-Query options,
+ * the first occurrence of a key wins but f= may be repeated. Values are
+ * left in place.
+ */
+static void parse_query(const coap_uri_seg_t *query, uint32_t query_cnt, query_args_t *args)
+{
+  const char *seg;
+  uint32_t len, i;
+
+  memset(args, 0, sizeof(*args));
+  for (i = 0; i < query_cnt; i++) {
+    seg = (const char *)query[i].val;
+    len = query[i].len;
+    if ((len >= 2) && (seg[0] == 'q') && (seg[1] == '=')) {
+      if (!args->q) {
+        args->q = seg + 2;
+        args->q_len = len - 2;
+      }
+    }
+    else if ((len >= 2) && (seg[0] == 'f') && (seg[1] == '=')) {
+      // One more than fits, so that too many predicates are refused
+      if (args->f_cnt <= FILTER_PRED_MAX) {
+        args->f[args->f_cnt] = seg + 2;
+        args->f_len[args->f_cnt++] = len - 2;
+      }
+    }
+    else if ((len >= 2) && (seg[0] == 's') && (seg[1] == '=')) {
+      if (!args->has_s)
+        args->has_s = csmptlv_strn2u32(seg + 2, len - 2, &args->s) > 0;
+    }
+    else if ((len >= 2) && (seg[0] == 'n') && (seg[1] == '=')) {
+      if (!args->has_n)
+        args->has_n = csmptlv_strn2u32(seg + 2, len - 2, &args->n) > 0;
+    }
+    else if ((len >= 3) && (seg[0] == 't') && (seg[2] == '=')) {
+      if ((seg[1] == '1') && !args->has_t1)
+        args->has_t1 = csmptlv_strn2u32(seg + 3, len - 3, &args->t1) > 0;
+      else if ((seg[1] == '2') && !args->has_t2)
+        args->has_t2 = csmptlv_strn2u32(seg + 3, len - 3, &args->t2) > 0;
+    }
+  }
+}
+
+/* space separated TLV ids of q=, up to the first that does not parse */
+static uint32_t parse_tlvlist(const char *list, uint32_t len, tlvid_t *vals, uint32_t vals_max)
+{
+  uint32_t used = 0, cnt = 0;
+  size_t rv;
+
+  while ((used < len) && (list[used] == ' '))
+    used++;
+  while ((used < len) && (cnt < vals_max)) {
+    rv = csmptlv_strn2id(list + used, len - used, &vals[cnt]);
+    if (rv == 0)
+      break;
+    cnt++;
+    used += rv;
+    while ((used < len) && (list[used] != ' '))
+      used++;
+    while ((used < len) && (list[used] == ' '))
+      used++;
+  }
+  return cnt;
+}
+
+/*
+ * Open transfer of a client for a TLV, or the one to replace. Clients
+ * may change tokens between the blocks of a transfer, so transfers are
+ * told apart by client and TLV.
+ */
+static block_state_t *block_state(const struct sockaddr_in6 *from, tlvid_t tlvid)
+{
+  block_state_t *st, *old = &m_block[0];
+  uint32_t i;
+
+  for (i = 0; i < BLOCK_XFER_MAX; i++) {
+    st = &m_block[i];
+    if (st->num && (st->port == from->sin6_port) &&
+        (memcmp(&st->addr, &from->sin6_addr, sizeof(st->addr)) == 0) &&
+        (st->tlvid.vendor == tlvid.vendor) && (st->tlvid.type == tlvid.type))
+      return st;
+    if (!st->num)
+      old = st;
+    else if (old->num && ((int32_t)(st->used - old->used) < 0))
+      old = st;
+  }
+  old->num = 0;
+  return old;
+}
+
+/*
+ * Encodes one block of a TLV, only the rows it overlaps are read. The
+ * next block of a client's open transfer continues from its cursor, any
+ * other block is reached by stepping over the blocks before it.
+ */
+static uint16_t get_block(const struct sockaddr_in6 *from, tlvid_t tlvid, coap_block_t *block,
+                          uint8_t *buf, size_t *len)
+{
+  block_state_t *st = block_state(from, tlvid);
+  size_t size = COAP_BLOCK_SIZE(block->szx);
+  bool more = false;
+  int rv;
+
+  st->addr = from->sin6_addr;
+  st->port = from->sin6_port;
+  st->used = ++m_block_clock;
+  if ((block->num == 0) || (block->num != st->num) || (block->szx != st->szx) ||
+      (tlvid.vendor != st->tlvid.vendor) || (tlvid.type != st->tlvid.type)) {
+    memset(&st->cursor, 0, sizeof(st->cursor));
+    for (st->num = 0; st->num < block->num; st->num++) {
+      rv = csmpagent_get_block(tlvid, buf, size, &st->cursor, &more);
+      if ((rv < 0) || !more) {
+        st->num = 0;
+        return (rv < 0) ? COAP_CODE_NOT_FOUND : COAP_CODE_BAD_OPTION;
+      }
+    }
+  }
+
+  rv = csmpagent_get_block(tlvid, buf, size, &st->cursor, &more);
+  if (rv < 0) {
+    st->num = 0;
+    return COAP_CODE_NOT_FOUND;
+  }
+  *len = rv;
+  block->more = more;
+  st->tlvid = tlvid;
+  st->szx = block->szx;
+  st->num = more ? block->num + 1 : 0;
+  return COAP_CODE_CONTENT;
+}
 
 bool checkExempt(tlvid_t tlvid) {
   const tlvid_t exempt_list[] = {{0,DESCRIPTION_REQUEST_TLVID},{0,IMAGE_BLOCK_TLVID}};
@@ -74,52 +231,48 @@ void recv_request(struct sockaddr_in6 *from,
 	uint32_t url_cnt,
     const coap_uri_seg_t *query,
 	uint32_t query_cnt,
+    const coap_block_t *block2,
     const void *body,
 	uint16_t body_len)
 {
   DPRINTF("request received!\n");
+  uint64_t start = csmplatency_start(), send_start;
   tlvid_t tlvid = {0,0};
   int32_t tlvindex = -1L;
   uint8_t *out_buf = NULL;
   size_t out_len = 0;
   uint16_t coap_status = COAP_CODE_BAD_REQ;
+  coap_block_t block = {0, false, COAP_BLOCK_SZX_MAX};
+  const coap_block_t *resp_block = NULL;
+  bool quiet = false;
   int rv = 0;
   tlvid_t tlvid_default[2] = {{0, SESSION_ID_TLVID},{0, CURRENT_TIME_TLVID}};
   uint32_t i;
 
 #ifdef PRINTDEBUG
-  printf("CsmpServer: ");
-  switch (method) {
-    case COAP_GET: printf("GET "); break;
-    case COAP_POST: printf("POST "); break;
-    case COAP_DELETE: printf("DELETE "); break;
-    default: printf("UNKNOWN "); break;
-  }
+  {
+    const char *method_str[] = {"UNKNOWN", "GET", "POST", "PUT", "DELETE"};
+    const char *type_str[] = {"[CON]", "[NON]", "[?]", "[?]"};
 
-  switch (tx_type) {
-    case COAP_CON: printf("[CON] "); break;
-    case COAP_NON: printf("[NON] "); break;
-    default: printf("[?] "); break;
-  }
-  for (i = 0;i < url_cnt;i++) {
-    printf("/%.*s",url[i].len,url[i].val);
-  }
-  for (i = 0;i < query_cnt;i++) {
-    printf("%c%.*s",(i) ? '&' : '?',query[i].len,query[i].val);
+    DPRINTF("CsmpServer: %s %s ", method_str[(method <= COAP_DELETE) ? method : 0],
+            type_str[tx_type & 3]);
+    for (i = 0;i < url_cnt;i++) {
+      DPRINTF("/%.*s",(int)url[i].len,url[i].val);
+    }
+    for (i = 0;i < query_cnt;i++) {
+      DPRINTF("%c%.*s",(i) ? '&' : '?',(int)query[i].len,query[i].val);
+    }
+    DPRINTF("\n");
   }
-  printf("\n");
-#else
-  (void)tx_type;	// Null expression to avoid unused-parameter warning
 #endif
 
   if ((url_cnt) && (strncmp((char *)url[0].val,"c",url[0].len) == 0)) {
-    if ((url_cnt > 1) && (url[1].len < URISEG_MAX_SIZE-1)) {
-      char item[URISEG_MAX_SIZE];
-      memcpy(item,url[1].val,url[1].len);
-      item[url[1].len] = '\0';
-      csmptlv_str2id(item, &tlvid);
-      if (url_cnt > 2 && (url[2].len < URISEG_MAX_SIZE-1)) {
-        tlvindex = strntoul((char *)url[2].val,NULL,url[2].len,10);
+    if (url_cnt > 1) {
+      csmptlv_strn2id((const char *)url[1].val, url[1].len, &tlvid);
+      if (url_cnt > 2) {
+        uint32_t index = 0;
+        csmptlv_strn2u32((const char *)url[2].val, url[2].len, &index);
+        tlvindex = index;
       }
     }
     else {
@@ -127,7 +280,7 @@ void recv_request(struct sockaddr_in6 *from,
     }
   }
   else {
-    DPRINTF("CsmpServer: Invalid URL!");
+    DPRINTF("CsmpServer: Invalid URL!\n");
     goto done;
   }
 
@@ -136,14 +289,56 @@ void recv_request(struct sockaddr_in6 *from,
   {
     case COAP_GET:
       {
-        uint32_t t1=0, t2=0;
+        query_args_t args;
+        csmp_filter_t filter = {0};
         tlvid_t tlvlist[QRY_LIST_MAX] = {{0,0}};
-        uint32_t tlvcnt = QRY_LIST_MAX;
+        uint32_t tlvcnt, rows;
         uint32_t i;
 
-        getArgInt("t1=",query,query_cnt,&t1);
-        getArgInt("t2=",query,query_cnt,&t2);
-        if (getArgTlvList("q=", query, query_cnt, tlvlist, &tlvcnt)) {
+        parse_query(query, query_cnt, &args);
+        // A page of a table, the next one starts at s plus the rows received
+        if ((args.has_s || args.has_n || args.f_cnt) && !args.q && (tlvindex < 0)) {
+          if (!csmpagent_has_rows(tlvid)) {
+            coap_status = COAP_CODE_BAD_OPTION;
+            goto done;
+          }
+          for (i = 0; i < args.f_cnt; i++) {
+            if (!csmpfilter_add(&filter, tlvid.type, args.f[i], args.f_len[i])) {
+              DPRINTF("CsmpServer: Bad filter %.*s\n", (int)args.f_len[i], args.f[i]);
+              goto done;
+            }
+          }
+          DPRINTF("CsmpServer: Getting %u.%u rows %u+%u, %u predicates\n", tlvid.vendor,
+                  tlvid.type, args.s, args.n, filter.cnt);
+          rv = csmpagent_get_rows(tlvid, out_buf, OUTBUF_MAX, args.s,
+                                  args.has_n ? args.n : CSMP_ROWS_ALL,
+                                  filter.cnt ? &filter : NULL, &rows);
+          if (rv < 0) {
+            coap_status = COAP_CODE_NOT_FOUND;
+            goto done;
+          }
+          out_len = rv;
+          CSMP_STAT_INC(csmp_get_succeed);
+          coap_status = COAP_CODE_CONTENT;
+          break;
+        }
+        // A table goes out in blocks of OUTBUF_MAX unless the client asks for smaller ones,
+        // other TLVs only when the client asks for blocks
+        if (!args.q && (tlvindex < 0) && (block2 || csmpagent_has_rows(tlvid))) {
+          if (block2)
+            block = *block2;
+          DPRINTF("CsmpServer: Getting %u.%u block %u of %u bytes\n", tlvid.vendor, tlvid.type,
+                  block.num, COAP_BLOCK_SIZE(block.szx));
+          coap_status = get_block(from, tlvid, &block, out_buf, &out_len);
+          if (coap_status != COAP_CODE_CONTENT)
+            goto done;
+          if (block2 || block.more)
+            resp_block = &block;
+          CSMP_STAT_INC(csmp_get_succeed);
+          break;
+        }
+        if (args.q) {
+          tlvcnt = parse_tlvlist(args.q, args.q_len, tlvlist, QRY_LIST_MAX);
           tlvindex = -1;
         }
         else {
@@ -151,6 +346,7 @@ void recv_request(struct sockaddr_in6 *from,
           tlvcnt = 1;
         }
 
+        csmp_provider_begin(tlvlist, tlvcnt);
         for (i=0; i<tlvcnt; i++) {
           DPRINTF("CsmpServer: Getting %u.%u\n", tlvlist[i].vendor, tlvlist[i].type);
           rv = csmpagent_get(tlvlist[i], out_buf, OUTBUF_MAX - out_len, tlvindex);
@@ -159,13 +355,15 @@ void recv_request(struct sockaddr_in6 *from,
               rv = 0;
             }
             else {
+              csmp_provider_end();
               coap_status = COAP_CODE_NOT_FOUND; out_len = 0;
               goto done;
             }
           }
           out_buf += rv; out_len += (size_t) rv;
         }
-        g_csmplib_stats.csmp_get_succeed++;
+        csmp_provider_end();
+        CSMP_STAT_INC(csmp_get_succeed);
         coap_status = COAP_CODE_CONTENT;
       }
       break;
@@ -177,9 +375,13 @@ void recv_request(struct sockaddr_in6 *from,
         uint32_t tlvlen = 0;
         uint32_t iused = 0, oused = 0;
         size_t rvo = 0;
+        tlvid_t block_id = {0, IMAGE_BLOCK_TLVID};
 
         int sigStat = checkSignature(ibuf,body_len);
 
+        // NON requests carrying only image blocks are usually multicast, no response is sent
+        quiet = (tx_type == COAP_NON) && csmptlv_find(ibuf, body_len, block_id, NULL);
+
         if (sigStat < 0) {
           DPRINTF("CsmpServer: POST Signature Check failed.\n");
           coap_status = COAP_CODE_UNAUTHORIZED; // Unauthorized
@@ -187,6 +389,11 @@ void recv_request(struct sockaddr_in6 *from,
         }
         if (checkGroup(ibuf,body_len) == false) {
           DPRINTF("CsmpServer: POST Group Match false.\n");
+          // Blocks multicast to another group are not answered either
+          if (quiet) {
+            csmplatency_record(CSMP_LATENCY_REQUEST, method, start);
+            return;
+          }
           break;
         }
 
@@ -207,11 +414,14 @@ void recv_request(struct sockaddr_in6 *from,
           default:
 
           if ((sigStat == 0) && (checkExempt(tlvid) == false)) {
-            g_csmplib_stats.sig_no_signature++;
+            CSMP_STAT_INC(sig_no_signature);
             coap_status = COAP_CODE_FORBIDDEN; // Forbidden
             goto done;
           }
 
+          if (tlvid.type != IMAGE_BLOCK_TLVID)
+            quiet = false;
+          rvo = 0;
           rv = csmpagent_post(tlvid, ibuf, rv + tlvlen, obuf, OUTBUF_MAX - oused, &rvo, tlvindex);
           if (rv < 0) {
             coap_status = COAP_CODE_NOT_FOUND; // Not Found
@@ -221,6 +431,7 @@ void recv_request(struct sockaddr_in6 *from,
           ibuf += rv; iused += rv;
           obuf += rvo; oused += rvo;
           if (oused >= OUTBUF_MAX) {
+            CSMP_STAT_INC(csmp_outbuf_overflows);
             coap_status = COAP_CODE_INTERNAL_SERVER_ERROR;
             rv = -1;
             break;
@@ -237,7 +448,7 @@ void recv_request(struct sockaddr_in6 *from,
            }
            out_len = oused;
          }
-         g_csmplib_stats.csmp_post_succeed++;
+         CSMP_STAT_INC(csmp_post_succeed);
          coap_status = COAP_CODE_CREATED;
        }
      }
@@ -251,83 +462,21 @@ void recv_request(struct sockaddr_in6 *from,
   }
 
 done:
+    if (quiet && (coap_status == COAP_CODE_CREATED) && (out_len == 0)) {
+      DPRINTF("CsmpServer: NON image block request, no response\n");
+      csmplatency_record(CSMP_LATENCY_REQUEST, method, start);
+      return;
+    }
     DPRINTF("CsmpServer: Sending Response [out_len=%u], [coap_status=%u]\n",(int)out_len, coap_status);
-    coapserver_response(from, COAP_ACK, tx_id, token_length, token, coap_status, m_RespBuf, out_len);
+    send_start = csmplatency_start();
+    coapserver_response(from, COAP_ACK, tx_id, token_length, token, coap_status, resp_block,
+                        m_RespBuf, out_len);
+    csmplatency_record(CSMP_LATENCY_RESPONSE, 0, send_start);
+    csmplatency_record(CSMP_LATENCY_REQUEST, method, start);
 
   return;
 }
 
-uint32_t strntoul(char *str, char **endptr, uint32_t len, int base)
-{
-  char item[URISEG_MAX_SIZE];
-  memcpy(item,str,len);
-  item[len] = '\0';
-  return strtoul(item,endptr,base);
-}
-
-bool getArgInt(char *key, const coap_uri_seg_t *list, uint32_t list_cnt, uint32_t *val)
-{
-  char item[URISEG_MAX_SIZE];
-  uint32_t keylen = strlen(key);
-  uint32_t i;
-
-  for (i = 0;i < list_cnt;i++) {
-    if ((strncmp(key,(char *)list[i].val,keylen) == 0) &&
-        (list[i].len < sizeof(item))) {
-      uint32_t vallen = list[i].len - keylen;
-      *val = strntoul((char *)&list[i].val[keylen],NULL,vallen,10);
-      return true;
-    }
-  }
-  return false;
-}
-
-bool getArgTlvList(char *key, const coap_uri_seg_t *list, uint32_t list_cnt, tlvid_t *vals, uint32_t *vals_cnt)
-{
-  char item[URISEG_MAX_SIZE];
-  uint32_t keylen = strlen(key);
-  uint32_t i,j;
-
-  for (i = 0;i < list_cnt;i++) {
-    if ((strncmp(key,(char *)list[i].val,keylen) == 0) &&
-        (list[i].len < sizeof(item))) {
-      uint32_t vallen = list[i].len - keylen;
-      char *tmp = item;
-      memcpy(item,&list[i].val[keylen],vallen);
-      item[vallen] = '\0';
-      for (j=0;(j < *vals_cnt) && (*tmp != '\0');j++) {
-        int rv;
-        rv = csmptlv_str2id(tmp,&vals[j]);
-        if (rv == 0)
-          break;
-        while ((*tmp) && (*tmp != ' ')) tmp++;
-        while ((*tmp) && (*tmp == ' ')) tmp++;
-      }
-      *vals_cnt = j;
-      return true;
-    }
-  }
-  return false;
-}
-
-bool getArgString(char *key, const coap_uri_seg_t *list, uint32_t list_cnt, char* s, uint32_t *slen)
-{
-  uint32_t keylen = strlen(key);
-  uint32_t i;
-
-  for (i = 0;i < list_cnt;i++) {
-    if ((strncmp(key,(char *)list[i].val,keylen) == 0) &&
-        (list[i].len < *slen)) {
-      uint32_t vallen = list[i].len - keylen;
-      memcpy(s,&list[i].val[keylen],vallen);
-      s[vallen] = '\0';
-      *slen = vallen;
-      return true;
-    }
-  }
-  return false;
-}
-
 bool csmpserver_disable()
 {
   int ret = 0;
@@ -341,7 +490,8 @@ bool csmpserver_disable()
 bool csmpserver_enable()
 {
   int ret = 0;
-  ret = coapserver_listen(CSMP_DEFAULT_PORT, (recv_handler_t)recv_request);
+  ret = coapserver_listen(CSMP_DEFAULT_PORT, (recv_handler_t)recv_request,
+                          &g_csmplib_socket_config);
   if(ret < 0)
     return false;
   else
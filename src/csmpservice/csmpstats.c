@@ -0,0 +1,156 @@
+/*
+ *  Copyright 2021 Cisco Systems, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "csmp.h"
+#include "coapserver.h"
+#include "coapclient.h"
+#include "csmplog.h"
+#include "csmptlv.h"
+#include "csmpstats.h"
+
+/* every field of csmp_service_stats_t, in order */
+#define STATS_FIELDS(X) \
+  X(reg_succeed) X(reg_attempts) X(reg_fails) \
+  X(reg_fails_stats.error_coap) X(reg_fails_stats.error_signature) \
+  X(reg_fails_stats.error_process) X(reg_holds) X(nms_failovers) \
+  X(nms_redirects) X(reg_rtt) X(reg_rtt_max) X(reg_retransmits) \
+  X(metrics_reports) X(metrics_tlvs_suppressed) X(metrics_reports_queued) \
+  X(metrics_reports_replayed) X(metrics_reports_dropped) \
+  X(metrics_report_latency) X(metrics_report_latency_max) \
+  X(csmp_get_succeed) X(csmp_post_succeed) X(csmp_outbuf_overflows) \
+  X(coap_rx_errors) X(coap_rx_truncated) X(coap_rx_malformed) \
+  X(coap_rx_kernel_drops) X(coap_tx_errors) X(log_dropped) \
+  X(tlv_heap_allocs) X(latency_dropped) \
+  X(sig_ok) X(sig_no_signature) X(sig_bad_auth) X(sig_bad_validity)
+
+#define STATS_COUNT(field) + 1
+#define STATS_OFFSET(field) offsetof(csmp_service_stats_t, field),
+#define STATS_IS_U32(field) \
+  _Static_assert(sizeof(((csmp_service_stats_t *)0)->field) == sizeof(uint32_t), \
+                 "csmp_service_stats_t." #field " is not a uint32_t");
+
+enum {
+  STATS_FIELD_CNT = 0 STATS_FIELDS(STATS_COUNT)
+};
+
+/* The shards index a field by its offset / sizeof(uint32_t) and the
+ * exporter reads fields as uint32_t by offset, so the struct must be
+ * exactly the uint32_t fields listed above */
+STATS_FIELDS(STATS_IS_U32)
+_Static_assert(sizeof(csmp_service_stats_t) == STATS_FIELD_CNT * sizeof(uint32_t),
+               "csmp_service_stats_t has fields missing from STATS_FIELDS");
+
+static const uint16_t m_field_offset[STATS_FIELD_CNT] = {
+  STATS_FIELDS(STATS_OFFSET)
+};
+
+/* counters bumped by the threads sharing a shard, a cache line apart */
+typedef struct {
+  uint32_t field[STATS_FIELD_CNT];
+} __attribute__((aligned(64))) stats_shard_t;
+
+static stats_shard_t m_shard[STATS_SHARD_CNT];
+static uint32_t m_shard_next = 0;
+static __thread int32_t m_shard_self = -1;
+
+/* gauges live apart from the shards, counters are always 0 here */
+static uint32_t m_gauge[STATS_FIELD_CNT];
+
+/* counter sums at the last reset and at the last delta snapshot */
+static uint32_t m_base[STATS_FIELD_CNT];
+static uint32_t m_last[STATS_FIELD_CNT];
+static pthread_mutex_t m_snapshot_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* sum the shards and add the counters the CoAP sockets keep themselves */
+static void stats_sum(uint32_t *sum) {
+  csmp_service_stats_t *stats = (csmp_service_stats_t *)sum;
+  coap_stats_t coap[2];
+  uint32_t shard, i;
+
+  memset(sum, 0, STATS_FIELD_CNT * sizeof(uint32_t));
+  for (shard = 0; shard < STATS_SHARD_CNT; shard++) {
+    for (i = 0; i < STATS_FIELD_CNT; i++)
+      sum[i] += __atomic_load_n(&m_shard[shard].field[i], __ATOMIC_RELAXED);
+  }
+
+  coapserver_stats(&coap[0]);
+  coapclient_stats(&coap[1]);
+  for (i = 0; i < 2; i++) {
+    stats->coap_rx_errors += coap[i].rx_errors;
+    stats->coap_rx_truncated += coap[i].rx_truncated;
+    stats->coap_rx_malformed += coap[i].rx_malformed;
+    stats->coap_rx_kernel_drops += coap[i].rx_kernel_drops;
+    stats->coap_tx_errors += coap[i].tx_errors;
+  }
+  stats->log_dropped = csmplog_dropped();
+  stats->tlv_heap_allocs = csmptlv_heap_allocs();
+}
+
+void csmpstats_reset() {
+  pthread_mutex_lock(&m_snapshot_lock);
+  memset(m_shard, 0, sizeof(m_shard));
+  memset(m_gauge, 0, sizeof(m_gauge));
+  // The socket counters outlive the service, count from where they are
+  stats_sum(m_base);
+  memcpy(m_last, m_base, sizeof(m_last));
+  pthread_mutex_unlock(&m_snapshot_lock);
+}
+
+void csmpstats_add(size_t offset, uint32_t n) {
+  if (m_shard_self < 0)
+    m_shard_self = __atomic_fetch_add(&m_shard_next, 1, __ATOMIC_RELAXED) % STATS_SHARD_CNT;
+
+  __atomic_fetch_add(&m_shard[m_shard_self].field[offset / sizeof(uint32_t)], n,
+                     __ATOMIC_RELAXED);
+}
+
+void csmpstats_smooth(size_t avg, size_t max, uint32_t sample) {
+  uint32_t *pavg = &m_gauge[avg / sizeof(uint32_t)];
+  uint32_t *pmax = &m_gauge[max / sizeof(uint32_t)];
+  uint32_t cur;
+
+  cur = __atomic_load_n(pavg, __ATOMIC_RELAXED);
+  __atomic_store_n(pavg, cur ? (7 * cur + sample) / 8 : sample, __ATOMIC_RELAXED);
+  if (sample > __atomic_load_n(pmax, __ATOMIC_RELAXED))
+    __atomic_store_n(pmax, sample, __ATOMIC_RELAXED);
+}
+
+void csmpstats_snapshot(csmp_service_stats_t *out, csmp_stats_mode_t mode) {
+  uint32_t sum[STATS_FIELD_CNT];
+  uint32_t i, j;
+
+  stats_sum(sum);
+
+  pthread_mutex_lock(&m_snapshot_lock);
+  for (i = 0; i < STATS_FIELD_CNT; i++) {
+    j = m_field_offset[i] / sizeof(uint32_t);
+    *(uint32_t *)((uint8_t *)out + m_field_offset[i]) =
+      sum[j] - ((mode == CSMP_STATS_DELTA) ? m_last[j] : m_base[j]) +
+      __atomic_load_n(&m_gauge[j], __ATOMIC_RELAXED);
+  }
+  if (mode != CSMP_STATS_TOTAL)
+    memcpy(m_last, sum, sizeof(m_last));
+  if (mode == CSMP_STATS_RESET) {
+    memcpy(m_base, sum, sizeof(m_base));
+    for (i = 0; i < STATS_FIELD_CNT; i++)
+      __atomic_store_n(&m_gauge[i], 0, __ATOMIC_RELAXED);
+  }
+  pthread_mutex_unlock(&m_snapshot_lock);
+}
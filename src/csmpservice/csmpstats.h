@@ -0,0 +1,79 @@
+/*
+ *  Copyright 2021 Cisco Systems, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef _CSMPSTATS_H
+#define _CSMPSTATS_H
+
+/*! \file
+ *
+ * Service statistics
+ *
+ * Counters are kept per thread shard and bumped with relaxed atomics, so
+ * the receive and timer threads never contend on a lock. Smoothed values
+ * and maxima are gauges written by the single thread that measures them.
+ * Snapshots sum the shards; every counter is read atomically and never
+ * goes backwards, resets only move the baseline snapshots are taken from.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include "csmpservice.h"
+
+/** add n to the counter field of csmp_service_stats_t */
+#define CSMP_STAT_ADD(field, n) \
+  csmpstats_add(offsetof(csmp_service_stats_t, field), (n))
+
+/** bump the counter field of csmp_service_stats_t */
+#define CSMP_STAT_INC(field) CSMP_STAT_ADD(field, 1)
+
+/** fold a sample into the smoothed gauge avg and the maximum gauge max */
+#define CSMP_STAT_SMOOTH(avg, max, sample) \
+  csmpstats_smooth(offsetof(csmp_service_stats_t, avg), \
+                   offsetof(csmp_service_stats_t, max), (sample))
+
+/**
+ * @brief clear every counter and gauge
+ *
+ * Only called while no other thread updates the statistics.
+ */
+void csmpstats_reset();
+
+/**
+ * @brief add to a counter
+ *
+ * @param offset offset of the counter in csmp_service_stats_t
+ * @param n amount to add
+ */
+void csmpstats_add(size_t offset, uint32_t n);
+
+/**
+ * @brief fold a sample into a smoothed gauge and its maximum
+ *
+ * @param avg offset of the smoothed gauge in csmp_service_stats_t
+ * @param max offset of the maximum gauge in csmp_service_stats_t
+ * @param sample the new sample
+ */
+void csmpstats_smooth(size_t avg, size_t max, uint32_t sample);
+
+/**
+ * @brief take a snapshot of the statistics
+ *
+ * @param out filled with the statistics
+ * @param mode what the counters in out count from, see csmp_stats_mode_t
+ */
+void csmpstats_snapshot(csmp_service_stats_t *out, csmp_stats_mode_t mode);
+
+#endif
@@ -0,0 +1,351 @@
+/*
+ *  Copyright 2021 Cisco Systems, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include "debug.h"
+#include "ProtobufVarint.h"
+#include "sha256.h"
+#include "imageslot.h"
+
+enum {
+  IS_MAGIC = 0x534d4943,  /* "CIMS" */
+  IS_VERSION = 2,
+  IS_VARINT_MAX = 5
+};
+
+/* hash of the blocks received without a gap from the start of the image */
+typedef struct {
+  uint32_t blocks;   /* blocks hashed */
+  uint32_t reserved;
+  sha256_ctx_t ctx;
+} is_hash_t;
+
+/* file trailer, after the image and the bitmap */
+typedef struct {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t size;     /* image area size */
+  uint32_t hash_cur; /* hash[] entry in use, the other one is written next */
+  imageslot_info_t info;
+  is_hash_t hash[2];
+} is_header_t;
+
+static int m_fd = -1;
+static size_t m_maplen = 0;
+static uint8_t *m_image = NULL;
+static uint8_t *m_bitmap = NULL;
+static is_header_t *m_hdr = NULL;
+static int m_verified = 0;  /* imageslot_verify() result, 0 until known */
+
+static uint32_t is_align8(uint32_t len) {
+  return (len + 7) & ~7U;
+}
+
+static bool is_received(uint32_t blocknum) {
+  return (m_bitmap[blocknum >> 3] >> (blocknum & 7)) & 1;
+}
+
+static uint32_t is_blocklen(uint32_t blocknum) {
+  const imageslot_info_t *info = &m_hdr->info;
+
+  return (blocknum == info->blocks - 1) ? info->filesize - blocknum * info->blocksize : info->blocksize;
+}
+
+static void is_hash_reset() {
+  memset(m_hdr->hash, 0, sizeof(m_hdr->hash));
+  sha256_init(&m_hdr->hash[0].ctx);
+  m_hdr->hash_cur = 0;
+  m_verified = 0;
+}
+
+/*
+ * Extend the prefix hash over the blocks received since it stopped.
+ * data holds block blocknum, so the block just received is hashed
+ * from the request instead of being read back from the slot. The
+ * hash is built in the entry not in use and switched to in one store,
+ * a restart finds either the old or the new state.
+ */
+static void is_hash_advance(uint32_t blocknum, const uint8_t *data) {
+  const is_hash_t *cur = &m_hdr->hash[m_hdr->hash_cur & 1];
+  is_hash_t *next = &m_hdr->hash[(m_hdr->hash_cur & 1) ^ 1];
+  uint32_t n;
+
+  if ((cur->blocks >= m_hdr->info.blocks) || !is_received(cur->blocks))
+    return;
+
+  *next = *cur;
+  for (n = next->blocks; (n < m_hdr->info.blocks) && is_received(n); n++)
+    sha256_update(&next->ctx, (data && (n == blocknum)) ? data : m_image + n * m_hdr->info.blocksize,
+                  is_blocklen(n));
+  next->blocks = n;
+  __sync_synchronize();
+  m_hdr->hash_cur = (m_hdr->hash_cur & 1) ^ 1;
+}
+
+static void is_reset() {
+  memset(&m_hdr->info, 0, sizeof(m_hdr->info));
+  is_hash_reset();
+}
+
+/* check the transfer left in the file and recount its blocks */
+static void is_recover() {
+  imageslot_info_t *info = &m_hdr->info;
+  const is_hash_t *hash;
+  uint32_t i, received = 0;
+
+  if (info->filesize == 0)
+    return;
+  if ((info->filesize > m_hdr->size) || (info->blocksize == 0) ||
+      (info->blocks != (info->filesize - 1) / info->blocksize + 1) ||
+      (info->hashlen > sizeof(info->filehash))) {
+    WPRINTF("imageslot: bad transfer header, slot reset\n");
+    is_reset();
+    return;
+  }
+
+  // The bitmap may be ahead of the counter if the agent stopped in between
+  for (i = 0; i < (info->blocks + 7) / 8; i++)
+    received += __builtin_popcount(m_bitmap[i]);
+  info->received = received;
+
+  // The prefix hash may be behind the bitmap for the same reason
+  hash = &m_hdr->hash[m_hdr->hash_cur & 1];
+  if ((hash->blocks > info->blocks) ||
+      (hash->ctx.count != ((hash->blocks == info->blocks) ? info->filesize :
+                           (uint64_t)hash->blocks * info->blocksize))) {
+    WPRINTF("imageslot: bad image hash state, rehashing\n");
+    is_hash_reset();
+  }
+  is_hash_advance(UINT32_MAX, NULL);
+}
+
+int imageslot_open(const char *path, uint32_t size) {
+  struct stat st;
+  uint32_t bitmap_off, hdr_off;
+  void *map;
+
+  if (m_hdr)
+    imageslot_close();
+  if (!path || (size == 0) || (size > UINT32_MAX / 2))
+    return -1;
+
+  bitmap_off = is_align8(size);
+  hdr_off = bitmap_off + is_align8((size + 7) / 8);
+
+  m_fd = open(path, O_RDWR | O_CREAT, 0600);
+  if (m_fd < 0) {
+    EPRINTF("imageslot: open %s failed: %s\n", path, strerror(errno));
+    return -1;
+  }
+
+  m_maplen = hdr_off + sizeof(is_header_t);
+  if ((fstat(m_fd, &st) < 0) ||
+      (((size_t)st.st_size != m_maplen) && (ftruncate(m_fd, m_maplen) < 0))) {
+    EPRINTF("imageslot: sizing %s failed: %s\n", path, strerror(errno));
+    close(m_fd);
+    m_fd = -1;
+    return -1;
+  }
+
+  map = mmap(NULL, m_maplen, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+  if (map == MAP_FAILED) {
+    EPRINTF("imageslot: mmap %s failed: %s\n", path, strerror(errno));
+    close(m_fd);
+    m_fd = -1;
+    return -1;
+  }
+  m_image = (uint8_t *)map;
+  m_bitmap = m_image + bitmap_off;
+  m_hdr = (is_header_t *)(m_image + hdr_off);
+  m_verified = 0;
+
+  if ((m_hdr->magic != IS_MAGIC) || (m_hdr->version != IS_VERSION) || (m_hdr->size != size)) {
+    memset(m_hdr, 0, sizeof(is_header_t));
+    m_hdr->version = IS_VERSION;
+    m_hdr->size = size;
+    is_hash_reset();
+    m_hdr->magic = IS_MAGIC;
+  }
+  else
+    is_recover();
+
+  IPRINTF("imageslot: %s opened, %u of %u blocks received\n", path,
+          m_hdr->info.received, m_hdr->info.blocks);
+  return 0;
+}
+
+void imageslot_close() {
+  if (!m_hdr)
+    return;
+
+  msync(m_image, m_maplen, MS_SYNC);
+  munmap(m_image, m_maplen);
+  close(m_fd);
+  m_fd = -1;
+  m_image = NULL;
+  m_bitmap = NULL;
+  m_hdr = NULL;
+}
+
+bool imageslot_isopen() {
+  return m_hdr != NULL;
+}
+
+int imageslot_start(const imageslot_info_t *info) {
+  imageslot_info_t *cur;
+
+  if (!m_hdr || (info->filesize == 0) || (info->blocksize == 0) ||
+      (info->hashlen > sizeof(info->filehash)))
+    return -1;
+  if (info->filesize > m_hdr->size) {
+    WPRINTF("imageslot: image of %u bytes does not fit the slot\n", info->filesize);
+    return -1;
+  }
+
+  cur = &m_hdr->info;
+  if ((cur->filesize == info->filesize) && (cur->blocksize == info->blocksize) &&
+      imageslot_match(info->filehash, info->hashlen) && (imageslot_verify() >= 0)) {
+    IPRINTF("imageslot: resuming transfer, %u of %u blocks received\n", cur->received, cur->blocks);
+    return 0;
+  }
+
+  // Invalidate the old transfer before its bitmap is cleared
+  cur->filesize = 0;
+  __sync_synchronize();
+  memset(m_bitmap, 0, ((info->filesize - 1) / info->blocksize + 1 + 7) / 8);
+  is_hash_reset();
+  *cur = *info;
+  cur->blocks = (info->filesize - 1) / info->blocksize + 1;
+  cur->received = 0;
+
+  msync(m_image, m_maplen, MS_ASYNC);
+  IPRINTF("imageslot: transfer of %u blocks started\n", cur->blocks);
+  return 0;
+}
+
+const imageslot_info_t *imageslot_info() {
+  if (!m_hdr || (m_hdr->info.filesize == 0))
+    return NULL;
+  return &m_hdr->info;
+}
+
+bool imageslot_match(const uint8_t *hash, size_t len) {
+  if (!m_hdr || (m_hdr->info.filesize == 0) || (len != m_hdr->info.hashlen))
+    return false;
+  return memcmp(m_hdr->info.filehash, hash, len) == 0;
+}
+
+bool imageslot_complete() {
+  return m_hdr && (m_hdr->info.filesize != 0) && (m_hdr->info.received == m_hdr->info.blocks);
+}
+
+int imageslot_write(uint32_t blocknum, const uint8_t *data, uint32_t len) {
+  imageslot_info_t *info;
+  uint32_t off;
+
+  if (!m_hdr || (m_hdr->info.filesize == 0))
+    return -1;
+
+  info = &m_hdr->info;
+  if (blocknum >= info->blocks)
+    return -1;
+  off = blocknum * info->blocksize;
+  if (len != is_blocklen(blocknum))
+    return -1;
+  if (is_received(blocknum))
+    return 0;
+
+  // The block is marked only once its data is in place
+  memcpy(m_image + off, data, len);
+  __sync_synchronize();
+  m_bitmap[blocknum >> 3] |= 1U << (blocknum & 7);
+  info->received++;
+  if (blocknum == m_hdr->hash[m_hdr->hash_cur & 1].blocks)
+    is_hash_advance(blocknum, data);
+
+  if (info->received == info->blocks) {
+    msync(m_image, m_maplen, MS_SYNC);
+    IPRINTF("imageslot: all %u blocks received, image hash %s\n", info->blocks,
+            (imageslot_verify() > 0) ? "verified" : (imageslot_verify() < 0) ? "mismatch" : "not checked");
+  }
+  return 1;
+}
+
+int imageslot_verify() {
+  const is_hash_t *hash;
+  uint8_t digest[SHA256_DIGEST_SIZE];
+
+  if (!imageslot_complete() || (m_hdr->info.hashlen != SHA256_DIGEST_SIZE))
+    return 0;
+  if (m_verified)
+    return m_verified;
+
+  hash = &m_hdr->hash[m_hdr->hash_cur & 1];
+  if (hash->blocks != m_hdr->info.blocks)
+    return 0;
+  sha256_final(&hash->ctx, digest);
+  m_verified = (memcmp(digest, m_hdr->info.filehash, SHA256_DIGEST_SIZE) == 0) ? 1 : -1;
+  return m_verified;
+}
+
+const uint8_t *imageslot_bitmap(uint32_t *len) {
+  if (!m_hdr || (m_hdr->info.filesize == 0))
+    return NULL;
+  *len = (m_hdr->info.blocks + 7) / 8;
+  return m_bitmap;
+}
+
+size_t imageslot_missing(uint8_t *buf, size_t size) {
+  uint8_t run[2 * IS_VARINT_MAX];
+  uint32_t blocks, n = 0, start, end = 0, rv;
+  size_t used = 0;
+
+  if (!m_hdr || (m_hdr->info.filesize == 0))
+    return 0;
+
+  blocks = m_hdr->info.blocks;
+  while (n < blocks) {
+    // Whole bytes are skipped at once, bits past the last block are never set
+    while ((n < blocks) && is_received(n))
+      n += (((n & 7) == 0) && (m_bitmap[n >> 3] == 0xFF)) ? 8 : 1;
+    if (n >= blocks)
+      break;
+    start = n;
+    while ((n < blocks) && !is_received(n))
+      n += (((n & 7) == 0) && (m_bitmap[n >> 3] == 0)) ? 8 : 1;
+    if (n > blocks)
+      n = blocks;
+
+    rv = ProtobufVarint_encodeUINT32(run, sizeof(run), start - end);
+    rv += ProtobufVarint_encodeUINT32(run + rv, sizeof(run) - rv, n - start);
+    if (rv > size - used)
+      break;
+    memcpy(buf + used, run, rv);
+    used += rv;
+    end = n;
+  }
+  return used;
+}
@@ -0,0 +1,166 @@
+/*
+ *  Copyright 2021 Cisco Systems, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef _IMAGESLOT_H
+#define _IMAGESLOT_H
+
+/*! \file
+ *
+ * Firmware image slot
+ *
+ * mmap'd file receiving the blocks of a firmware image in any order.
+ * The first fileSize bytes of the file are the image, followed by a
+ * bitmap of the received blocks and a header describing the transfer,
+ * so a transfer resumes where it stopped after a restart.
+ *
+ * Block n is bit (n % 8) of bitmap byte n / 8, set once received.
+ *
+ * The SHA-256 of the image is computed while it is received: blocks
+ * extending the received prefix are hashed as they arrive, blocks
+ * received out of order once the gap before them is filled. The hash
+ * state is kept in the header too, so the image is not read back to
+ * verify it.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/**
+ * @brief the image in the slot
+ *
+ */
+typedef struct {
+  uint32_t filesize;  /**< image size in bytes, 0 if no transfer was started */
+  uint32_t blocksize;  /**< bytes per block, the last block may be shorter */
+  uint32_t blocks;  /**< blocks in the image */
+  uint32_t received;  /**< blocks received */
+  uint32_t hashlen;  /**< bytes in filehash */
+  uint8_t filehash[32];  /**< image hash, identifies the transfer */
+  char filename[128];  /**< image file name */
+  char version[32];  /**< image version */
+  char hwid[32];  /**< hardware the image is for */
+  char vendorhwid[32];  /**< vendor hardware the image is for */
+} imageslot_info_t;
+
+/**
+ * @brief open (or create) the slot file
+ *
+ * A transfer left in a valid file is kept, a file with a different
+ * layout or size is reinitialised.
+ *
+ * @param path file backing the slot
+ * @param size largest image in bytes
+ * @return int 0 on success, -1 on failure
+ */
+int imageslot_open(const char *path, uint32_t size);
+
+/**
+ * @brief flush and close the slot file
+ */
+void imageslot_close();
+
+/**
+ * @brief check whether a slot file is open
+ *
+ * @return true
+ * @return false
+ */
+bool imageslot_isopen();
+
+/**
+ * @brief start the transfer of an image
+ *
+ * The transfer resumes with the blocks already received when the slot
+ * holds the same hash, size and block size and the image did not fail
+ * imageslot_verify(), otherwise the image in the slot is discarded.
+ *
+ * @param info filehash, filesize, blocksize and the description of the image
+ * @return int 0 on success, -1 if the image does not fit the slot
+ */
+int imageslot_start(const imageslot_info_t *info);
+
+/**
+ * @brief the image in the slot
+ *
+ * @return const imageslot_info_t* NULL if the slot is closed or no transfer was started
+ */
+const imageslot_info_t *imageslot_info();
+
+/**
+ * @brief check whether the slot holds the image with a hash
+ *
+ * @param hash image hash
+ * @param len hash length
+ * @return true
+ * @return false
+ */
+bool imageslot_match(const uint8_t *hash, size_t len);
+
+/**
+ * @brief check whether every block of the image was received
+ *
+ * @return true
+ * @return false
+ */
+bool imageslot_complete();
+
+/**
+ * @brief check the image against its hash
+ *
+ * Only SHA-256 hashes are checked, other hashes are left to the
+ * application.
+ *
+ * @return int 1 if the image matches filehash, -1 if it does not, 0 if the
+ * image is incomplete or filehash is not a SHA-256
+ */
+int imageslot_verify();
+
+/**
+ * @brief store a block of the image
+ *
+ * The file is synced once the last missing block is stored.
+ *
+ * @param blocknum block number, counted from 0
+ * @param data block data
+ * @param len block length, blocksize except for the last block
+ * @return int 1 if stored, 0 if the block was already received, -1 if invalid
+ */
+int imageslot_write(uint32_t blocknum, const uint8_t *data, uint32_t len);
+
+/**
+ * @brief bitmap of the received blocks
+ *
+ * @param len set to the bitmap length, (blocks + 7) / 8 bytes
+ * @return const uint8_t* bitmap in the mapped file, NULL if no transfer was started
+ */
+const uint8_t *imageslot_bitmap(uint32_t *len);
+
+/**
+ * @brief list the missing blocks compactly
+ *
+ * Each run of missing blocks is written as two varints, the blocks
+ * received since the end of the previous run (or the start of the
+ * image) and the length of the run. Runs that do not fit buf are left
+ * out, they are listed again once the first ones are received.
+ *
+ * @param buf output buffer
+ * @param size output buffer size
+ * @return size_t bytes written, 0 when no block is missing or size is below 10 bytes
+ */
+size_t imageslot_missing(uint8_t *buf, size_t size);
+
+#endif
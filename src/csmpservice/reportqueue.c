@@ -0,0 +1,324 @@
+/*
+ *  Copyright 2021 Cisco Systems, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include "debug.h"
+#include "reportqueue.h"
+
+enum {
+  RQ_MAGIC = 0x51524d43,  /* "CMRQ" */
+  RQ_VERSION = 1,
+  RQ_REC_MAGIC = 0x5251,  /* record */
+  RQ_REC_WRAP = 0x5257,   /* rest of the ring is unused, continue at offset 0 */
+  RQ_SIZE_MIN = 4096
+};
+
+/* file header, followed by the record area */
+typedef struct {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t size;     /* record area size */
+  uint32_t head;     /* offset of the oldest record */
+  uint32_t tail;     /* offset of the next record */
+  uint32_t count;    /* queued records */
+  uint32_t dropped;  /* records dropped because the queue was full */
+  uint32_t reserved;
+} rq_header_t;
+
+/* record header, followed by the payload padded to 4 bytes */
+typedef struct {
+  uint16_t magic;
+  uint16_t len;
+  uint32_t timestamp;
+  uint32_t crc;
+} rq_record_t;
+
+static int m_fd = -1;
+static size_t m_maplen = 0;
+static rq_header_t *m_hdr = NULL;
+static uint8_t *m_data = NULL;
+static uint32_t m_reserved_off = 0;
+static uint32_t m_reserved_len = 0;
+
+static uint32_t rq_crc32(const uint8_t *buf, uint32_t len) {
+  uint32_t crc = 0xFFFFFFFFU;
+  int i;
+
+  while (len--) {
+    crc ^= *buf++;
+    for (i = 0; i < 8; i++)
+      crc = (crc >> 1) ^ (0xEDB88320U & (0U - (crc & 1)));
+  }
+  return ~crc;
+}
+
+static uint32_t rq_reclen(uint32_t len) {
+  return (sizeof(rq_record_t) + len + 3) & ~3U;
+}
+
+/* offset where the record at off really starts, following a wrap */
+static uint32_t rq_normalize(uint32_t off) {
+  if ((m_hdr->size - off) < sizeof(rq_record_t))
+    return 0;
+  if (((rq_record_t *)(m_data + off))->magic == RQ_REC_WRAP)
+    return 0;
+  return off;
+}
+
+static bool rq_record_valid(uint32_t off) {
+  rq_record_t *rec = (rq_record_t *)(m_data + off);
+
+  if (rec->magic != RQ_REC_MAGIC)
+    return false;
+  if (rq_reclen(rec->len) > (m_hdr->size - off))
+    return false;
+  return rec->crc == rq_crc32((uint8_t *)(rec + 1), rec->len);
+}
+
+static void rq_reset() {
+  m_hdr->head = 0;
+  m_hdr->tail = 0;
+  m_hdr->count = 0;
+}
+
+static void rq_remove_oldest() {
+  rq_record_t *rec;
+
+  if (m_hdr->count == 0)
+    return;
+
+  rec = (rq_record_t *)(m_data + m_hdr->head);
+  if (--m_hdr->count == 0) {
+    rq_reset();
+    return;
+  }
+  m_hdr->head = rq_normalize(m_hdr->head + rq_reclen(rec->len));
+}
+
+/* walk the queued records and keep the intact ones in front of the first bad one */
+static void rq_recover() {
+  uint32_t off, i;
+
+  if ((m_hdr->head >= m_hdr->size) || (m_hdr->tail > m_hdr->size) ||
+      (m_hdr->head & 3) || (m_hdr->tail & 3)) {
+    WPRINTF("reportqueue: bad ring offsets, queue reset\n");
+    rq_reset();
+    return;
+  }
+
+  off = m_hdr->head;
+  for (i = 0; i < m_hdr->count; i++) {
+    off = rq_normalize(off);
+    if (!rq_record_valid(off))
+      break;
+    off += rq_reclen(((rq_record_t *)(m_data + off))->len);
+  }
+  if (i < m_hdr->count) {
+    WPRINTF("reportqueue: %u of %u records intact\n", i, m_hdr->count);
+    m_hdr->count = i;
+    m_hdr->tail = (off == m_hdr->size) ? 0 : off;
+    if (i == 0)
+      rq_reset();
+  }
+}
+
+int reportqueue_open(const char *path, uint32_t size) {
+  struct stat st;
+  void *map;
+
+  if (m_hdr)
+    reportqueue_close();
+  if (!path)
+    return -1;
+
+  size = (size + 3) & ~3U;
+  if (size < RQ_SIZE_MIN)
+    size = RQ_SIZE_MIN;
+
+  m_fd = open(path, O_RDWR | O_CREAT, 0600);
+  if (m_fd < 0) {
+    EPRINTF("reportqueue: open %s failed: %s\n", path, strerror(errno));
+    return -1;
+  }
+
+  m_maplen = sizeof(rq_header_t) + size;
+  if ((fstat(m_fd, &st) < 0) ||
+      (((size_t)st.st_size != m_maplen) && (ftruncate(m_fd, m_maplen) < 0))) {
+    EPRINTF("reportqueue: sizing %s failed: %s\n", path, strerror(errno));
+    close(m_fd);
+    m_fd = -1;
+    return -1;
+  }
+
+  map = mmap(NULL, m_maplen, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+  if (map == MAP_FAILED) {
+    EPRINTF("reportqueue: mmap %s failed: %s\n", path, strerror(errno));
+    close(m_fd);
+    m_fd = -1;
+    return -1;
+  }
+  m_hdr = (rq_header_t *)map;
+  m_data = (uint8_t *)map + sizeof(rq_header_t);
+
+  if ((m_hdr->magic != RQ_MAGIC) || (m_hdr->version != RQ_VERSION) || (m_hdr->size != size)) {
+    memset(m_hdr, 0, sizeof(rq_header_t));
+    m_hdr->version = RQ_VERSION;
+    m_hdr->size = size;
+    m_hdr->magic = RQ_MAGIC;
+  }
+  else
+    rq_recover();
+
+  IPRINTF("reportqueue: %s opened, %u records queued\n", path, m_hdr->count);
+  return 0;
+}
+
+void reportqueue_close() {
+  if (!m_hdr)
+    return;
+
+  msync(m_hdr, m_maplen, MS_SYNC);
+  munmap(m_hdr, m_maplen);
+  close(m_fd);
+  m_fd = -1;
+  m_hdr = NULL;
+  m_data = NULL;
+  m_reserved_len = 0;
+}
+
+bool reportqueue_isopen() {
+  return m_hdr != NULL;
+}
+
+uint8_t *reportqueue_reserve(uint32_t maxlen) {
+  uint32_t need = rq_reclen(maxlen);
+  uint32_t off;
+
+  if (!m_hdr || (maxlen > UINT16_MAX) || (need > m_hdr->size / 2))
+    return NULL;
+
+  while (1) {
+    if (m_hdr->count == 0) {
+      rq_reset();
+      off = 0;
+      break;
+    }
+    if (m_hdr->tail > m_hdr->head) {
+      if ((m_hdr->size - m_hdr->tail) >= need) {
+        off = m_hdr->tail;
+        break;
+      }
+      if (m_hdr->head >= need) {
+        // Leave the end of the ring unused
+        if ((m_hdr->size - m_hdr->tail) >= sizeof(rq_record_t))
+          ((rq_record_t *)(m_data + m_hdr->tail))->magic = RQ_REC_WRAP;
+        off = 0;
+        break;
+      }
+    }
+    else if ((m_hdr->tail < m_hdr->head) && ((m_hdr->head - m_hdr->tail) >= need)) {
+      off = m_hdr->tail;
+      break;
+    }
+    rq_remove_oldest();
+    m_hdr->dropped++;
+  }
+
+  m_reserved_off = off;
+  m_reserved_len = maxlen;
+  return m_data + off + sizeof(rq_record_t);
+}
+
+int reportqueue_commit(uint32_t len, uint32_t timestamp) {
+  rq_record_t *rec;
+
+  if (!m_hdr || !m_reserved_len || (len > m_reserved_len))
+    return -1;
+
+  rec = (rq_record_t *)(m_data + m_reserved_off);
+  rec->len = len;
+  rec->timestamp = timestamp;
+  rec->crc = rq_crc32((uint8_t *)(rec + 1), len);
+  __sync_synchronize();
+  rec->magic = RQ_REC_MAGIC;
+  __sync_synchronize();
+
+  // Publish the record only once it is complete
+  m_hdr->tail = m_reserved_off + rq_reclen(len);
+  if (m_hdr->tail == m_hdr->size)
+    m_hdr->tail = 0;
+  m_hdr->count++;
+  m_reserved_len = 0;
+
+  msync(m_hdr, m_maplen, MS_ASYNC);
+  return 0;
+}
+
+void reportqueue_cancel() {
+  m_reserved_len = 0;
+}
+
+int reportqueue_append(const uint8_t *buf, uint32_t len, uint32_t timestamp) {
+  uint8_t *dst = reportqueue_reserve(len);
+
+  if (!dst)
+    return -1;
+  memcpy(dst, buf, len);
+  return reportqueue_commit(len, timestamp);
+}
+
+const uint8_t *reportqueue_peek(uint32_t *len, uint32_t *timestamp) {
+  rq_record_t *rec;
+
+  if (!m_hdr || (m_hdr->count == 0))
+    return NULL;
+
+  if (!rq_record_valid(m_hdr->head)) {
+    WPRINTF("reportqueue: corrupt record at %u, queue reset\n", m_hdr->head);
+    m_hdr->dropped += m_hdr->count;
+    rq_reset();
+    return NULL;
+  }
+  rec = (rq_record_t *)(m_data + m_hdr->head);
+  *len = rec->len;
+  *timestamp = rec->timestamp;
+  return (uint8_t *)(rec + 1);
+}
+
+void reportqueue_pop() {
+  if (!m_hdr)
+    return;
+  rq_remove_oldest();
+  msync(m_hdr, m_maplen, MS_ASYNC);
+}
+
+uint32_t reportqueue_count() {
+  return m_hdr ? m_hdr->count : 0;
+}
+
+uint32_t reportqueue_dropped() {
+  return m_hdr ? m_hdr->dropped : 0;
+}
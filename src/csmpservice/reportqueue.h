@@ -0,0 +1,125 @@
+/*
+ *  Copyright 2021 Cisco Systems, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef _REPORTQUEUE_H
+#define _REPORTQUEUE_H
+
+/*! \file
+ *
+ * Offline report queue
+ *
+ * Fixed-size ring of encoded report payloads kept in an mmap'd file,
+ * so reports produced while the NMS is unreachable survive until they
+ * can be replayed. When the ring is full the oldest reports are dropped.
+ *
+ * Each record carries a CRC, and the ring header only advances once a
+ * record is complete, so a crash loses at most the record being written.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief open (or create) the queue file
+ *
+ * Records left in a valid file are kept, a file with a different layout
+ * or size is reinitialised.
+ *
+ * @param path file backing the queue
+ * @param size size in bytes of the record area
+ * @return int 0 on success, -1 on failure
+ */
+int reportqueue_open(const char *path, uint32_t size);
+
+/**
+ * @brief flush and close the queue file
+ */
+void reportqueue_close();
+
+/**
+ * @brief check whether a queue file is open
+ *
+ * @return true
+ * @return false
+ */
+bool reportqueue_isopen();
+
+/**
+ * @brief reserve room for a record, dropping the oldest records if needed
+ *
+ * The payload can be encoded straight into the returned buffer and is
+ * published by reportqueue_commit().
+ *
+ * @param maxlen maximum payload length
+ * @return uint8_t* payload buffer, NULL if the queue is closed or maxlen is too large
+ */
+uint8_t *reportqueue_reserve(uint32_t maxlen);
+
+/**
+ * @brief publish the reserved record
+ *
+ * @param len actual payload length, at most the reserved length
+ * @param timestamp time the report was produced
+ * @return int 0 on success, -1 on failure
+ */
+int reportqueue_commit(uint32_t len, uint32_t timestamp);
+
+/**
+ * @brief give up the reserved record
+ *
+ * Records dropped to make room for it stay dropped.
+ */
+void reportqueue_cancel();
+
+/**
+ * @brief copy a payload into the queue
+ *
+ * @param buf payload
+ * @param len payload length
+ * @param timestamp time the report was produced
+ * @return int 0 on success, -1 on failure
+ */
+int reportqueue_append(const uint8_t *buf, uint32_t len, uint32_t timestamp);
+
+/**
+ * @brief get the oldest record without removing it
+ *
+ * @param len payload length
+ * @param timestamp time the report was produced
+ * @return const uint8_t* payload in the mapped file, NULL if the queue is empty
+ */
+const uint8_t *reportqueue_peek(uint32_t *len, uint32_t *timestamp);
+
+/**
+ * @brief remove the oldest record
+ */
+void reportqueue_pop();
+
+/**
+ * @brief number of queued records
+ *
+ * @return uint32_t
+ */
+uint32_t reportqueue_count();
+
+/**
+ * @brief number of records dropped because the queue was full
+ *
+ * @return uint32_t
+ */
+uint32_t reportqueue_dropped();
+
+#endif
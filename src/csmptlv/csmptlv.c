@@ -15,6 +15,7 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "protobuf-c.h"
@@ -23,6 +24,77 @@
 #include "csmp.h"
 #include "csmptlv.h"
 
+enum {
+  ARENA_ALIGN = 16
+};
+
+/*
+ * Decoded messages are freed before the next one is decoded, or nested
+ * a few deep at most, so each thread decodes into a bump arena that is
+ * emptied when its last block is freed. Messages that do not fit it
+ * go to the heap allocator.
+ */
+typedef struct {
+  uint8_t buf[TLV_ARENA_SIZE] __attribute__((aligned(ARENA_ALIGN)));
+  size_t used;
+  uint32_t live;
+} tlv_arena_t;
+
+static void *heap_alloc(void *allocator_data, size_t size);
+static void heap_free(void *allocator_data, void *data);
+static void *arena_alloc(void *allocator_data, size_t size);
+static void arena_free(void *allocator_data, void *data);
+
+static __thread tlv_arena_t m_arena;
+static ProtobufCAllocator m_heap = {heap_alloc, heap_free, NULL};
+static ProtobufCAllocator m_allocator = {arena_alloc, arena_free, NULL};
+static uint32_t m_heap_allocs = 0;
+
+static void *heap_alloc(void *allocator_data, size_t size) {
+  (void)allocator_data; // Suppress unused param compiler warning.
+  return malloc(size);
+}
+
+static void heap_free(void *allocator_data, void *data) {
+  (void)allocator_data; // Suppress unused param compiler warning.
+  free(data);
+}
+
+static void *arena_alloc(void *allocator_data, size_t size) {
+  size_t need = (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+  void *data;
+
+  (void)allocator_data; // Suppress unused param compiler warning.
+  if ((need < size) || (need > sizeof(m_arena.buf) - m_arena.used)) {
+    __atomic_add_fetch(&m_heap_allocs, 1, __ATOMIC_RELAXED);
+    return m_heap.alloc(m_heap.allocator_data, size);
+  }
+  data = m_arena.buf + m_arena.used;
+  m_arena.used += need;
+  m_arena.live++;
+  return data;
+}
+
+static void arena_free(void *allocator_data, void *data) {
+  (void)allocator_data; // Suppress unused param compiler warning.
+  if (((uint8_t *)data < m_arena.buf) || ((uint8_t *)data >= m_arena.buf + sizeof(m_arena.buf))) {
+    m_heap.free(m_heap.allocator_data, data);
+    return;
+  }
+  if (--m_arena.live == 0)
+    m_arena.used = 0;
+}
+
+void csmptlv_allocator(const ProtobufCAllocator *heap) {
+  m_heap.alloc = heap ? heap->alloc : heap_alloc;
+  m_heap.free = heap ? heap->free : heap_free;
+  m_heap.allocator_data = heap ? heap->allocator_data : NULL;
+}
+
+uint32_t csmptlv_heap_allocs() {
+  return __atomic_load_n(&m_heap_allocs, __ATOMIC_RELAXED);
+}
+
 size_t csmptlv_write(uint8_t *buf, size_t len, tlvid_t tlvid, const ProtobufCMessage *msg) {
   uint8_t *p_cur, *p_tlvlen;
   uint32_t used = 0, rv;
@@ -51,6 +123,8 @@ size_t csmptlv_write(uint8_t *buf, size_t len, tlvid_t tlvid, const ProtobufCMes
     return 0;
 
   p_tlvlen = p_cur;
+  if ((len - used) < CSMP_LEN_SKIP)
+    return 0;
   p_cur += CSMP_LEN_SKIP; used += CSMP_LEN_SKIP;
 
   packsize = protobuf_c_message_get_packed_size(msg);
@@ -120,13 +194,19 @@ size_t csmptlv_readV(const uint8_t *buf, size_t len,
     ProtobufCMessage **msg, const ProtobufCMessageDescriptor *desc) {
   uint32_t rv;
 
-  *msg = protobuf_c_message_unpack(desc, NULL, len, buf);
+  *msg = protobuf_c_message_unpack(desc, &m_allocator, len, buf);
   if (!(*msg)) {
     DPRINTF("ProtobufMsg_unpack error!\n");
     rv = 0;
   }
   else {
     rv = protobuf_c_message_get_packed_size(*msg);
+    // Callers take 0 as a failure and have nothing to free, an empty
+    // message left in the arena would keep it from being emptied
+    if (rv == 0) {
+      csmptlv_free(*msg);
+      *msg = NULL;
+    }
   }
 
   return rv;
@@ -179,16 +259,50 @@ const uint8_t *csmptlv_find(const uint8_t *buf, size_t len, tlvid_t qtlvid, uint
   return NULL;
 }
 
-int csmptlv_str2id(const char *str, tlvid_t *ptlvid) {
-  int rv;
-  rv = sscanf(str,"e%u.%u",&ptlvid->vendor,&ptlvid->type);
-  if (rv == 0) {
-    ptlvid->vendor = 0;
-    rv = sscanf(str,"%u",&ptlvid->type);
+size_t csmptlv_strn2u32(const char *str, size_t len, uint32_t *val) {
+  uint64_t v = 0;
+  size_t i;
+
+  for (i = 0; (i < len) && (str[i] >= '0') && (str[i] <= '9'); i++) {
+    v = v * 10 + (uint32_t)(str[i] - '0');
+    if (v > UINT32_MAX)
+      return 0;
   }
+  if (i)
+    *val = (uint32_t)v;
+  return i;
+}
+
+size_t csmptlv_strn2id(const char *str, size_t len, tlvid_t *ptlvid) {
+  uint32_t vendor, type;
+  size_t used = 0, rv;
+
+  if ((len > 0) && (str[0] == 'e')) {
+    rv = csmptlv_strn2u32(str + 1, len - 1, &vendor);
+    used = 1 + rv;
+    if ((rv == 0) || (used >= len) || (str[used] != '.'))
+      return 0;
+    used++;
+    rv = csmptlv_strn2u32(str + used, len - used, &type);
+    if (rv == 0)
+      return 0;
+    ptlvid->vendor = vendor;
+    ptlvid->type = type;
+    return used + rv;
+  }
+
+  rv = csmptlv_strn2u32(str, len, &type);
+  if (rv == 0)
+    return 0;
+  ptlvid->vendor = 0;
+  ptlvid->type = type;
   return rv;
 }
 
+int csmptlv_str2id(const char *str, tlvid_t *ptlvid) {
+  return csmptlv_strn2id(str, strlen(str), ptlvid) ? 1 : 0;
+}
+
 int csmptlv_id2str(char *str, size_t str_size, const tlvid_t *ptlvid) {
   int rv;
   if (ptlvid->vendor != 0) {
@@ -202,5 +316,5 @@ int csmptlv_id2str(char *str, size_t str_size, const tlvid_t *ptlvid) {
 
 void csmptlv_free(ProtobufCMessage *message)
 {
-  protobuf_c_message_free_unpacked(message, NULL);
+  protobuf_c_message_free_unpacked(message, &m_allocator);
 }
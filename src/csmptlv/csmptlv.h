@@ -28,4 +28,41 @@ const uint8_t *csmptlv_find(const uint8_t *buf, size_t len, tlvid_t tlvid, uint3
 int csmptlv_str2id(const char *str, tlvid_t *ptlvid);
 int csmptlv_id2str(char *str, size_t str_size, const tlvid_t *ptlvid);
 
+/**
+ * @brief parse a TLV id, <type> or e<vendor>.<type>, at the start of a
+ * string that need not be NUL terminated
+ *
+ * @param str the string
+ * @param len length of str
+ * @param ptlvid filled with the id
+ * @return size_t characters parsed, 0 if str does not start with an id
+ */
+size_t csmptlv_strn2id(const char *str, size_t len, tlvid_t *ptlvid);
+
+/**
+ * @brief parse a decimal number at the start of a string that need not
+ * be NUL terminated
+ *
+ * @param str the string
+ * @param len length of str
+ * @param val filled with the number
+ * @return size_t digits parsed, 0 if there are none or the number overflows
+ */
+size_t csmptlv_strn2u32(const char *str, size_t len, uint32_t *val);
+
+/**
+ * @brief set the heap used for decoded messages that do not fit the
+ * per-thread decode arena (TLV_ARENA_SIZE)
+ *
+ * @param heap the allocator, NULL for malloc and free
+ */
+void csmptlv_allocator(const ProtobufCAllocator *heap);
+
+/**
+ * @brief decoded message blocks that did not fit the decode arena
+ *
+ * @return uint32_t heap allocations made for them
+ */
+uint32_t csmptlv_heap_allocs();
+
 #endif
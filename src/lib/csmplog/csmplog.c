@@ -0,0 +1,453 @@
+/*
+ *  Copyright 2021 Cisco Systems, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/eventfd.h>
+
+#include "csmplog.h"
+
+enum {
+  LOG_FLUSH_INTERVAL = 5000000,  // ns the log thread waits after a wakeup, to batch records
+  LOG_LINE_MAX = 512,
+  LOG_SPEC_MAX = 32
+};
+
+typedef enum {
+  RING_FREE = 0,
+  RING_OWNED,
+  RING_RELEASED  // the owner thread exited, freed once drained
+} ring_state_t;
+
+/* argument classes, as read from the format */
+typedef enum {
+  ARG_INT,
+  ARG_LONG,
+  ARG_LLONG,
+  ARG_SIZE,
+  ARG_PTR,
+  ARG_STR,
+  ARG_DOUBLE,
+  ARG_NONE
+} arg_class_t;
+
+/* one message, arg holds the raw arguments, %s arguments are offsets into str */
+typedef struct {
+  uint64_t ts;
+  const char *fmt;
+  uint8_t argc;
+  uint8_t strused;
+  uint64_t arg[LOG_ARG_MAX];
+  char str[LOG_STR_MAX];
+} log_record_t;
+
+/* single producer, single consumer ring of one thread */
+typedef struct {
+  uint32_t head;   // next record to fill, owner thread only
+  uint32_t tail;   // next record to format, log thread only
+  uint32_t state;
+  log_record_t rec[LOG_RING_LEN];
+} __attribute__((aligned(64))) log_ring_t;
+
+uint32_t g_csmplog_level = LOG_LEVEL_DEFAULT;
+uint32_t g_csmplog_subsys = CSMP_LOG_ALL;
+
+static log_ring_t m_ring[LOG_RING_CNT];
+static __thread log_ring_t *m_ring_self = NULL;
+static __thread bool m_ring_none = false;
+static uint32_t m_dropped = 0;
+static pthread_once_t m_log_once = PTHREAD_ONCE_INIT;
+static pthread_key_t m_ring_key;
+static pthread_mutex_t m_drain_lock = PTHREAD_MUTEX_INITIALIZER;
+static int m_wake_fd = -1;        // the log thread blocks on it while the rings are empty
+static uint32_t m_wake_sent = 0;  // set once per batch by the first record after a drain
+
+static const struct {
+  const char *dir;
+  uint32_t subsys;
+} m_subsys_dir[] = {
+  { "/coap/", CSMP_LOG_COAP },
+  { "/csmpagent/", CSMP_LOG_AGENT },
+  { "/csmpservice/", CSMP_LOG_SERVICE },
+  { "/csmpapi/", CSMP_LOG_API },
+  { "/csmptlv/", CSMP_LOG_TLV }
+};
+
+static uint64_t log_now() {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_REALTIME, &ts);
+  return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+uint32_t csmplog_subsys(const char *file) {
+  uint32_t i;
+
+  for (i = 0; i < sizeof(m_subsys_dir) / sizeof(m_subsys_dir[0]); i++) {
+    if (strstr(file, m_subsys_dir[i].dir))
+      return m_subsys_dir[i].subsys;
+  }
+  return CSMP_LOG_LIB;
+}
+
+void csmplog_config(csmp_log_level_t level, uint32_t subsys) {
+  __atomic_store_n(&g_csmplog_level, level, __ATOMIC_RELAXED);
+  __atomic_store_n(&g_csmplog_subsys, subsys, __ATOMIC_RELAXED);
+}
+
+uint32_t csmplog_dropped() {
+  return __atomic_load_n(&m_dropped, __ATOMIC_RELAXED);
+}
+
+/*
+ * Walk one conversion of fmt, p points after the '%'. Returns the class
+ * of its argument and moves p past it; star counts the '*' widths and
+ * precisions in front of the argument, prec is -1 without a precision.
+ */
+static arg_class_t log_spec(const char **p, uint32_t *star, int32_t *prec) {
+  const char *c = *p;
+  uint32_t longs = 0;
+  bool size = false;
+
+  *star = 0;
+  *prec = -1;
+  while (*c && strchr("-+ #0", *c))
+    c++;
+  if (*c == '*') {
+    (*star)++;
+    c++;
+  }
+  while ((*c >= '0') && (*c <= '9'))
+    c++;
+  if (*c == '.') {
+    c++;
+    *prec = 0;
+    if (*c == '*') {
+      (*star)++;
+      *prec = -2;  // taken from the argument list
+      c++;
+    }
+    while ((*c >= '0') && (*c <= '9'))
+      *prec = *prec * 10 + (*c++ - '0');
+  }
+  while (*c && strchr("hlLzjt", *c)) {
+    if (*c == 'l')
+      longs++;
+    else if (strchr("zjt", *c))
+      size = true;
+    c++;
+  }
+
+  *p = c;
+  switch (*c) {
+    case 'd': case 'i': case 'u': case 'o': case 'x': case 'X': case 'c':
+      if (size)
+        return ARG_SIZE;
+      return (longs > 1) ? ARG_LLONG : (longs ? ARG_LONG : ARG_INT);
+    case 'p':
+      return ARG_PTR;
+    case 's':
+      return ARG_STR;
+    case 'e': case 'E': case 'f': case 'F': case 'g': case 'G': case 'a': case 'A':
+      return ARG_DOUBLE;
+    default:
+      return ARG_NONE;
+  }
+}
+
+static void log_capture(log_record_t *rec, const char *fmt, va_list ap) {
+  const char *p = fmt, *s;
+  arg_class_t cls;
+  uint32_t star, i;
+  int32_t prec, v;
+  uint64_t arg = 0;
+  double d;
+  size_t len;
+
+  rec->argc = 0;
+  rec->strused = 0;
+  while ((p = strchr(p, '%')) != NULL) {
+    p++;
+    if (*p == '%') {
+      p++;
+      continue;
+    }
+    cls = log_spec(&p, &star, &prec);
+    if (*p)
+      p++;
+    if (rec->argc + star + (cls != ARG_NONE) > LOG_ARG_MAX)
+      break;
+    for (i = 0; i < star; i++) {
+      v = va_arg(ap, int);
+      if ((i == star - 1) && (prec == -2))
+        prec = v;
+      rec->arg[rec->argc++] = (uint64_t)(int64_t)v;
+    }
+
+    switch (cls) {
+      case ARG_INT:
+        arg = (uint64_t)(int64_t)va_arg(ap, int);
+        break;
+      case ARG_LONG:
+        arg = (uint64_t)va_arg(ap, long);
+        break;
+      case ARG_LLONG:
+        arg = (uint64_t)va_arg(ap, long long);
+        break;
+      case ARG_SIZE:
+        arg = (uint64_t)va_arg(ap, size_t);
+        break;
+      case ARG_PTR:
+        arg = (uint64_t)(uintptr_t)va_arg(ap, void *);
+        break;
+      case ARG_DOUBLE:
+        d = va_arg(ap, double);
+        memcpy(&arg, &d, sizeof(arg));
+        break;
+      case ARG_STR:
+        // Strings may not outlive the call, keep a copy
+        s = va_arg(ap, const char *);
+        if (!s)
+          s = "(null)";
+        len = (prec >= 0) ? strnlen(s, prec) : strlen(s);
+        if (len > (size_t)(LOG_STR_MAX - 1 - rec->strused))
+          len = LOG_STR_MAX - 1 - rec->strused;
+        memcpy(rec->str + rec->strused, s, len);
+        rec->str[rec->strused + len] = '\0';
+        arg = rec->strused;
+        rec->strused += len + ((rec->strused + len < LOG_STR_MAX - 1) ? 1 : 0);
+        break;
+      default:
+        continue;
+    }
+    rec->arg[rec->argc++] = arg;
+  }
+}
+
+/* wake the log thread, only the first caller since its last drain writes to the eventfd */
+static void log_wake() {
+  uint64_t one = 1;
+
+  if ((m_wake_fd >= 0) && !__atomic_exchange_n(&m_wake_sent, 1, __ATOMIC_SEQ_CST)) {
+    if (write(m_wake_fd, &one, sizeof(one)) < 0)
+      __atomic_store_n(&m_wake_sent, 0, __ATOMIC_SEQ_CST);
+  }
+}
+
+static void log_ring_release(void *ring) {
+  __atomic_store_n(&((log_ring_t *)ring)->state, RING_RELEASED, __ATOMIC_RELEASE);
+  // Freed by the next drain
+  log_wake();
+}
+
+static log_ring_t *log_ring_claim() {
+  uint32_t i, state;
+
+  for (i = 0; i < LOG_RING_CNT; i++) {
+    state = RING_FREE;
+    if (__atomic_compare_exchange_n(&m_ring[i].state, &state, RING_OWNED, false,
+                                    __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)) {
+      pthread_setspecific(m_ring_key, &m_ring[i]);
+      return &m_ring[i];
+    }
+  }
+  return NULL;
+}
+
+/* format the record into line, returns the length */
+static size_t log_format(const log_record_t *rec, char *line, size_t size) {
+  const char *p = rec->fmt, *start, *c;
+  char spec[LOG_SPEC_MAX];
+  arg_class_t cls;
+  uint32_t star, argi = 0, i;
+  int32_t prec;
+  size_t used = 0, n;
+  double d;
+  int rv;
+
+  while (*p && (used < size - 1)) {
+    if ((*p != '%') || (p[1] == '%')) {
+      line[used++] = *p;
+      p += (*p == '%') ? 2 : 1;
+      continue;
+    }
+    start = p++;
+    cls = log_spec(&p, &star, &prec);
+    if (*p)
+      p++;
+    if ((argi + star + (cls != ARG_NONE) > rec->argc) || (cls == ARG_NONE))
+      break;
+
+    // Put the '*' values into the spec itself, so it takes one argument
+    n = 0;
+    for (c = start; (c < p) && (n < sizeof(spec) - 12); c++) {
+      if (*c == '*')
+        n += snprintf(spec + n, sizeof(spec) - n, "%d", (int)(int64_t)rec->arg[argi++]);
+      else
+        spec[n++] = *c;
+    }
+    spec[n] = '\0';
+
+    i = argi++;
+    switch (cls) {
+      case ARG_INT:
+        rv = snprintf(line + used, size - used, spec, (int)rec->arg[i]);
+        break;
+      case ARG_LONG:
+        rv = snprintf(line + used, size - used, spec, (long)rec->arg[i]);
+        break;
+      case ARG_LLONG:
+        rv = snprintf(line + used, size - used, spec, (long long)rec->arg[i]);
+        break;
+      case ARG_SIZE:
+        rv = snprintf(line + used, size - used, spec, (size_t)rec->arg[i]);
+        break;
+      case ARG_PTR:
+        rv = snprintf(line + used, size - used, spec, (void *)(uintptr_t)rec->arg[i]);
+        break;
+      case ARG_STR:
+        rv = snprintf(line + used, size - used, spec, rec->str + rec->arg[i]);
+        break;
+      default:
+        memcpy(&d, &rec->arg[i], sizeof(d));
+        rv = snprintf(line + used, size - used, spec, d);
+        break;
+    }
+    if (rv > 0)
+      used += ((size_t)rv < size - used) ? (size_t)rv : size - used - 1;
+  }
+  line[used] = '\0';
+  return used;
+}
+
+/* format every queued record, oldest first across the rings */
+static bool log_drain() {
+  char line[LOG_LINE_MAX];
+  log_ring_t *ring, *next;
+  log_record_t *rec;
+  uint32_t i, head;
+  bool any = false;
+  size_t len;
+
+  pthread_mutex_lock(&m_drain_lock);
+  while (1) {
+    next = NULL;
+    for (i = 0; i < LOG_RING_CNT; i++) {
+      ring = &m_ring[i];
+      head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+      if (ring->tail == head) {
+        // The owner is gone and everything it logged is out
+        if (__atomic_load_n(&ring->state, __ATOMIC_ACQUIRE) == RING_RELEASED) {
+          ring->head = ring->tail = 0;
+          __atomic_store_n(&ring->state, RING_FREE, __ATOMIC_RELEASE);
+        }
+        continue;
+      }
+      if (!next || (ring->rec[ring->tail % LOG_RING_LEN].ts <
+                    next->rec[next->tail % LOG_RING_LEN].ts))
+        next = ring;
+    }
+    if (!next)
+      break;
+
+    rec = &next->rec[next->tail % LOG_RING_LEN];
+    len = log_format(rec, line, sizeof(line));
+    __atomic_store_n(&next->tail, next->tail + 1, __ATOMIC_RELEASE);
+    fwrite(line, 1, len, stdout);
+    any = true;
+  }
+  if (any)
+    fflush(stdout);
+  pthread_mutex_unlock(&m_drain_lock);
+  return any;
+}
+
+void csmplog_flush() {
+  log_drain();
+}
+
+/*
+ * Sleeps on the eventfd until a record is queued. The wakeup flag is
+ * cleared before the rings are drained, so a record queued during the
+ * drain wakes the thread again.
+ */
+static void *log_thread(void *arg) {
+  struct timespec ts = { 0, LOG_FLUSH_INTERVAL };
+  uint64_t cnt;
+
+  (void)arg; // Suppress unused param compiler warning.
+  while (1) {
+    if (read(m_wake_fd, &cnt, sizeof(cnt)) < 0)
+      continue;
+    nanosleep(&ts, NULL);
+    __atomic_store_n(&m_wake_sent, 0, __ATOMIC_SEQ_CST);
+    log_drain();
+  }
+  return NULL;
+}
+
+static void log_init() {
+  pthread_t tid;
+
+  pthread_key_create(&m_ring_key, log_ring_release);
+  // Without a log thread records are only written out by csmplog_flush()
+  m_wake_fd = eventfd(0, EFD_CLOEXEC);
+  if ((m_wake_fd >= 0) && (pthread_create(&tid, NULL, log_thread, NULL) == 0))
+    pthread_detach(tid);
+  atexit(csmplog_flush);
+}
+
+void csmplog_write(const char *fmt, ...) {
+  log_ring_t *ring = m_ring_self;
+  log_record_t *rec;
+  uint32_t head;
+  va_list ap;
+
+  if (!ring) {
+    if (m_ring_none)
+      goto dropped;
+    pthread_once(&m_log_once, log_init);
+    ring = m_ring_self = log_ring_claim();
+    if (!ring) {
+      m_ring_none = true;
+      goto dropped;
+    }
+  }
+
+  head = ring->head;
+  if (head - __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE) >= LOG_RING_LEN)
+    goto dropped;
+
+  rec = &ring->rec[head % LOG_RING_LEN];
+  rec->ts = log_now();
+  rec->fmt = fmt;
+  va_start(ap, fmt);
+  log_capture(rec, fmt, ap);
+  va_end(ap);
+  __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+  log_wake();
+  return;
+
+dropped:
+  __atomic_add_fetch(&m_dropped, 1, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,152 @@
+/*
+ *  Copyright 2021 Cisco Systems, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef _CSMPLOG_H
+#define _CSMPLOG_H
+
+/*! \file
+ *
+ * Binary logger
+ *
+ * Log calls store the format string pointer and the raw arguments in a
+ * fixed-size record of a per-thread lock-free ring; a background thread,
+ * started by the first record and asleep while the rings are empty,
+ * formats the records in time order and writes them to stdout. A call
+ * filtered out by level or subsystem costs two loads.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef LOG_RING_CNT
+/** threads with their own log ring, further threads drop their records */
+#define LOG_RING_CNT (8)
+#endif
+
+#ifndef LOG_RING_LEN
+/** records per log ring, a power of 2 */
+#define LOG_RING_LEN (128)
+#endif
+
+#ifndef LOG_ARG_MAX
+/** arguments kept per record */
+#define LOG_ARG_MAX (12)
+#endif
+
+#ifndef LOG_STR_MAX
+/** bytes kept per record for %s arguments */
+#define LOG_STR_MAX (64)
+#endif
+
+#ifndef LOG_LEVEL_DEFAULT
+/** highest level logged until csmplog_config is called */
+#ifdef PRINTDEBUG
+#define LOG_LEVEL_DEFAULT (CSMP_LOG_DEBUG)
+#else
+#define LOG_LEVEL_DEFAULT (CSMP_LOG_ERROR)
+#endif
+#endif
+
+/**
+ * @brief log levels
+ */
+typedef enum {
+  CSMP_LOG_ERROR = 0,  /**< errors */
+  CSMP_LOG_WARN = 1,   /**< warnings */
+  CSMP_LOG_INFO = 2,   /**< informational */
+  CSMP_LOG_DEBUG = 3   /**< debug traces */
+} csmp_log_level_t;
+
+/**
+ * @brief log subsystems, bits of the subsystem mask
+ */
+typedef enum {
+  CSMP_LOG_COAP = 0x01,     /**< CoAP client and server */
+  CSMP_LOG_AGENT = 0x02,    /**< TLV handlers */
+  CSMP_LOG_SERVICE = 0x04,  /**< registration, reports, events and the CSMP server */
+  CSMP_LOG_API = 0x08,      /**< public API */
+  CSMP_LOG_TLV = 0x10,      /**< TLV encoding */
+  CSMP_LOG_LIB = 0x20,      /**< timers and other helpers */
+  CSMP_LOG_ALL = 0x3F       /**< every subsystem */
+} csmp_log_subsys_t;
+
+/** highest level logged, see csmp_log_level_t */
+extern uint32_t g_csmplog_level;
+/** subsystems logged, see csmp_log_subsys_t */
+extern uint32_t g_csmplog_subsys;
+
+/**
+ * @brief log a message from the subsystem of the calling file
+ */
+#define CSMPLOG(level, ...) do { \
+    static uint32_t csmplog_subsys_ = 0; \
+    if (!csmplog_subsys_) \
+      csmplog_subsys_ = csmplog_subsys(__FILE__); \
+    if (csmplog_enabled((level), csmplog_subsys_)) \
+      csmplog_write(__VA_ARGS__); \
+  } while (0)
+
+/**
+ * @brief check whether a message would be logged
+ *
+ * @param level the message level
+ * @param subsys the message subsystem
+ * @return true if it passes the level and subsystem filters
+ */
+static inline bool csmplog_enabled(uint32_t level, uint32_t subsys) {
+  return (level <= __atomic_load_n(&g_csmplog_level, __ATOMIC_RELAXED)) &&
+         (subsys & __atomic_load_n(&g_csmplog_subsys, __ATOMIC_RELAXED));
+}
+
+/**
+ * @brief subsystem of a source file
+ *
+ * @param file the __FILE__ of the caller
+ * @return uint32_t the csmp_log_subsys_t bit
+ */
+uint32_t csmplog_subsys(const char *file);
+
+/**
+ * @brief queue a message
+ *
+ * Arguments are kept as they are, %s strings are copied, and the message
+ * is formatted later by the log thread.
+ *
+ * @param fmt printf format, must be a string literal
+ */
+void csmplog_write(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+
+/**
+ * @brief set the level and subsystem filters
+ *
+ * @param level highest level logged
+ * @param subsys mask of the subsystems logged
+ */
+void csmplog_config(csmp_log_level_t level, uint32_t subsys);
+
+/**
+ * @brief write out every queued message
+ */
+void csmplog_flush();
+
+/**
+ * @brief messages dropped because a ring was full or no ring was free
+ *
+ * @return uint32_t dropped messages
+ */
+uint32_t csmplog_dropped();
+
+#endif
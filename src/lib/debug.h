@@ -19,12 +19,22 @@
 
 /*! \file
  *
- * Debug redirection
+ * Log redirection
  *
+ * EPRINTF, WPRINTF and IPRINTF queue error, warning and informational
+ * messages in the binary log, see csmplog.h, filtered at run time by
+ * csmplog_config. DPRINTF queues debug messages only with PRINTDEBUG and
+ * compiles to nothing otherwise.
  */
 
+#include "csmplog.h"
+
+#define EPRINTF(format, ...) CSMPLOG(CSMP_LOG_ERROR, "error: " format, ##__VA_ARGS__)
+#define WPRINTF(format, ...) CSMPLOG(CSMP_LOG_WARN, "warning: " format, ##__VA_ARGS__)
+#define IPRINTF(...) CSMPLOG(CSMP_LOG_INFO, __VA_ARGS__)
+
 #ifdef PRINTDEBUG
-  #define DPRINTF printf
+  #define DPRINTF(...) CSMPLOG(CSMP_LOG_DEBUG, __VA_ARGS__)
 #else
   #define DPRINTF(format, ...)
 #endif
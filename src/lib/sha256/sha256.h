@@ -0,0 +1,70 @@
+/*
+ *  Copyright 2021 Cisco Systems, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef _SHA256_H
+#define _SHA256_H
+
+/*! \file
+ *
+ * SHA-256 (FIPS 180-4)
+ *
+ * Streaming interface, the context is a plain struct that may be copied
+ * or stored to checkpoint a hash in progress.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+/** \brief SHA-256 digest length in bytes */
+#define SHA256_DIGEST_SIZE 32
+
+/**
+ * @brief hash in progress
+ *
+ */
+typedef struct {
+  uint32_t state[8];  /**< intermediate hash value */
+  uint64_t count;     /**< bytes hashed so far */
+  uint8_t buf[64];    /**< partial block, count % 64 bytes */
+} sha256_ctx_t;
+
+/**
+ * @brief start a hash
+ *
+ * @param ctx context to initialise
+ */
+void sha256_init(sha256_ctx_t *ctx);
+
+/**
+ * @brief add data to a hash
+ *
+ * @param ctx context
+ * @param data data to hash
+ * @param len data length
+ */
+void sha256_update(sha256_ctx_t *ctx, const uint8_t *data, size_t len);
+
+/**
+ * @brief finish a hash
+ *
+ * ctx is left unchanged, more data may still be added to it.
+ *
+ * @param ctx context
+ * @param digest SHA256_DIGEST_SIZE bytes
+ */
+void sha256_final(const sha256_ctx_t *ctx, uint8_t *digest);
+
+#endif
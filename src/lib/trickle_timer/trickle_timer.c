@@ -14,13 +14,12 @@
  *  limitations under the License.
  */
 
-#include <unistd.h>
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <time.h>
 #include <sys/time.h>
-#include <signal.h>
 #include <pthread.h>
 #include <semaphore.h>
 
@@ -34,45 +33,96 @@ struct trickle_timer {
   uint32_t imin;
   uint32_t imax;
   uint8_t is_running :1;
+  uint8_t oneshot :1;
 };
 extern uint8_t g_csmplib_eui64[8];
 
 static struct trickle_timer timers[timer_num];
 static trickle_timer_fired_t timer_fired[timer_num];
 
+/* longest wait of the timer thread, the next firing is recomputed after it */
+#define TIMER_WAIT_MAX 3600
+
 static pthread_t timert_id;
 static sem_t sem;
 
+/*
+ * Timers are started and stopped from the agent's threads while the
+ * timer thread fires them: m_lock guards timers[], timer_fired[] and
+ * the timer thread state. Callbacks are invoked without it.
+ */
+static pthread_mutex_t m_lock = PTHREAD_MUTEX_INITIALIZER;
+
 static int32_t m_remaining = (1UL << 31) - 1; /* max int32_t */
 static bool m_timert_isrunning = false;
+static bool m_sem_isinit = false;
 
+bool next_timer();
 void update_timer();
-void alarm_fired();
+void timers_fired();
+
+/* 32-bit FNV-1a over the full EUI-64 and a salt */
+static uint32_t eui64_hash(uint32_t salt) {
+  uint32_t hash = 2166136261U;
+  uint8_t i;
+
+  for (i = 0; i < 8; i++) {
+    hash ^= g_csmplib_eui64[i];
+    hash *= 16777619U;
+  }
+  for (i = 0; i < 4; i++) {
+    hash ^= (salt >> (i * 8)) & 0xFF;
+    hash *= 16777619U;
+  }
+  return hash;
+}
 
 void *timer_thread(void* arg) {
-  sigset_t set;
+  struct timespec ts;
+  int32_t remaining;
   (void)arg; // Disable un-used argument compiler warning.
-  sigemptyset(&set);
-  sigaddset(&set, SIGALRM);
-  pthread_sigmask(SIG_UNBLOCK, &set, NULL);
 
-  signal(SIGALRM, alarm_fired);
+  // Only cancelled while waiting, never while holding m_lock or in a callback
+  pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, NULL);
   while(1) {
-    sem_wait(&sem);  //suspend thread until sem_post()
-    if (m_remaining <= 0)
-      alarm_fired(SIGALRM);
+    pthread_mutex_lock(&m_lock);
+    // stopped, or replaced by the thread of a later start
+    if (!m_timert_isrunning || !pthread_equal(timert_id, pthread_self())) {
+      pthread_mutex_unlock(&m_lock);
+      break;
+    }
+    next_timer();
+    remaining = m_remaining;
+    pthread_mutex_unlock(&m_lock);
+
+    if (remaining <= 0) {
+      timers_fired();
+      continue;
+    }
+    if (remaining > TIMER_WAIT_MAX)
+      remaining = TIMER_WAIT_MAX;
     else {
-      DPRINTF("trickle timer next fired time:%d sec\n", m_remaining);
-      alarm(m_remaining);
+      DPRINTF("trickle timer next fired time:%d sec\n", remaining);
     }
+
+    // suspend thread until the next firing or a sem_post() from update_timer()
+    clock_gettime(CLOCK_REALTIME, &ts);
+    ts.tv_sec += remaining;
+    pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, NULL);
+    pthread_testcancel();
+    sem_timedwait(&sem, &ts);
+    pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, NULL);
   }
+  return NULL;
 }
 
-void alarm_fired(void)
+void timers_fired(void)
 {
+  trickle_timer_fired_t fired;
   uint32_t min;
   uint8_t i;
 
+  pthread_mutex_lock(&m_lock);
   for (i = 0; i < timer_num; i++) {
     struct trickle_timer *timer = &timers[i];
     uint32_t now;
@@ -87,6 +137,16 @@ void alarm_fired(void)
     if ((int32_t)(timer->tfire - now) > 0)
       continue;
 
+    if (timer->oneshot) {
+      // the callback may re-arm the timer
+      timer->is_running = false;
+      fired = timer_fired[i];
+      pthread_mutex_unlock(&m_lock);
+      fired();
+      pthread_mutex_lock(&m_lock);
+      continue;
+    }
+
     // update t0 to next interval
     timer->t0 += timer->icur;
 
@@ -102,14 +162,22 @@ void alarm_fired(void)
       DPRINTF("metrics report trickle timer fired\n");
     }
 
-    timer_fired[i]();
-    min = timer->icur >> 1;
-    timer->tfire = timer->t0 + min + (random() % (timer->icur - min));
+    fired = timer_fired[i];
+    pthread_mutex_unlock(&m_lock);
+    fired();
+    pthread_mutex_lock(&m_lock);
+
+    // unless the callback stopped the timer or made it a oneshot
+    if (timer->is_running && !timer->oneshot) {
+      min = timer->icur >> 1;
+      timer->tfire = timer->t0 + min + (random() % (timer->icur - min));
+    }
   }
-  update_timer();
+  pthread_mutex_unlock(&m_lock);
 }
 
-void update_timer() {
+/* recompute the seconds to the next firing, m_lock held */
+bool next_timer() {
   uint32_t now;
   struct timeval tv = {0};
   uint8_t i;
@@ -131,27 +199,37 @@ void update_timer() {
       flag = true;
     }
   }
-  if(flag)
+  return flag;
+}
+
+/* recompute the next firing and wake the timer thread, m_lock held */
+void update_timer() {
+  if (next_timer())
     sem_post(&sem);
 }
 
-void trickle_timer_start(timerid_t timerid, uint32_t imin, uint32_t imax, trickle_timer_fired_t trickle_timer_fired)
+/* m_lock held */
+void timer_thread_start()
 {
-  uint32_t min;
-  struct timeval tv = {0};
-  uint32_t seed = 0;
-  sigset_t set;
-
   if(!m_timert_isrunning) {
-    sigemptyset(&set);
-    sigaddset(&set, SIGALRM);
-    sigprocmask(SIG_BLOCK, &set, NULL);
-
-    sem_init(&sem, 0, 0);
+    // kept across stops, a cancelled thread may still be waiting on it
+    if (!m_sem_isinit) {
+      sem_init(&sem, 0, 0);
+      m_sem_isinit = true;
+    }
     pthread_create(&timert_id, NULL, timer_thread, NULL);
     pthread_detach(timert_id);
     m_timert_isrunning = true;
   }
+}
+
+void trickle_timer_start(timerid_t timerid, uint32_t imin, uint32_t imax, trickle_timer_fired_t trickle_timer_fired)
+{
+  uint32_t min;
+  struct timeval tv = {0};
+
+  pthread_mutex_lock(&m_lock);
+  timer_thread_start();
 
   if(timerid == reg_timer) {
     DPRINTF("register trickle timer start\n");
@@ -162,24 +240,46 @@ void trickle_timer_start(timerid_t timerid, uint32_t imin, uint32_t imax, trickl
 
   gettimeofday(&tv, NULL);
 
-  seed = (((uint16_t)g_csmplib_eui64[6] << 8) | g_csmplib_eui64[7]);
-  srand(seed);
+  srand(eui64_hash(0));
   timers[timerid].t0 = tv.tv_sec + (random()%imin);
   timers[timerid].icur = imin;
   timers[timerid].imin = imin;
   timers[timerid].imax = imax;
+  timers[timerid].oneshot = false;
   timers[timerid].is_running = true;
   timer_fired[timerid] = trickle_timer_fired;
   min = timers[timerid].icur >> 1;
   timers[timerid].tfire = timers[timerid].t0 + min + (random() % (timers[timerid].icur - min));
   update_timer();
+  pthread_mutex_unlock(&m_lock);
+}
+
+void trickle_timer_oneshot(timerid_t timerid, uint32_t delay, trickle_timer_fired_t trickle_timer_fired)
+{
+  struct timeval tv = {0};
+
+  pthread_mutex_lock(&m_lock);
+  timer_thread_start();
+
+  if(timerid == rpt_timer) {
+    DPRINTF("metrics report timer set to fire in %u sec\n", delay);
+  }
+
+  gettimeofday(&tv, NULL);
+  timers[timerid].t0 = tv.tv_sec;
+  timers[timerid].tfire = tv.tv_sec + delay;
+  timers[timerid].oneshot = true;
+  timers[timerid].is_running = true;
+  timer_fired[timerid] = trickle_timer_fired;
+  update_timer();
+  pthread_mutex_unlock(&m_lock);
 }
 
 void trickle_timer_stop(timerid_t timerid)
 {
   uint8_t i;
-  sigset_t set;
 
+  pthread_mutex_lock(&m_lock);
   timers[timerid].is_running = false;
   if(timerid == reg_timer) {
     DPRINTF("register trickle timer stop\n");
@@ -188,15 +288,33 @@ void trickle_timer_stop(timerid_t timerid)
     DPRINTF("metrics report trickle timer stop\n");
   }
   for(i = 0; i < timer_num; i++) {
-    if(timers[i].is_running)
+    if(timers[i].is_running) {
+      pthread_mutex_unlock(&m_lock);
       return;
+    }
   }
 
-  pthread_cancel(timert_id);
-  sem_destroy(&sem);
+  if (m_timert_isrunning) {
+    pthread_cancel(timert_id);
+    m_timert_isrunning = false;
+  }
+  pthread_mutex_unlock(&m_lock);
+}
+
+uint32_t trickle_timer_next(timerid_t timerid)
+{
+  uint32_t tfire = 0;
 
-  sigemptyset(&set);
-  sigaddset(&set, SIGALRM);
-  pthread_sigmask(SIG_UNBLOCK, &set, NULL);
-  m_timert_isrunning = false;
+  pthread_mutex_lock(&m_lock);
+  if (timers[timerid].is_running)
+    tfire = timers[timerid].tfire;
+  pthread_mutex_unlock(&m_lock);
+  return tfire;
+}
+
+uint32_t trickle_timer_phase(uint32_t salt, uint32_t window)
+{
+  if (window == 0)
+    return 0;
+  return eui64_hash(salt) % window;
 }
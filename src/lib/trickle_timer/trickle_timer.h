@@ -20,6 +20,9 @@
 /*! \file
  *
  * Timer functions
+ *
+ * Timers may be started and stopped from any thread, callbacks are
+ * invoked on the timer thread.
  */
 
 /** timer types
@@ -28,7 +31,9 @@
 typedef enum {
  reg_timer = 0,  /**< register timer */
  rpt_timer = 1,  /**< reporting timer */
- timer_num = 2   /**< max amount of timers */
+ rpy_timer = 2,  /**< queued report replay timer */
+ evt_timer = 3,  /**< event dispatch timer */
+ timer_num = 4   /**< max amount of timers */
 }timerid_t;
 
 /**
@@ -47,6 +52,18 @@ typedef void (*trickle_timer_fired_t) ();
  */
 void trickle_timer_start(timerid_t timerid, uint32_t imin, uint32_t imax, trickle_timer_fired_t trickle_time_fired);
 
+/**
+ * @brief fire the timer once after a fixed delay
+ *
+ * The timer is no longer running when the callback is invoked,
+ * the callback may re-arm it.
+ *
+ * @param timerid timer type
+ * @param delay seconds until the timer fires
+ * @param trickle_time_fired callback
+ */
+void trickle_timer_oneshot(timerid_t timerid, uint32_t delay, trickle_timer_fired_t trickle_time_fired);
+
 /**
  * @brief stop the timer
  *
@@ -54,4 +71,24 @@ void trickle_timer_start(timerid_t timerid, uint32_t imin, uint32_t imax, trickl
  */
 void trickle_timer_stop(timerid_t timerid);
 
+/**
+ * @brief when the timer fires next
+ *
+ * @param timerid the timer id
+ * @return uint32_t time of the next firing (sec), 0 if the timer is not running
+ */
+uint32_t trickle_timer_next(timerid_t timerid);
+
+/**
+ * @brief offset of this device within a window
+ *
+ * Derived from a hash of the full EUI-64, so devices started together
+ * are spread evenly over the window while each one keeps a stable phase.
+ *
+ * @param salt distinguishes independent uses of the phase
+ * @param window window length in seconds
+ * @return uint32_t offset in [0, window), 0 if window is 0
+ */
+uint32_t trickle_timer_phase(uint32_t salt, uint32_t window);
+
 #endif